@@ -0,0 +1,522 @@
+// 应用热点路径基准（Qt Test QBENCHMARK）
+//
+// 用法：app_benchmark [Qt Test 参数]，例如 app_benchmark -median 5 -o results.xml,xml
+// 通常通过 scripts/compare_benchmarks.py 运行：结果写成 JSON 并与
+// benchmarks/baselines/ 中保存的基线比较。
+//
+// 覆盖预览渲染（整篇与行内）、预览切换主题（重新 setHtml 与就地换色对比）、
+// 全部替换、文档读取/解码与编码/写入、粘贴图片的保存、天气 JSON 的 HTML 格式化，
+// 以及表情选择框的打开与绘制。语料在运行时按固定种子生成，每组既有
+// 典型笔记大小的"真实"语料，也有触发最坏情况的"病态"语料
+// （超长行、未闭合的链接括号、上万项列表、随机噪声图片等）。
+// 语料大小按字符数标注，内容以 ASCII 为主，约等于 UTF-8 字节数。
+//
+// 另有不计时的回归检查（如带图片笔记的 PDF 导出、表情选择框的部件数量），
+// 失败同样由比较脚本报告。
+
+#include "DocumentIO.h"
+#include "DocumentSearch.h"
+#include "MarkdownEditor.h"
+#include "MarkdownRenderer.h"
+#include "PdfExporter.h"
+#include "PreviewTheme.h"
+#include "WeatherFormatter.h"
+#include <QAbstractTextDocumentLayout>
+#include <QEventLoop>
+#include <QImage>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLoggingCategory>
+#include <QPainter>
+#include <QRandomGenerator>
+#include <QTemporaryDir>
+#include <QTextBrowser>
+#include <QTextFrame>
+#include <QtTest>
+#include <iterator>
+#include <memory>
+
+namespace {
+
+constexpr quint32 kSeed = 20260104;
+
+const char *const kWords[] = {
+    "weather", "note", "forecast", "humidity", "pressure", "render", "preview", "editor",
+    "天气", "笔记", "预报", "温度", "morning", "wind", "cloudy", "the", "and", "of",
+};
+
+QString words(QRandomGenerator &rng, int count)
+{
+    QStringList list;
+    for (int i = 0; i < count; ++i) {
+        list.append(QString::fromUtf8(kWords[rng.bounded(int(std::size(kWords)))]));
+    }
+    return list.join(' ');
+}
+
+// 典型笔记：标题、带行内格式的段落、列表、引用与代码块交替出现
+QString realisticMarkdown(int targetLength)
+{
+    QRandomGenerator rng(kSeed);
+    QString text;
+    int section = 0;
+    while (text.size() < targetLength) {
+        text += QString("## %1 %2\n\n").arg(words(rng, 3)).arg(++section);
+        text += QString("%1 **%2** %3 *%4* `%5` [%6](https://example.com/%7) :sunny: %8.\n\n")
+                    .arg(words(rng, 12), words(rng, 2), words(rng, 8), words(rng, 2),
+                         words(rng, 1), words(rng, 2))
+                    .arg(section)
+                    .arg(words(rng, 10));
+        for (int i = 0; i < 4; ++i) {
+            text += QString("- %1 ~~%2~~\n").arg(words(rng, 6), words(rng, 1));
+        }
+        text += QString("\n1. %1\n2. %2\n\n> %3\n\n").arg(words(rng, 5), words(rng, 5), words(rng, 14));
+        text += "```cpp\nint main() { return 0; }\n```\n\n";
+    }
+    return text;
+}
+
+// 每行一串没有配对 "](" 的 "["：链接正则从每个 "[" 起扫描到行尾，行内处理为 O(n²)
+QString unclosedBrackets(int lineLength, int lines)
+{
+    QString line;
+    while (line.size() < lineLength) {
+        line += "[word ";
+    }
+    return QString(line + '\n').repeated(lines);
+}
+
+QString longLine(int length)
+{
+    QRandomGenerator rng(kSeed);
+    QString line;
+    while (line.size() < length) {
+        line += words(rng, 16) + ' ';
+    }
+    return line;
+}
+
+QString longList(int items)
+{
+    QString text;
+    for (int i = 0; i < items; ++i) {
+        text += QString("- item %1 **bold** `code`\n").arg(i);
+    }
+    return text;
+}
+
+QString codeFences(int targetLength)
+{
+    QString text;
+    while (text.size() < targetLength) {
+        text += "```\nfor (int i = 0; i < n; ++i) { sum += a[i] * b[i]; } // <tag> & \"quote\"\n```\n";
+    }
+    return text;
+}
+
+// 类似截图：大块纯色与细线，PNG 压缩率高
+QImage screenshotImage(int width, int height)
+{
+    QImage image(width, height, QImage::Format_ARGB32);
+    image.fill(QColor("#1e1e1e"));
+    QPainter painter(&image);
+    painter.fillRect(0, 0, width / 5, height, QColor("#252526"));
+    painter.setPen(QColor("#cccccc"));
+    for (int y = 40; y < height; y += 18) {
+        painter.drawLine(width / 5 + 20, y, width / 5 + 20 + (y * 37) % (width / 2), y);
+    }
+    return image;
+}
+
+// 随机噪声：PNG 几乎无法压缩，编码最慢
+QImage noiseImage(int width, int height)
+{
+    QImage image(width, height, QImage::Format_ARGB32);
+    QRandomGenerator rng(kSeed);
+    for (int y = 0; y < height; ++y) {
+        quint32 *line = reinterpret_cast<quint32 *>(image.scanLine(y));
+        for (int x = 0; x < width; ++x) {
+            line[x] = rng.generate() | 0xff000000;
+        }
+    }
+    return image;
+}
+
+QByteArray weatherJson(const QString &description)
+{
+    QJsonObject obj;
+    obj["status"] = "success";
+    obj["city"] = "Beijing";
+    obj["temperature"] = 23.4;
+    obj["feels_like"] = 24.1;
+    obj["humidity"] = 56;
+    obj["description"] = description;
+    obj["wind_speed"] = 12.5;
+    obj["pressure"] = 1012.0;
+    return QJsonDocument(obj).toJson(QJsonDocument::Compact);
+}
+
+} // namespace
+
+class AppBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void renderDocument_data();
+    void renderDocument();
+    void processInline_data();
+    void processInline();
+    void previewThemeSwitch_data();
+    void previewThemeSwitch();
+
+    void replaceAll_data();
+    void replaceAll();
+
+    void openDecode_data();
+    void openDecode();
+    void saveEncode_data();
+    void saveEncode();
+
+    void saveImage_data();
+    void saveImage();
+
+    void formatWeatherHTML_data();
+    void formatWeatherHTML();
+
+    void emojiPickerOpen_data();
+    void emojiPickerOpen();
+
+    void exportPdfWithImage();
+
+private:
+    void addDocumentRows();
+
+    QTemporaryDir m_dir;
+};
+
+void AppBenchmark::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+    // 被测代码在每次保存/解析时输出调试信息，计时时关闭
+    QLoggingCategory::setFilterRules("*.debug=false");
+}
+
+void AppBenchmark::renderDocument_data()
+{
+    QTest::addColumn<QString>("markdown");
+    QTest::newRow("note_16KB") << realisticMarkdown(16 * 1024);
+    QTest::newRow("notes_1MB") << realisticMarkdown(1024 * 1024);
+    QTest::newRow("long_line_1MB") << longLine(1024 * 1024);
+    QTest::newRow("unclosed_brackets_64KB") << unclosedBrackets(8 * 1024, 8);
+    QTest::newRow("list_20k_items") << longList(20000);
+    QTest::newRow("code_fences_256KB") << codeFences(256 * 1024);
+}
+
+void AppBenchmark::renderDocument()
+{
+    QFETCH(QString, markdown);
+    QString html;
+    QBENCHMARK {
+        html = MarkdownRenderer::renderDocument(markdown, true);
+    }
+    QVERIFY(!html.isEmpty());
+}
+
+void AppBenchmark::processInline_data()
+{
+    QTest::addColumn<QString>("line");
+    QTest::newRow("plain_sentence") << QString("The forecast for tomorrow is cloudy with light wind.");
+    QTest::newRow("mixed_inline") << QString("**bold** and *italic*, `code`, ~~gone~~ and [a link](https://example.com) "
+                                             "plus ![img](images/a.png) :rocket:");
+    QTest::newRow("shortcodes_4KB") << QString(":smile: :+1: :sunny: :not_a_code: ").repeated(120);
+    QTest::newRow("unclosed_brackets_4KB") << unclosedBrackets(4 * 1024, 1).trimmed();
+    QTest::newRow("long_plain_64KB") << longLine(64 * 1024);
+}
+
+void AppBenchmark::processInline()
+{
+    QFETCH(QString, line);
+    QString html;
+    QBENCHMARK {
+        html = MarkdownRenderer::processInline(line);
+    }
+    QVERIFY(!html.isEmpty());
+}
+
+void AppBenchmark::previewThemeSwitch_data()
+{
+    QTest::addColumn<QString>("markdown");
+    QTest::addColumn<bool>("reparse");
+    const QString note = realisticMarkdown(16 * 1024);
+    const QString notes = realisticMarkdown(256 * 1024);
+    QTest::newRow("note_16KB_setHtml") << note << true;
+    QTest::newRow("note_16KB_recolor") << note << false;
+    QTest::newRow("notes_256KB_setHtml") << notes << true;
+    QTest::newRow("notes_256KB_recolor") << notes << false;
+}
+
+void AppBenchmark::previewThemeSwitch()
+{
+    QFETCH(QString, markdown);
+    QFETCH(bool, reparse);
+
+    // 与 MainWindow 中的预览设置相同；计时包括完成整篇重新布局
+    QTextBrowser preview;
+    preview.setUndoRedoEnabled(false);
+    preview.document()->setTextWidth(760);
+    preview.setHtml(MarkdownRenderer::renderDocument(markdown, true));
+    const QString body = MarkdownRenderer::renderBody(markdown);
+
+    bool isDark = true;
+    QBENCHMARK {
+        isDark = !isDark;
+        if (reparse) {
+            preview.setHtml(MarkdownRenderer::stylePrelude(isDark) + body + "</body>");
+        } else {
+            PreviewTheme::recolor(preview.document(), !isDark, isDark);
+        }
+        preview.document()->documentLayout()->documentSize();
+    }
+
+    // 两种方式的结果一致：<body> 背景是当前主题的颜色
+    const QColor background = preview.document()->rootFrame()->frameFormat().background().color();
+    QCOMPARE(background, QColor(MarkdownRenderer::themeColors(isDark).first()));
+}
+
+void AppBenchmark::replaceAll_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<QString>("pattern");
+    QTest::addColumn<bool>("useRegex");
+    QTest::addColumn<QString>("replacement");
+
+    // 每行 10 个匹配 × 1 万行：受影响文本块很多，走整段一次性插入的路径
+    const QString line = QString("cloudy wind ").repeated(10) + '\n';
+    const QString manyLines = line.repeated(10000);
+    // 每行 400 个匹配 × 250 行：不超过逐块替换的上限
+    const QString longLines = (QString("cloudy wind ").repeated(400) + '\n').repeated(250);
+
+    QTest::newRow("plain_100k_matches_10k_lines") << manyLines << QString("cloudy") << false << QString("sunny");
+    QTest::newRow("plain_100k_matches_250_lines") << longLines << QString("cloudy") << false << QString("sunny");
+    QTest::newRow("regex_backref_100k_matches") << manyLines << QString("(cl)oud(y)") << true << QString("\\2\\1ear");
+}
+
+void AppBenchmark::replaceAll()
+{
+    QFETCH(QString, text);
+    QFETCH(QString, pattern);
+    QFETCH(bool, useRegex);
+    QFETCH(QString, replacement);
+
+    // 每次测量重新准备文档，替换本身只运行一次
+    QTextDocument document;
+    document.setPlainText(text);
+    DocumentSearch search;
+    search.setDocument(&document);
+    search.setQuery(pattern, true, useRegex);
+    QCOMPARE(search.matchCount(), 100000);
+    const int undoSteps = document.availableUndoSteps();
+
+    int count = 0;
+    QBENCHMARK_ONCE {
+        count = search.replaceAll(replacement);
+    }
+    QCOMPARE(count, 100000);
+    // 全部替换必须是一个撤销步骤
+    QCOMPARE(document.availableUndoSteps(), undoSteps + 1);
+    QCOMPARE(search.matchCount(), 0);
+}
+
+void AppBenchmark::addDocumentRows()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<int>("encoding");
+    QTest::addColumn<QByteArray>("bom");
+
+    const QString note = realisticMarkdown(64 * 1024);
+    const QString large = realisticMarkdown(4 * 1024 * 1024);
+    QTest::newRow("utf8_64KB") << note << int(QStringConverter::Utf8) << QByteArray();
+    QTest::newRow("utf8_4MB") << large << int(QStringConverter::Utf8) << QByteArray();
+    QTest::newRow("utf8_bom_4MB") << large << int(QStringConverter::Utf8) << QByteArray("\xEF\xBB\xBF");
+    QTest::newRow("utf16le_4MB") << large << int(QStringConverter::Utf16LE) << QByteArray("\xFF\xFE");
+    QTest::newRow("utf16be_4MB") << large << int(QStringConverter::Utf16BE) << QByteArray("\xFE\xFF");
+    QTest::newRow("long_line_4MB") << longLine(4 * 1024 * 1024) << int(QStringConverter::Utf8) << QByteArray();
+}
+
+void AppBenchmark::openDecode_data()
+{
+    addDocumentRows();
+}
+
+void AppBenchmark::openDecode()
+{
+    QFETCH(QString, text);
+    QFETCH(int, encoding);
+    QFETCH(QByteArray, bom);
+
+    QStringEncoder encoder(QStringConverter::Encoding(encoding));
+    const QByteArray data = encoder(text);
+    const QString filePath = m_dir.filePath(QString("open_%1.md").arg(QTest::currentDataTag()));
+    QString error;
+    QVERIFY2(DocumentIO::writeFile(filePath, bom, data, &error), qPrintable(error));
+
+    DocumentIO::Document document;
+    QBENCHMARK {
+        QByteArray rawData;
+        QVERIFY2(DocumentIO::readFile(filePath, &rawData, &error), qPrintable(error));
+        QVERIFY(DocumentIO::decode(rawData, &document) == DocumentIO::Decoded);
+    }
+    QCOMPARE(document.text.size(), text.size());
+}
+
+void AppBenchmark::saveEncode_data()
+{
+    addDocumentRows();
+}
+
+void AppBenchmark::saveEncode()
+{
+    QFETCH(QString, text);
+    QFETCH(int, encoding);
+    QFETCH(QByteArray, bom);
+
+    const QString filePath = m_dir.filePath(QString("save_%1.md").arg(QTest::currentDataTag()));
+    DocumentIO::Document document;
+    document.text = text;
+    document.encoding = QStringConverter::Encoding(encoding);
+    document.bom = bom;
+
+    QBENCHMARK {
+        QByteArray data;
+        QString error;
+        QVERIFY(DocumentIO::encode(&document, &data));
+        QVERIFY2(DocumentIO::writeFile(filePath, document.bom, data, &error), qPrintable(error));
+    }
+}
+
+void AppBenchmark::saveImage_data()
+{
+    QTest::addColumn<QImage>("image");
+    QTest::newRow("icon_64x64") << screenshotImage(64, 64);
+    QTest::newRow("screenshot_1280x800") << screenshotImage(1280, 800);
+    QTest::newRow("screenshot_3840x2160") << screenshotImage(3840, 2160);
+    QTest::newRow("noise_1920x1080") << noiseImage(1920, 1080);
+}
+
+void AppBenchmark::saveImage()
+{
+    QFETCH(QImage, image);
+
+    // saveImage 按时间戳命名，每次迭代写入新文件；每组使用单独的目录
+    MarkdownEditor editor;
+    editor.setImageSaveDirectory(m_dir.filePath(QString("images_%1").arg(QTest::currentDataTag())));
+
+    QString relativePath;
+    QBENCHMARK {
+        relativePath = editor.saveImage(image);
+    }
+    QVERIFY(!relativePath.isEmpty());
+}
+
+void AppBenchmark::formatWeatherHTML_data()
+{
+    QTest::addColumn<QString>("output");
+    QTest::newRow("success") << QString::fromUtf8(weatherJson("Partly cloudy"));
+    QTest::newRow("error_status") << QString(R"({"status":"error","error_message":"City not found: Atlantis"})");
+    QTest::newRow("malformed_64KB") << QString("Traceback (most recent call last): <html> & ").repeated(1500);
+    QTest::newRow("huge_description_256KB") << QString::fromUtf8(weatherJson(longLine(256 * 1024)));
+}
+
+void AppBenchmark::formatWeatherHTML()
+{
+    QFETCH(QString, output);
+    QString html;
+    QBENCHMARK {
+        html = WeatherFormatter::formatWeatherHTML(output, "Beijing", true);
+    }
+    QVERIFY(!html.isEmpty());
+}
+
+void AppBenchmark::emojiPickerOpen_data()
+{
+    QTest::addColumn<bool>("reuse");
+    // 构造对话框后第一次打开；进程中第一次运行时图集为空，可见字形要先光栅化
+    QTest::newRow("first_open") << false;
+    // 之后每次打开复用同一个对话框（与 MarkdownEditorWidget 相同）
+    QTest::newRow("reopen") << true;
+}
+
+void AppBenchmark::emojiPickerOpen()
+{
+    QFETCH(bool, reuse);
+
+    // 走真实的打开路径 exec()（刷新使用记录与"常用"一行）；进入事件循环后
+    // grab() 同步绘制整个对话框，然后关闭。验收标准是 16 ms 内完成
+    auto open = [](EmojiPickerDialog *dialog) {
+        QMetaObject::invokeMethod(dialog, [dialog]() {
+            dialog->grab();
+            dialog->reject();
+        }, Qt::QueuedConnection);
+        dialog->exec();
+    };
+
+    std::unique_ptr<EmojiPickerDialog> dialog;
+    if (reuse) {
+        dialog = std::make_unique<EmojiPickerDialog>();
+        open(dialog.get());
+        QBENCHMARK {
+            open(dialog.get());
+        }
+    } else {
+        QBENCHMARK_ONCE {
+            dialog = std::make_unique<EmojiPickerDialog>();
+            open(dialog.get());
+        }
+    }
+
+    // 改造前每个表情一个按钮（约 750 个部件）；虚拟化后部件数量与表情数量无关
+    const int widgets = int(dialog->findChildren<QWidget *>().size());
+    QVERIFY2(widgets < 50, qPrintable(QString("emoji picker has %1 child widgets").arg(widgets)));
+}
+
+void AppBenchmark::exportPdfWithImage()
+{
+    // 预览按搜索路径加载的图片必须出现在导出的 PDF 中（工作线程中的克隆无法自己加载）
+    QVERIFY(QDir(m_dir.path()).mkpath("pdf_images"));
+    QVERIFY(screenshotImage(320, 200).save(m_dir.filePath("pdf_images/shot.png")));
+
+    QTextBrowser preview;
+    preview.setSearchPaths({m_dir.path()});
+    preview.setHtml(MarkdownRenderer::renderDocument("# Note\n\n![shot](pdf_images/shot.png)\n", true));
+    QVERIFY(preview.document()->resource(QTextDocument::ImageResource, QUrl("pdf_images/shot.png")).isValid());
+
+    PdfExporter exporter;
+    QEventLoop loop;
+    bool done = false;
+    bool ok = false;
+    QString error;
+    connect(&exporter, &PdfExporter::finished, &loop,
+            [&](bool success, const QString &, const QString &message) {
+                done = true;
+                ok = success;
+                error = message;
+                loop.quit();
+            });
+    QTimer::singleShot(30000, &loop, &QEventLoop::quit);
+
+    const QString pdfPath = m_dir.filePath("image_note.pdf");
+    QVERIFY(exporter.start(preview.document(), pdfPath));
+    loop.exec();
+    QVERIFY2(done, "PDF export timed out");
+    QVERIFY2(ok, qPrintable(error));
+
+    QFile pdf(pdfPath);
+    QVERIFY(pdf.open(QFile::ReadOnly));
+    QVERIFY2(pdf.readAll().contains("/Subtype /Image"), "exported PDF has no image");
+}
+
+QTEST_MAIN(AppBenchmark)
+#include "app_benchmark.moc"
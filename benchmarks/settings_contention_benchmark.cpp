@@ -0,0 +1,131 @@
+// SettingsManager 读取争用基准
+//
+// 用法：settings_contention_benchmark [最大线程数] [每轮毫秒数]
+//
+// 每轮 N 个读线程不停读取 "theme"，另有一个写线程每毫秒写入一次，
+// 输出所有读线程合计的每秒读取次数。对照组是改造前的实现：
+// 每次读取加 QMutex 并调用 QSettings::value；另外两组是 SettingsManager 的
+// 按字符串读取（getValue）与类型化读取（get<Settings::Key::Theme>()）。
+// 两边都使用临时目录中的设置文件，不读写程序的 config.ini。
+
+#include "SettingsManager.h"
+#include <QCoreApplication>
+#include <QDir>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <QThread>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<long long> g_hits{0};  // 使用读取结果，防止被优化掉
+
+// 改造前的读取路径
+class LockedSettings
+{
+public:
+    explicit LockedSettings(const QString &filePath)
+        : m_settings(filePath, QSettings::IniFormat)
+    {
+    }
+
+    QVariant value(const QString &key, const QVariant &defaultValue = QVariant())
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_settings.value(key, defaultValue);
+    }
+
+    void setValue(const QString &key, const QVariant &value)
+    {
+        QMutexLocker locker(&m_mutex);
+        m_settings.setValue(key, value);
+    }
+
+private:
+    QMutex m_mutex;
+    QSettings m_settings;
+};
+
+double measure(int readers, int durationMs,
+               const std::function<bool()> &read, const std::function<void(int)> &write)
+{
+    std::atomic<bool> running{true};
+    std::atomic<long long> totalReads{0};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < readers; ++i) {
+        threads.emplace_back([&]() {
+            long long reads = 0;
+            long long hits = 0;
+            while (running.load(std::memory_order_relaxed)) {
+                hits += read() ? 1 : 0;
+                ++reads;
+            }
+            totalReads += reads;
+            g_hits += hits;
+        });
+    }
+    threads.emplace_back([&]() {
+        int counter = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            write(++counter);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+    running = false;
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return totalReads.load() / seconds;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    const int maxThreads = argc > 1 ? qMax(1, atoi(argv[1])) : QThread::idealThreadCount();
+    const int durationMs = argc > 2 ? qMax(100, atoi(argv[2])) : 1000;
+
+    QTemporaryDir tempDir;
+    const QString themeKey = QStringLiteral("theme");
+    const QString counterKey = QStringLiteral("benchmark/counter");
+    const QString dark = QStringLiteral("dark");
+
+    LockedSettings locked(QDir(tempDir.path()).filePath("locked.ini"));
+    locked.setValue(themeKey, dark);
+
+    SettingsManager settings(QDir(tempDir.path()).filePath("config.ini"));
+    settings.setValue(themeKey, dark);
+
+    std::printf("%8s %18s %18s %18s %8s %8s\n", "readers", "mutex (reads/s)", "getValue (reads/s)",
+                "get<Key> (reads/s)", "speedup", "typed");
+    for (int readers = 1; readers <= maxThreads; readers *= 2) {
+        const double lockedRate = measure(readers, durationMs,
+            [&]() { return locked.value(themeKey).toString() == dark; },
+            [&](int counter) { locked.setValue(counterKey, counter); });
+        const double snapshotRate = measure(readers, durationMs,
+            [&]() { return settings.getValue(themeKey).toString() == dark; },
+            [&](int counter) { settings.setValue(counterKey, counter); });
+        const double typedRate = measure(readers, durationMs,
+            [&]() { return settings.get<Settings::Key::Theme>() == dark; },
+            [&](int counter) { settings.setValue(counterKey, counter); });
+
+        std::printf("%8d %18.0f %18.0f %18.0f %7.1fx %7.1fx\n", readers, lockedRate, snapshotRate, typedRate,
+                    snapshotRate / lockedRate, typedRate / lockedRate);
+        std::fflush(stdout);
+    }
+    return 0;
+}
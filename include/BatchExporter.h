@@ -0,0 +1,68 @@
+#ifndef BATCHEXPORTER_H
+#define BATCHEXPORTER_H
+
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief 无界面的批量 Markdown → HTML 导出器
+ *
+ * 递归遍历输入目录中的 .md/.markdown 文件，在线程池中并行渲染，
+ * 并按相同的相对路径写入输出目录。同时在途的文件数量受信号量限制，
+ * 因此内存占用与目录大小无关。
+ */
+class BatchExporter
+{
+public:
+    /**
+     * @brief 导出选项
+     */
+    struct Options
+    {
+        QString inputDir;
+        QString outputDir;
+        bool isDark = true;  ///< 使用深色主题配色
+        int threads = 0;     ///< 工作线程数，0 表示使用全部核心
+    };
+
+    /**
+     * @brief 导出统计
+     */
+    struct Stats
+    {
+        int exported = 0;
+        int failed = 0;
+        qint64 bytesRead = 0;
+        qint64 bytesWritten = 0;
+        qint64 elapsedMs = 0;
+    };
+
+    explicit BatchExporter(const Options &options);
+
+    /**
+     * @brief 执行导出，阻塞直到所有文件完成
+     */
+    Stats run();
+
+    /**
+     * @brief 解析命令行并执行导出
+     *
+     * 用法：WeatherApp --export <输入目录> <输出目录> [--theme dark|light] [--threads N]
+     *
+     * @param arguments QCoreApplication::arguments()
+     * @return 进程退出码
+     */
+    static int runFromCommandLine(const QStringList &arguments);
+
+private:
+    /**
+     * @brief 读取、解码、渲染并原子写入单个文件
+     * @return 成功时返回 true，并通过输出参数返回读写字节数
+     */
+    bool exportFile(const QString &sourcePath, const QString &targetPath,
+                    qint64 *bytesRead, qint64 *bytesWritten, QString *error) const;
+
+    Options m_options;
+};
+
+#endif // BATCHEXPORTER_H
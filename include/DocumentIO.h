@@ -0,0 +1,52 @@
+#ifndef DOCUMENTIO_H
+#define DOCUMENTIO_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringConverter>
+
+/**
+ * @brief Markdown 文档的读取/解码与编码/写入
+ *
+ * 从 MainWindow 中抽出，只依赖 QtCore：按 BOM 识别 UTF-8 / UTF-16 LE / UTF-16 BE，
+ * 保存时沿用原文件的编码与 BOM，通过 QSaveFile 原子写入。
+ * 错误通过返回值与 error 字符串报告，由调用方决定如何提示用户。
+ */
+class DocumentIO
+{
+public:
+    DocumentIO() = delete;
+
+    struct Document
+    {
+        QString text;
+        QStringConverter::Encoding encoding = QStringConverter::Utf8;
+        QByteArray bom;  // 保存时原样写回
+    };
+
+    enum DecodeResult {
+        Decoded,
+        DecodedAsUtf8,  // 按 BOM 检测到的编码解码失败，已回退到 UTF-8
+        DecodeFailed
+    };
+
+    static bool readFile(const QString &filePath, QByteArray *data, QString *error);
+
+    /**
+     * @brief 检测 BOM 并解码文件内容
+     */
+    static DecodeResult decode(const QByteArray &rawData, Document *document);
+
+    /**
+     * @brief 按文档的编码编码文本（不含 BOM）
+     * @return 编码出错时返回 false，此时 data 为 UTF-8 编码的结果，document 的编码改为 UTF-8
+     */
+    static bool encode(Document *document, QByteArray *data);
+
+    /**
+     * @brief 原子写入 BOM 与内容，失败时保留原文件
+     */
+    static bool writeFile(const QString &filePath, const QByteArray &bom, const QByteArray &data, QString *error);
+};
+
+#endif // DOCUMENTIO_H
@@ -0,0 +1,126 @@
+#ifndef DOCUMENTSEARCH_H
+#define DOCUMENTSEARCH_H
+
+#include <QObject>
+#include <QPointer>
+#include <QRegularExpression>
+#include <QString>
+#include <QStringView>
+#include <QTextDocument>
+#include <array>
+#include <vector>
+
+/**
+ * @brief 在 QTextDocument 上运行的查找/替换引擎
+ *
+ * 普通模式使用 Boyer–Moore–Horspool 子串搜索（单字符模式退化为
+ * Qt 的向量化字符扫描），正则模式逐个文本块运行 QRegularExpression。
+ * 匹配结果保存在按起始位置排序的区间数组中；文档内容变化时只重新
+ * 扫描受影响的文本块，其余区间仅做平移。
+ */
+class DocumentSearch : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 单个匹配区间（文档绝对位置）
+     */
+    struct Match
+    {
+        int start;
+        int length;
+    };
+
+    explicit DocumentSearch(QObject *parent = nullptr);
+    ~DocumentSearch() override;
+
+    /**
+     * @brief 设置要搜索的文档，并跟踪其内容变化
+     */
+    void setDocument(QTextDocument *document);
+
+    /**
+     * @brief 设置查询条件并重新扫描整个文档
+     * @param pattern 查找文本或正则表达式
+     * @param caseSensitive 是否区分大小写
+     * @param useRegex 是否按正则表达式解释 pattern
+     */
+    void setQuery(const QString &pattern, bool caseSensitive, bool useRegex);
+
+    /**
+     * @brief 清空查询和全部匹配
+     */
+    void clear();
+
+    QString pattern() const;
+    bool isActive() const;
+
+    /**
+     * @brief 正则表达式无效时返回错误描述，否则为空
+     */
+    QString errorString() const;
+
+    int matchCount() const;
+    const std::vector<Match> &matches() const;
+
+    /**
+     * @brief 返回与 [from, to) 区间相交的第一个匹配和末尾后一个匹配的下标
+     *
+     * 用于只绘制视口内的高亮，复杂度 O(log n)。
+     */
+    std::pair<int, int> matchesInRange(int from, int to) const;
+
+    /**
+     * @brief 查找 position 之后（或之前）最近的匹配，到达文档边界时回绕
+     * @return 匹配下标，没有匹配时返回 -1
+     */
+    int findNext(int position, bool backward = false) const;
+
+    /**
+     * @brief 返回与给定区间完全一致的匹配下标，不存在时返回 -1
+     */
+    int indexOf(int start, int length) const;
+
+    /**
+     * @brief 替换单个匹配
+     * @return 插入文本末尾的文档位置（正则模式下按展开反向引用后的实际长度），
+     *         下标无效时返回 -1
+     */
+    int replaceAt(int index, const QString &replacement);
+
+    /**
+     * @brief 替换全部匹配，作为一个撤销步骤提交
+     * @return 替换的数量
+     */
+    int replaceAll(const QString &replacement);
+
+signals:
+    /**
+     * @brief 匹配集合发生变化（重新扫描或增量更新之后）
+     */
+    void matchesChanged();
+
+private slots:
+    void onContentsChange(int position, int charsRemoved, int charsAdded);
+
+private:
+    void rescan();
+    void rebuildSkipTable();
+    void scanPlain(QStringView text, int basePosition, std::vector<Match> &out) const;
+    void scanRegex(const QString &text, int basePosition, std::vector<Match> &out) const;
+    void scanBlocks(const QTextBlock &first, const QTextBlock &last, std::vector<Match> &out) const;
+    QString replacedBlockText(const QTextBlock &block, const QString &replacement) const;
+    QString expandReplacement(const QString &replacement, const QRegularExpressionMatch &match) const;
+
+    QPointer<QTextDocument> m_document;
+    QString m_pattern;
+    bool m_caseSensitive;
+    bool m_useRegex;
+    bool m_suspended;  ///< 批量替换期间暂停增量更新
+    QRegularExpression m_regex;
+    std::array<int, 256> m_skipTable;  ///< Horspool 坏字符跳转表（按低 8 位散列）
+    std::vector<Match> m_matches;      ///< 按 start 升序排列，互不重叠
+};
+
+#endif // DOCUMENTSEARCH_H
@@ -0,0 +1,23 @@
+#ifndef EMOJIDELEGATE_H
+#define EMOJIDELEGATE_H
+
+#include <QStyledItemDelegate>
+
+/**
+ * @brief 表情选择器的委托：背景用调色板颜色绘制，字形从 EmojiGlyphAtlas 拷贝
+ *
+ * 颜色取自调色板（由主题令牌生成）：Button 为普通背景，Light 为悬停，
+ * Highlight 为选中与悬停边框。
+ */
+class EmojiDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    using QStyledItemDelegate::QStyledItemDelegate;
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+};
+
+#endif // EMOJIDELEGATE_H
@@ -0,0 +1,62 @@
+#ifndef EMOJIGLYPHATLAS_H
+#define EMOJIGLYPHATLAS_H
+
+#include <QBitArray>
+#include <QFont>
+#include <QPixmap>
+#include <QSize>
+#include <QVector>
+#include <memory>
+
+class QPainter;
+class QRect;
+class QScreen;
+
+/**
+ * @brief 表情字形的光栅化图集
+ *
+ * 每种 (屏幕, 字体, 设备像素比) 组合只有一个图集。图集按页分配，每页 8×8 个单元，
+ * 字形第一次绘制时才光栅化进对应单元，之后的绘制只是一次位图拷贝；
+ * 没有显示过的页不占内存。图集缓存归应用程序所有：退出事件循环时释放，
+ * 屏幕断开时丢弃该屏幕的图集。只在 GUI 线程中使用。
+ */
+class EmojiGlyphAtlas
+{
+public:
+    EmojiGlyphAtlas(const EmojiGlyphAtlas &) = delete;
+    EmojiGlyphAtlas &operator=(const EmojiGlyphAtlas &) = delete;
+
+    /**
+     * @brief 获取（必要时创建）与屏幕、字体和设备像素比对应的图集
+     * @param screen 绘制目标所在的屏幕；同一 DPR 的不同屏幕可能有不同的字体光栅化设置
+     */
+    static EmojiGlyphAtlas &forFont(const QFont &font, const QScreen *screen, qreal devicePixelRatio);
+
+    /**
+     * @brief 单元的逻辑尺寸
+     */
+    QSize cellSize() const;
+
+    /**
+     * @brief 把第 index 个字形居中绘制到 target 中
+     * @param glyph 字形文本；只在第一次绘制时用于光栅化
+     */
+    void draw(QPainter *painter, const QRect &target, int index, const QString &glyph);
+
+private:
+    struct Page
+    {
+        QPixmap pixmap;
+        QBitArray rendered;
+    };
+
+    EmojiGlyphAtlas(const QFont &font, qreal devicePixelRatio);
+    void render(Page *page, int slot, const QString &glyph);
+
+    QFont m_font;
+    qreal m_devicePixelRatio;
+    int m_cellSize;  // 逻辑像素
+    QVector<std::shared_ptr<Page>> m_pages;
+};
+
+#endif // EMOJIGLYPHATLAS_H
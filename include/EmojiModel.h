@@ -0,0 +1,50 @@
+#ifndef EMOJIMODEL_H
+#define EMOJIMODEL_H
+
+#include <QAbstractListModel>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief 静态表情表上的列表模型
+ *
+ * 表情表在首次使用时转换为 QStringList 并在所有模型实例间共享，
+ * 模型本身只保存要显示的表格下标（搜索结果、最近使用），默认显示整张表。
+ */
+class EmojiModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Role {
+        TableIndexRole = Qt::UserRole  // 表情在静态表中的下标（字形图集按它缓存）
+    };
+
+    using QAbstractListModel::QAbstractListModel;
+
+    /**
+     * @brief 全部表情（按分类排列）
+     */
+    static const QStringList &emojis();
+
+    /**
+     * @brief 只显示给定的表格下标（按给定顺序）
+     */
+    void setTableIndices(const QVector<int> &indices);
+
+    /**
+     * @brief 恢复显示整张表
+     */
+    void showAll();
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private:
+    int tableIndex(int row) const;
+
+    bool m_filtered = false;
+    QVector<int> m_indices;
+};
+
+#endif // EMOJIMODEL_H
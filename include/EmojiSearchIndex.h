@@ -0,0 +1,51 @@
+#ifndef EMOJISEARCHINDEX_H
+#define EMOJISEARCHINDEX_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <vector>
+
+/**
+ * @brief 表情注释（中英文名称与关键词）上的前缀索引
+ *
+ * 所有词条小写后放在一个有序数组中，查询每个词时二分定位再顺序扫描前缀相同的一段，
+ * 与前缀树等价但更紧凑。英文按单词建索引；中文词条额外收录从每个汉字开始的后缀，
+ * 因此中文查询可以匹配词条中间的部分（"笑" 能找到 "微笑"）。
+ * 索引在首次使用时构建一次，之后只读，每次按键的查询在微秒级完成。
+ */
+class EmojiSearchIndex
+{
+public:
+    static const EmojiSearchIndex &instance();
+
+    /**
+     * @brief 查找匹配所有查询词的表情
+     * @param query 用空白或标点分隔的查询词，不区分大小写
+     * @param usageScores 按表格下标的使用分数（可为空），分数高的排在前面
+     * @return 排好序的表格下标；查询为空时返回空列表
+     */
+    QVector<int> search(const QString &query, const QVector<float> &usageScores) const;
+
+    /**
+     * @brief 表情在表格中的下标，不存在时返回 -1
+     */
+    int tableIndexOf(const QString &glyph) const;
+
+private:
+    struct Key
+    {
+        QString text;
+        int tableIndex;
+        int tier;  // 0 = 名称中的词，1 = 关键词
+    };
+
+    EmojiSearchIndex();
+
+    void addTerms(const char *utf8, int tableIndex, int tier, bool withSuffixes);
+
+    std::vector<Key> m_keys;
+    QHash<QString, int> m_glyphIndex;
+};
+
+#endif // EMOJISEARCHINDEX_H
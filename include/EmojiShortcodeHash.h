@@ -0,0 +1,48 @@
+// 由 scripts/generate_emoji_shortcode_hash.py 生成，不要手工修改。
+// 修改 EmojiTable.h 或 EmojiShortcodes.cpp 中的别名后重新运行该脚本。
+
+#ifndef EMOJISHORTCODEHASH_H
+#define EMOJISHORTCODEHASH_H
+
+#include <cstdint>
+
+namespace EmojiShortcodeHash {
+
+inline constexpr int kTableSize = 918;
+
+// 每个桶的位移：高 16 位为探测步长的倍数，低 16 位为偏移
+inline constexpr std::uint32_t kDisplacements[] = {
+    0x00000016, 0x00000025, 0x00000005, 0x0000008b, 0x00000008, 0x00000016, 0x00000001, 0x00000018,
+    0x00000000, 0x00000011, 0x00000028, 0x00000004, 0x00000001, 0x0000000a, 0x00000002, 0x000000eb,
+    0x00000002, 0x0000018e, 0x00000029, 0x00000036, 0x00000089, 0x0000003a, 0x00000036, 0x00000038,
+    0x0000000c, 0x0000001e, 0x00000000, 0x00000017, 0x00000007, 0x00000042, 0x0000000a, 0x0000004f,
+    0x00000072, 0x00010001, 0x0000002f, 0x00000003, 0x00000065, 0x00000005, 0x000000e9, 0x00000010,
+    0x0000008d, 0x00000008, 0x0000000b, 0x00000000, 0x0000007f, 0x00000000, 0x0000001b, 0x00000028,
+    0x00000000, 0x00000000, 0x00000053, 0x00000004, 0x00000009, 0x0000008b, 0x000000ac, 0x00000003,
+    0x000000bd, 0x00000000, 0x00000003, 0x0000000b, 0x00000000, 0x0000005d, 0x00000000, 0x000000be,
+    0x0000004d, 0x00000000, 0x00000078, 0x00000000, 0x0000006f, 0x00000006, 0x00000005, 0x0000001e,
+    0x0000001d, 0x0000000c, 0x00000002, 0x00000014, 0x0000012b, 0x0000001d, 0x0000004d, 0x00000006,
+    0x00000311, 0x0000000a, 0x000000f7, 0x0000001e, 0x00000195, 0x00000000, 0x00000024, 0x0000002b,
+    0x00000028, 0x00000000, 0x0000004c, 0x00000014, 0x0000005e, 0x00000014, 0x0000006e, 0x0000008e,
+    0x00000007, 0x00000024, 0x00000004, 0x00000005, 0x00000008, 0x00000001, 0x00000002, 0x00000268,
+    0x0000017a, 0x0000000d, 0x00000092, 0x000000be, 0x000000b0, 0x00000000, 0x0000005d, 0x0000001f,
+    0x00000131, 0x0000003b, 0x00000042, 0x00000014, 0x00000002, 0x00000004, 0x00000138, 0x000000e5,
+    0x00000010, 0x0000001b, 0x000001e6, 0x0000000c, 0x00000002, 0x0000008d, 0x00000000, 0x0000005b,
+    0x0000003f, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000081, 0x000000e4,
+    0x00000015, 0x00000000, 0x00000001, 0x0001000c, 0x0000000c, 0x0000000f, 0x0002006c, 0x00000186,
+    0x00000000, 0x00000018, 0x00000068, 0x000000fb, 0x0000000f, 0x00000003, 0x000001ce, 0x000000f2,
+    0x00000012, 0x000000be, 0x0000000b, 0x00000111, 0x00000018, 0x00000010, 0x00000079, 0x0000003a,
+    0x000000bf, 0x00000023, 0x00000008, 0x00000184, 0x00000005, 0x000000e4, 0x000000c8, 0x000001ea,
+    0x0001011d, 0x00000027, 0x0000006a, 0x00000188, 0x0000000c, 0x000000a8, 0x000002b8, 0x00000006,
+    0x00000062, 0x00000037, 0x000000a7, 0x00000039, 0x000000a5, 0x00000066, 0x00000000, 0x0000001e,
+    0x00000006, 0x000000b3, 0x00000032, 0x00000001, 0x00000000, 0x00000026, 0x0002011d, 0x00000113,
+    0x000000b1, 0x00000009, 0x00000056, 0x00000003, 0x00000001, 0x00000033, 0x0000035b, 0x00000089,
+    0x0000000c, 0x0000021c, 0x00000016, 0x00000280, 0x000100c9, 0x000002ff, 0x00000018, 0x00000055,
+    0x00000104, 0x00000033, 0x0000002d, 0x00000001, 0x00000231, 0x00020120, 0x00000212, 0x00000000,
+    0x00000092, 0x00000000, 0x00000008, 0x00000090, 0x00000010, 0x000100ca, 0x000300ce, 0x00000223,
+    0x00000012, 0x00000216, 0x00000109, 0x00000039, 0x000700f7, 0x00000004,
+};
+
+} // namespace EmojiShortcodeHash
+
+#endif // EMOJISHORTCODEHASH_H
@@ -0,0 +1,38 @@
+#ifndef EMOJISHORTCODES_H
+#define EMOJISHORTCODES_H
+
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+/**
+ * @brief 表情短代码（:smile:、:rocket:）到表情的映射
+ *
+ * 短代码由 EmojiTable 中的英文名称（小写、非字母数字替换为下划线，如 grinning_face）
+ * 与一组常用别名（smile、+1、thumbsup 等）组成，构成 CHD 最小完美哈希：查找只计算
+ * 一次哈希、探测一个位置、比较一次字符串，没有堆分配，可以在任意线程中调用。只依赖 QtCore。
+ *
+ * 各桶的位移由 scripts/generate_emoji_shortcode_hash.py 生成到 EmojiShortcodeHash.h；
+ * 编译期只按位移填充槽位并检查每个键落在自己的槽位上，表格改动后位移未重新生成会编译失败。
+ */
+namespace EmojiShortcodes {
+
+/**
+ * @brief 查找短代码（不含两侧冒号）
+ * @return UTF-8 编码的表情，不存在时返回 nullptr
+ */
+const char *lookup(QStringView code);
+
+/**
+ * @brief 把文本中所有已知的 :短代码: 替换为表情，未知的保持原样
+ */
+void expand(QString &text);
+
+/**
+ * @brief 全部短代码（不含冒号，按字母顺序），用于自动补全
+ */
+QStringList codes();
+
+} // namespace EmojiShortcodes
+
+#endif // EMOJISHORTCODES_H
@@ -0,0 +1,798 @@
+#ifndef EMOJITABLE_H
+#define EMOJITABLE_H
+
+#include <iterator>
+
+/**
+ * @brief 表情表及其中英文注释
+ *
+ * 名称参照 CLDR 短名称，关键词用空格分隔，供搜索索引使用。
+ * 表格按分类排列，下标在整个程序中用作表情的标识（图集单元、搜索结果）。
+ */
+namespace EmojiTable {
+
+struct Entry
+{
+    const char *glyph;
+    const char *name;        // 英文短名称（小写）
+    const char *keywords;    // 英文关键词
+    const char *nameZh;      // 中文短名称
+    const char *keywordsZh;  // 中文关键词
+};
+
+inline constexpr Entry kEntries[] = {
+    // Smileys & Emotion
+    {"😀", "grinning face", "face grin smile happy", "嘿嘿", "脸 笑 开心 咧嘴"},
+    {"😃", "grinning face with big eyes", "face smile happy mouth open", "哈哈", "脸 笑 开心 大眼"},
+    {"😄", "grinning face with smiling eyes", "face smile happy laugh", "大笑", "脸 笑 开心"},
+    {"😁", "beaming face with smiling eyes", "face grin smile teeth", "嘻嘻", "脸 笑 露齿"},
+    {"😆", "grinning squinting face", "face laugh satisfied haha", "斜眼笑", "脸 笑 满意"},
+    {"😅", "grinning face with sweat", "face smile sweat relief", "苦笑", "脸 笑 汗 尴尬"},
+    {"🤣", "rolling on the floor laughing", "face laugh rofl lol", "笑得满地打滚", "脸 笑 大笑"},
+    {"😂", "face with tears of joy", "face laugh tears joy lol", "笑哭了", "脸 笑 眼泪 开心"},
+    {"🙂", "slightly smiling face", "face smile", "微笑", "脸 笑"},
+    {"🙃", "upside-down face", "face upside down silly", "倒脸", "脸 颠倒 调皮"},
+    {"😉", "winking face", "face wink", "眨眼", "脸 眨眼 调皮"},
+    {"😊", "smiling face with smiling eyes", "face smile blush happy", "羞涩微笑", "脸 笑 害羞 开心"},
+    {"😇", "smiling face with halo", "face angel innocent halo", "微笑天使", "脸 天使 光环 无辜"},
+    {"🥰", "smiling face with hearts", "face love adore hearts", "喜笑颜开", "脸 爱 心 喜欢"},
+    {"😍", "smiling face with heart-eyes", "face love heart eyes", "花痴", "脸 爱 心 喜欢"},
+    {"🤩", "star-struck", "face star eyes excited", "好崇拜哦", "脸 星星 崇拜 兴奋"},
+    {"😘", "face blowing a kiss", "face kiss love", "飞吻", "脸 亲亲 爱"},
+    {"😗", "kissing face", "face kiss", "亲亲", "脸 亲吻"},
+    {"😚", "kissing face with closed eyes", "face kiss closed eyes", "羞涩亲亲", "脸 亲吻 闭眼"},
+    {"😙", "kissing face with smiling eyes", "face kiss smile", "微笑亲亲", "脸 亲吻 笑"},
+    {"😋", "face savoring food", "face yum delicious tongue", "好吃", "脸 美味 舌头 馋"},
+    {"😛", "face with tongue", "face tongue", "吐舌", "脸 舌头"},
+    {"😜", "winking face with tongue", "face tongue wink joke", "单眼吐舌", "脸 舌头 眨眼 调皮"},
+    {"🤪", "zany face", "face crazy goofy", "滑稽", "脸 疯狂 搞怪"},
+    {"😝", "squinting face with tongue", "face tongue horrible taste", "眯眼吐舌", "脸 舌头 眯眼"},
+    {"🤑", "money-mouth face", "face money rich dollar", "发财", "脸 钱 有钱"},
+    {"🤗", "hugging face", "face hug", "抱抱", "脸 拥抱"},
+    {"🤭", "face with hand over mouth", "face oops giggle", "不说", "脸 捂嘴 偷笑"},
+    {"🤫", "shushing face", "face quiet shush secret", "安静的脸", "脸 嘘 安静 秘密"},
+    {"🤔", "thinking face", "face think hmm", "想一想", "脸 思考 疑问"},
+    {"🤐", "zipper-mouth face", "face zip quiet secret", "闭嘴", "脸 拉链 沉默"},
+    {"🤨", "face with raised eyebrow", "face skeptic doubt", "挑眉", "脸 怀疑 质疑"},
+    {"😐", "neutral face", "face meh blank", "冷漠", "脸 面无表情 无语"},
+    {"😑", "expressionless face", "face blank meh", "无语", "脸 面无表情"},
+    {"😶", "face without mouth", "face silent quiet", "沉默", "脸 无嘴 安静"},
+    {"😏", "smirking face", "face smirk smug", "得意", "脸 坏笑 得意"},
+    {"😒", "unamused face", "face unhappy meh", "不高兴", "脸 不爽 不满"},
+    {"🙄", "face with rolling eyes", "face eyeroll whatever", "翻白眼", "脸 白眼 无奈"},
+    {"😬", "grimacing face", "face grimace awkward", "龇牙咧嘴", "脸 尴尬 紧张"},
+    {"🤥", "lying face", "face liar pinocchio", "说谎", "脸 撒谎 鼻子"},
+    {"😌", "relieved face", "face relieved calm", "松了口气", "脸 放松 平静"},
+    {"😔", "pensive face", "face sad pensive dejected", "沉思", "脸 伤心 失落"},
+    {"😪", "sleepy face", "face sleepy tired", "困", "脸 瞌睡 累"},
+    {"🤤", "drooling face", "face drool hungry", "流口水", "脸 口水 馋"},
+    {"😴", "sleeping face", "face sleep zzz", "睡着了", "脸 睡觉 困"},
+    {"😷", "face with medical mask", "face mask sick doctor", "感冒", "脸 口罩 生病"},
+    {"🤒", "face with thermometer", "face sick ill fever", "发烧", "脸 温度计 生病"},
+    {"🤕", "face with head-bandage", "face hurt injury bandage", "受伤", "脸 绷带 受伤"},
+    {"🤢", "nauseated face", "face sick nausea green", "恶心", "脸 想吐 反胃"},
+    {"🤮", "face vomiting", "face sick vomit puke", "呕吐", "脸 吐 生病"},
+    {"🤧", "sneezing face", "face sneeze sick tissue", "打喷嚏", "脸 喷嚏 感冒"},
+    {"🥵", "hot face", "face hot sweat heat", "脸发烧", "脸 热 出汗 高温"},
+    {"🥶", "cold face", "face cold freezing ice", "冷脸", "脸 冷 冻僵 寒冷"},
+    {"😶‍🌫️", "face in clouds", "face fog clouds absent", "迷糊", "脸 云 雾 恍惚"},
+    {"🥴", "woozy face", "face dizzy drunk tipsy", "头昏眼花", "脸 醉 晕"},
+    {"😵", "face with crossed-out eyes", "face dizzy dead knocked out", "晕头转向", "脸 晕 头晕"},
+    {"🤯", "exploding head", "face mind blown shocked", "爆炸头", "脸 震惊 炸裂"},
+    {"🤠", "cowboy hat face", "face cowboy hat", "牛仔帽脸", "脸 牛仔 帽子"},
+    {"🥳", "partying face", "face party celebration birthday", "聚会笑脸", "脸 派对 庆祝 生日"},
+    {"😎", "smiling face with sunglasses", "face cool sunglasses", "墨镜笑脸", "脸 酷 墨镜"},
+    {"🤓", "nerd face", "face nerd geek glasses", "书呆子脸", "脸 书呆子 眼镜"},
+    {"🧐", "face with monocle", "face monocle stuffy", "带单片眼镜的脸", "脸 眼镜 审视"},
+    {"😕", "confused face", "face confused", "困扰", "脸 困惑 疑惑"},
+    {"😟", "worried face", "face worried", "担心", "脸 担忧"},
+    {"🙁", "slightly frowning face", "face frown sad", "微微不满", "脸 皱眉 难过"},
+    {"☹️", "frowning face", "face frown sad", "不满", "脸 皱眉 难过"},
+    {"😮", "face with open mouth", "face surprise wow", "吃惊", "脸 张嘴 惊讶"},
+    {"😯", "hushed face", "face surprised stunned", "缄默", "脸 惊讶 安静"},
+    {"😲", "astonished face", "face shocked astonished", "震惊", "脸 惊讶 吃惊"},
+    {"😳", "flushed face", "face flushed embarrassed", "脸红", "脸 脸红 害羞 尴尬"},
+    {"🥺", "pleading face", "face puppy eyes begging", "恳求的脸", "脸 可怜 求求"},
+    {"😦", "frowning face with open mouth", "face frown surprise", "张嘴皱眉", "脸 皱眉 惊讶"},
+    {"😧", "anguished face", "face anguish", "极度痛苦", "脸 痛苦"},
+    {"😨", "fearful face", "face scared fear", "害怕", "脸 害怕 恐惧"},
+    {"😰", "anxious face with sweat", "face nervous cold sweat", "冷汗", "脸 焦虑 冷汗"},
+    {"😥", "sad but relieved face", "face disappointed relieved", "失望但如释重负", "脸 失望 放松"},
+    {"😢", "crying face", "face cry sad tear", "哭", "脸 哭 伤心 眼泪"},
+    {"😭", "loudly crying face", "face cry sob tears", "放声大哭", "脸 哭 大哭 眼泪"},
+    {"😱", "face screaming in fear", "face scream scared horror", "吓死了", "脸 尖叫 恐惧"},
+    {"😖", "confounded face", "face confounded", "困惑", "脸 纠结 困惑"},
+    {"😣", "persevering face", "face persevere struggle", "痛苦", "脸 坚持 挣扎"},
+    {"😞", "disappointed face", "face disappointed sad", "失望", "脸 失望 难过"},
+    {"😓", "downcast face with sweat", "face sweat cold", "汗", "脸 冷汗 沮丧"},
+    {"😩", "weary face", "face tired weary", "累死了", "脸 疲惫 厌倦"},
+    {"😫", "tired face", "face tired exhausted", "累", "脸 疲惫 累"},
+    {"🥱", "yawning face", "face yawn bored tired", "打呵欠", "脸 哈欠 无聊 困"},
+    {"😤", "face with steam from nose", "face triumph angry huff", "傲慢", "脸 生气 哼"},
+    {"😡", "enraged face", "face angry rage red", "怒火中烧", "脸 愤怒 生气"},
+    {"😠", "angry face", "face angry mad", "生气", "脸 生气 愤怒"},
+    {"🤬", "face with symbols on mouth", "face swearing cursing angry", "嘴上有符号的脸", "脸 骂人 愤怒"},
+    {"😈", "smiling face with horns", "face devil horns evil", "恶魔微笑", "脸 恶魔 邪恶"},
+    {"👿", "angry face with horns", "face devil imp angry", "生气的恶魔", "脸 恶魔 小鬼 生气"},
+    {"💀", "skull", "death dead skeleton", "头骨", "骷髅 死亡"},
+    {"☠️", "skull and crossbones", "death danger pirate poison", "骷髅", "骷髅 危险 海盗 死亡"},
+    {"💩", "pile of poo", "poop shit dung", "大便", "便便 屎 粑粑"},
+    {"🤡", "clown face", "face clown joker", "小丑脸", "脸 小丑"},
+
+    // Gestures & Body Parts
+    {"👋", "waving hand", "hand wave hello bye", "挥手", "手 你好 再见"},
+    {"🤚", "raised back of hand", "hand raised backhand", "立起的手背", "手 手背 举手"},
+    {"🖐️", "hand with fingers splayed", "hand fingers splayed five", "手掌", "手 五指 张开"},
+    {"✋", "raised hand", "hand high five stop", "举起手", "手 举手 击掌 停"},
+    {"🖖", "vulcan salute", "hand spock vulcan", "瓦肯举手礼", "手 瓦肯 星际迷航"},
+    {"👌", "ok hand", "hand ok perfect", "OK", "手 好的 完美"},
+    {"🤏", "pinching hand", "hand small little pinch", "捏合的手势", "手 一点点 小"},
+    {"✌️", "victory hand", "hand victory peace v", "胜利手势", "手 胜利 耶 和平"},
+    {"🤞", "crossed fingers", "hand luck fingers crossed", "交叉的手指", "手 好运 祈祷"},
+    {"🤟", "love-you gesture", "hand love you ily", "爱你的手势", "手 爱你"},
+    {"🤘", "sign of the horns", "hand rock horns metal", "摇滚", "手 摇滚 金属"},
+    {"🤙", "call me hand", "hand call shaka", "给我打电话", "手 打电话 联系"},
+    {"👈", "backhand index pointing left", "hand point left", "反手食指向左指", "手 左 指向"},
+    {"👉", "backhand index pointing right", "hand point right", "反手食指向右指", "手 右 指向"},
+    {"👆", "backhand index pointing up", "hand point up", "反手食指向上指", "手 上 指向"},
+    {"🖕", "middle finger", "hand finger rude", "竖中指", "手 中指 粗鲁"},
+    {"👇", "backhand index pointing down", "hand point down", "反手食指向下指", "手 下 指向"},
+    {"☝️", "index pointing up", "hand point up one", "食指向上指", "手 上 指向 一"},
+    {"👍", "thumbs up", "hand thumbs up like yes good +1", "拇指向上", "手 赞 点赞 好 同意"},
+    {"👎", "thumbs down", "hand thumbs down dislike no bad -1", "拇指向下", "手 踩 不好 反对"},
+    {"✊", "raised fist", "hand fist punch", "举起拳头", "手 拳头 力量"},
+    {"👊", "oncoming fist", "hand fist punch bump", "出拳", "手 拳头 碰拳"},
+    {"🤛", "left-facing fist", "hand fist left", "朝左的拳头", "手 拳头 左"},
+    {"🤜", "right-facing fist", "hand fist right", "朝右的拳头", "手 拳头 右"},
+    {"👏", "clapping hands", "hand clap applause", "鼓掌", "手 拍手 掌声 鼓掌"},
+    {"🙌", "raising hands", "hand hooray celebration", "举双手", "手 欢呼 庆祝"},
+    {"👐", "open hands", "hand open", "张开双手", "手 张开"},
+    {"🤲", "palms up together", "hand prayer cupped", "掌心向上托起", "手 掌心 捧"},
+    {"🤝", "handshake", "hand agreement deal meeting", "握手", "手 握手 合作 协议"},
+    {"🙏", "folded hands", "hand pray please thanks", "双手合十", "手 祈祷 拜托 谢谢"},
+    {"✍️", "writing hand", "hand write", "写字", "手 写字 书写"},
+    {"💅", "nail polish", "nails manicure beauty", "涂指甲", "指甲 美甲 化妆"},
+    {"🤳", "selfie", "phone camera selfie", "自拍", "自拍 手机 相机"},
+    {"💪", "flexed biceps", "arm strong muscle", "肌肉", "手臂 强壮 肌肉 力量"},
+    {"🦾", "mechanical arm", "arm prosthetic robot", "机械手臂", "手臂 假肢 机械"},
+    {"🦿", "mechanical leg", "leg prosthetic robot", "机械腿", "腿 假肢 机械"},
+    {"🦵", "leg", "leg kick limb", "腿", "腿 踢"},
+    {"🦶", "foot", "foot kick stomp", "脚", "脚 踢 跺"},
+    {"👂", "ear", "ear hear listen body", "耳朵", "耳朵 听 身体"},
+    {"🦻", "ear with hearing aid", "ear hearing aid deaf", "戴助听器的耳朵", "耳朵 助听器"},
+    {"👃", "nose", "nose smell body", "鼻子", "鼻子 闻 身体"},
+    {"🧠", "brain", "brain smart intelligent", "脑", "大脑 聪明 智慧"},
+    {"🦷", "tooth", "tooth dentist teeth", "牙齿", "牙齿 牙医"},
+    {"🦴", "bone", "bone skeleton", "骨头", "骨头 骨骼"},
+    {"👀", "eyes", "eyes look see watch", "双眼", "眼睛 看 观察"},
+    {"👁️", "eye", "eye look see body", "眼睛", "眼睛 看"},
+    {"👅", "tongue", "tongue body lick", "舌头", "舌头 舔"},
+    {"👄", "mouth", "mouth lips kiss", "嘴", "嘴 嘴唇"},
+
+    // Animals & Nature
+    {"🐶", "dog face", "animal dog puppy pet", "狗脸", "动物 狗 小狗 宠物"},
+    {"🐱", "cat face", "animal cat kitten pet", "猫脸", "动物 猫 小猫 宠物"},
+    {"🐭", "mouse face", "animal mouse", "老鼠头", "动物 老鼠"},
+    {"🐹", "hamster", "animal hamster pet", "仓鼠", "动物 仓鼠 宠物"},
+    {"🐰", "rabbit face", "animal rabbit bunny", "兔子头", "动物 兔子"},
+    {"🦊", "fox", "animal fox", "狐狸", "动物 狐狸"},
+    {"🐻", "bear", "animal bear", "熊", "动物 熊"},
+    {"🐼", "panda", "animal panda", "熊猫", "动物 熊猫 国宝"},
+    {"🐨", "koala", "animal koala", "考拉", "动物 考拉 树袋熊"},
+    {"🐯", "tiger face", "animal tiger", "老虎头", "动物 老虎"},
+    {"🦁", "lion", "animal lion", "狮子", "动物 狮子"},
+    {"🐮", "cow face", "animal cow", "奶牛头", "动物 牛 奶牛"},
+    {"🐷", "pig face", "animal pig", "猪头", "动物 猪"},
+    {"🐽", "pig nose", "animal pig nose snout", "猪鼻子", "动物 猪 鼻子"},
+    {"🐸", "frog", "animal frog", "青蛙", "动物 青蛙"},
+    {"🐵", "monkey face", "animal monkey", "猴头", "动物 猴子"},
+    {"🙈", "see-no-evil monkey", "monkey see no evil shy", "非礼勿视", "猴子 捂眼 害羞"},
+    {"🙉", "hear-no-evil monkey", "monkey hear no evil", "非礼勿听", "猴子 捂耳"},
+    {"🙊", "speak-no-evil monkey", "monkey speak no evil oops", "非礼勿言", "猴子 捂嘴"},
+    {"🐒", "monkey", "animal monkey", "猴子", "动物 猴子"},
+    {"🐔", "chicken", "animal chicken bird", "鸡", "动物 鸡 鸟"},
+    {"🐧", "penguin", "animal penguin bird", "企鹅", "动物 企鹅 鸟"},
+    {"🐦", "bird", "animal bird", "鸟", "动物 鸟"},
+    {"🐤", "baby chick", "animal chick bird", "小鸡", "动物 小鸡 鸟"},
+    {"🐣", "hatching chick", "animal chick egg hatch", "小鸡破壳", "动物 小鸡 蛋 破壳"},
+    {"🐥", "front-facing baby chick", "animal chick bird", "正面朝向的小鸡", "动物 小鸡 鸟"},
+    {"🦆", "duck", "animal duck bird", "鸭子", "动物 鸭子 鸟"},
+    {"🦅", "eagle", "animal eagle bird", "鹰", "动物 鹰 鸟"},
+    {"🦉", "owl", "animal owl bird wise", "猫头鹰", "动物 猫头鹰 鸟"},
+    {"🦇", "bat", "animal bat vampire", "蝙蝠", "动物 蝙蝠 吸血鬼"},
+    {"🐺", "wolf", "animal wolf", "狼", "动物 狼"},
+    {"🐗", "boar", "animal boar pig", "野猪", "动物 野猪 猪"},
+    {"🐴", "horse face", "animal horse", "马头", "动物 马"},
+    {"🦄", "unicorn", "animal unicorn fantasy", "独角兽", "动物 独角兽 幻想"},
+    {"🐝", "honeybee", "animal bee insect honey", "蜜蜂", "动物 蜜蜂 昆虫 蜂蜜"},
+    {"🐛", "bug", "animal bug insect caterpillar", "毛毛虫", "动物 虫子 昆虫 臭虫"},
+    {"🦋", "butterfly", "animal butterfly insect pretty", "蝴蝶", "动物 蝴蝶 昆虫"},
+    {"🐌", "snail", "animal snail slow", "蜗牛", "动物 蜗牛 慢"},
+    {"🐞", "lady beetle", "animal ladybug beetle insect", "瓢虫", "动物 瓢虫 昆虫"},
+    {"🐜", "ant", "animal ant insect", "蚂蚁", "动物 蚂蚁 昆虫"},
+    {"🦟", "mosquito", "animal mosquito insect", "蚊子", "动物 蚊子 昆虫"},
+    {"🦗", "cricket", "animal cricket insect grasshopper", "蟋蟀", "动物 蟋蟀 昆虫"},
+    {"🕷️", "spider", "animal spider insect", "蜘蛛", "动物 蜘蛛"},
+    {"🕸️", "spider web", "spider web", "蜘蛛网", "蜘蛛 网"},
+    {"🦂", "scorpion", "animal scorpion", "蝎子", "动物 蝎子"},
+    {"🐢", "turtle", "animal turtle tortoise slow", "乌龟", "动物 乌龟 慢"},
+    {"🐍", "snake", "animal snake serpent", "蛇", "动物 蛇"},
+    {"🦎", "lizard", "animal lizard reptile", "蜥蜴", "动物 蜥蜴 爬行动物"},
+    {"🦖", "t-rex", "animal dinosaur tyrannosaurus", "霸王龙", "动物 恐龙 霸王龙"},
+    {"🦕", "sauropod", "animal dinosaur brontosaurus", "蜥脚类恐龙", "动物 恐龙"},
+    {"🐙", "octopus", "animal octopus sea", "章鱼", "动物 章鱼 海洋"},
+    {"🦑", "squid", "animal squid sea", "乌贼", "动物 乌贼 鱿鱼 海洋"},
+    {"🦐", "shrimp", "animal shrimp sea food", "虾", "动物 虾 海鲜"},
+    {"🦞", "lobster", "animal lobster sea food", "龙虾", "动物 龙虾 海鲜"},
+    {"🦀", "crab", "animal crab sea", "蟹", "动物 螃蟹 海鲜"},
+    {"🐡", "blowfish", "animal fish blowfish puffer", "河豚", "动物 鱼 河豚"},
+    {"🐠", "tropical fish", "animal fish tropical", "热带鱼", "动物 鱼 热带鱼"},
+    {"🐟", "fish", "animal fish", "鱼", "动物 鱼"},
+    {"🐬", "dolphin", "animal dolphin sea", "海豚", "动物 海豚 海洋"},
+    {"🐳", "spouting whale", "animal whale sea", "喷水的鲸", "动物 鲸鱼 海洋"},
+    {"🐋", "whale", "animal whale sea", "鲸鱼", "动物 鲸鱼 海洋"},
+    {"🦈", "shark", "animal shark sea", "鲨鱼", "动物 鲨鱼 海洋"},
+    {"🐊", "crocodile", "animal crocodile", "鳄鱼", "动物 鳄鱼"},
+    {"🐅", "tiger", "animal tiger", "老虎", "动物 老虎"},
+    {"🐆", "leopard", "animal leopard", "豹子", "动物 豹子"},
+    {"🦓", "zebra", "animal zebra stripes", "斑马", "动物 斑马"},
+    {"🦍", "gorilla", "animal gorilla ape", "大猩猩", "动物 大猩猩"},
+    {"🦧", "orangutan", "animal orangutan ape", "红毛猩猩", "动物 猩猩"},
+    {"🐘", "elephant", "animal elephant", "大象", "动物 大象"},
+    {"🦛", "hippopotamus", "animal hippo", "河马", "动物 河马"},
+    {"🦏", "rhinoceros", "animal rhino", "犀牛", "动物 犀牛"},
+    {"🐪", "camel", "animal camel dromedary desert", "骆驼", "动物 骆驼 沙漠"},
+    {"🐫", "two-hump camel", "animal camel bactrian desert", "双峰骆驼", "动物 骆驼 沙漠"},
+    {"🦒", "giraffe", "animal giraffe", "长颈鹿", "动物 长颈鹿"},
+    {"🦘", "kangaroo", "animal kangaroo australia", "袋鼠", "动物 袋鼠 澳大利亚"},
+    {"🐃", "water buffalo", "animal buffalo", "水牛", "动物 水牛 牛"},
+    {"🐂", "ox", "animal ox bull", "公牛", "动物 公牛 牛"},
+    {"🐄", "cow", "animal cow", "奶牛", "动物 奶牛 牛"},
+    {"🐎", "horse", "animal horse racing", "马", "动物 马 赛马"},
+    {"🐖", "pig", "animal pig", "猪", "动物 猪"},
+    {"🐏", "ram", "animal ram sheep", "公羊", "动物 公羊 羊"},
+    {"🐑", "ewe", "animal sheep lamb", "母羊", "动物 羊 绵羊"},
+    {"🦙", "llama", "animal llama alpaca", "美洲鸵", "动物 羊驼 草泥马"},
+    {"🐐", "goat", "animal goat", "山羊", "动物 山羊 羊"},
+    {"🦌", "deer", "animal deer", "鹿", "动物 鹿"},
+    {"🐕", "dog", "animal dog pet", "狗", "动物 狗 宠物"},
+    {"🐩", "poodle", "animal dog poodle", "贵宾犬", "动物 狗 贵宾犬"},
+    {"🦮", "guide dog", "animal dog guide blind", "导盲犬", "动物 狗 导盲"},
+    {"🐕‍🦺", "service dog", "animal dog service", "服务犬", "动物 狗 服务"},
+    {"🐈", "cat", "animal cat pet", "猫", "动物 猫 宠物"},
+    {"🐈‍⬛", "black cat", "animal cat black unlucky", "黑猫", "动物 猫 黑色"},
+    {"🐓", "rooster", "animal rooster chicken", "公鸡", "动物 公鸡 鸡"},
+    {"🦃", "turkey", "animal turkey bird thanksgiving", "火鸡", "动物 火鸡 鸟 感恩节"},
+    {"🦚", "peacock", "animal peacock bird", "孔雀", "动物 孔雀 鸟"},
+    {"🦜", "parrot", "animal parrot bird", "鹦鹉", "动物 鹦鹉 鸟"},
+    {"🦢", "swan", "animal swan bird", "天鹅", "动物 天鹅 鸟"},
+
+    // Food & Drink
+    {"🍏", "green apple", "fruit apple green", "青苹果", "水果 苹果 绿色"},
+    {"🍎", "red apple", "fruit apple red", "红苹果", "水果 苹果 红色"},
+    {"🍐", "pear", "fruit pear", "梨", "水果 梨"},
+    {"🍊", "tangerine", "fruit orange tangerine", "橘子", "水果 橘子 橙子"},
+    {"🍋", "lemon", "fruit lemon citrus", "柠檬", "水果 柠檬"},
+    {"🍌", "banana", "fruit banana", "香蕉", "水果 香蕉"},
+    {"🍉", "watermelon", "fruit watermelon summer", "西瓜", "水果 西瓜 夏天"},
+    {"🍇", "grapes", "fruit grapes", "葡萄", "水果 葡萄"},
+    {"🍓", "strawberry", "fruit strawberry berry", "草莓", "水果 草莓"},
+    {"🍈", "melon", "fruit melon", "甜瓜", "水果 甜瓜 哈密瓜"},
+    {"🍒", "cherries", "fruit cherry", "樱桃", "水果 樱桃"},
+    {"🍑", "peach", "fruit peach", "桃", "水果 桃子"},
+    {"🥭", "mango", "fruit mango tropical", "芒果", "水果 芒果 热带"},
+    {"🍍", "pineapple", "fruit pineapple", "菠萝", "水果 菠萝"},
+    {"🥥", "coconut", "fruit coconut", "椰子", "水果 椰子"},
+    {"🥝", "kiwi fruit", "fruit kiwi", "猕猴桃", "水果 猕猴桃 奇异果"},
+    {"🍅", "tomato", "vegetable fruit tomato", "西红柿", "蔬菜 西红柿 番茄"},
+    {"🍆", "eggplant", "vegetable eggplant aubergine", "茄子", "蔬菜 茄子"},
+    {"🥑", "avocado", "fruit avocado", "鳄梨", "水果 牛油果 鳄梨"},
+    {"🥦", "broccoli", "vegetable broccoli", "西兰花", "蔬菜 西兰花"},
+    {"🥬", "leafy green", "vegetable lettuce cabbage greens", "绿叶蔬菜", "蔬菜 青菜 白菜 生菜"},
+    {"🥒", "cucumber", "vegetable cucumber pickle", "黄瓜", "蔬菜 黄瓜"},
+    {"🌶️", "hot pepper", "vegetable chili pepper spicy hot", "红辣椒", "蔬菜 辣椒 辣"},
+    {"🌽", "ear of corn", "vegetable corn maize", "玉米", "蔬菜 玉米"},
+    {"🥕", "carrot", "vegetable carrot", "胡萝卜", "蔬菜 胡萝卜"},
+    {"🧄", "garlic", "vegetable garlic", "蒜", "蔬菜 大蒜 调料"},
+    {"🧅", "onion", "vegetable onion", "洋葱", "蔬菜 洋葱"},
+    {"🥔", "potato", "vegetable potato", "土豆", "蔬菜 土豆 马铃薯"},
+    {"🍠", "roasted sweet potato", "food sweet potato roasted", "烤红薯", "食物 红薯 地瓜"},
+    {"🥐", "croissant", "food bread croissant french", "羊角面包", "食物 面包 牛角包"},
+    {"🥯", "bagel", "food bread bagel", "面包圈", "食物 面包 贝果"},
+    {"🍞", "bread", "food bread loaf", "面包", "食物 面包 吐司"},
+    {"🥖", "baguette bread", "food bread baguette french", "法式长棍面包", "食物 面包 法棍"},
+    {"🥨", "pretzel", "food pretzel", "椒盐卷饼", "食物 卷饼"},
+    {"🧀", "cheese wedge", "food cheese", "芝士", "食物 奶酪 芝士"},
+    {"🥚", "egg", "food egg breakfast", "蛋", "食物 鸡蛋 早餐"},
+    {"🍳", "cooking", "food egg frying pan breakfast", "做饭", "食物 煎蛋 平底锅 早餐"},
+    {"🧈", "butter", "food butter dairy", "黄油", "食物 黄油"},
+    {"🥞", "pancakes", "food pancakes breakfast", "烙饼", "食物 煎饼 早餐"},
+    {"🧇", "waffle", "food waffle breakfast", "华夫饼", "食物 华夫饼 早餐"},
+    {"🥓", "bacon", "food bacon meat breakfast", "培根", "食物 培根 肉 早餐"},
+    {"🥩", "cut of meat", "food meat steak", "肉块", "食物 肉 牛排"},
+    {"🍗", "poultry leg", "food chicken drumstick", "家禽的腿", "食物 鸡腿 肉"},
+    {"🍖", "meat on bone", "food meat bone", "排骨", "食物 肉 骨头"},
+    {"🦴", "bone", "bone dog food", "骨头", "骨头 狗 食物"},
+    {"🌭", "hot dog", "food hotdog sausage", "热狗", "食物 热狗 香肠"},
+    {"🍔", "hamburger", "food burger", "汉堡", "食物 汉堡"},
+    {"🍟", "french fries", "food fries chips", "薯条", "食物 薯条"},
+    {"🍕", "pizza", "food pizza slice", "披萨", "食物 比萨 披萨"},
+    {"🥪", "sandwich", "food sandwich bread", "三明治", "食物 三明治"},
+    {"🥙", "stuffed flatbread", "food kebab gyro flatbread", "夹心饼", "食物 卷饼 烤肉"},
+    {"🧆", "falafel", "food falafel", "炸豆丸子", "食物 炸豆丸子"},
+    {"🌮", "taco", "food taco mexican", "墨西哥卷饼", "食物 塔可 墨西哥"},
+    {"🌯", "burrito", "food burrito mexican wrap", "墨西哥玉米煎饼", "食物 卷饼 墨西哥"},
+    {"🥗", "green salad", "food salad healthy", "绿色沙拉", "食物 沙拉 健康"},
+    {"🥘", "shallow pan of food", "food paella pan", "装有食物的浅底锅", "食物 锅 海鲜饭"},
+    {"🍝", "spaghetti", "food pasta spaghetti noodles", "意大利面", "食物 意面 面条"},
+    {"🍜", "steaming bowl", "food noodles ramen soup", "面条", "食物 面条 拉面 汤"},
+    {"🍲", "pot of food", "food stew pot hotpot", "一锅食物", "食物 炖菜 火锅"},
+    {"🍛", "curry rice", "food curry rice", "咖喱饭", "食物 咖喱 米饭"},
+    {"🍣", "sushi", "food sushi japanese", "寿司", "食物 寿司 日本"},
+    {"🍱", "bento box", "food bento lunch box japanese", "便当", "食物 便当 午餐 盒饭"},
+    {"🥟", "dumpling", "food dumpling jiaozi", "饺子", "食物 饺子 包子"},
+    {"🦪", "oyster", "food oyster shellfish", "牡蛎", "食物 生蚝 牡蛎 海鲜"},
+    {"🍤", "fried shrimp", "food shrimp tempura fried", "天妇罗", "食物 炸虾 虾"},
+    {"🍙", "rice ball", "food rice onigiri japanese", "饭团", "食物 饭团 米饭"},
+    {"🍚", "cooked rice", "food rice bowl", "米饭", "食物 米饭 饭"},
+    {"🍘", "rice cracker", "food rice cracker", "米饼", "食物 米饼 饼干"},
+    {"🍥", "fish cake with swirl", "food fish cake narutomaki", "鱼板", "食物 鱼板 鱼糕"},
+    {"🥠", "fortune cookie", "food fortune cookie prophecy", "幸运饼干", "食物 幸运饼干"},
+    {"🥮", "moon cake", "food mooncake festival autumn", "月饼", "食物 月饼 中秋"},
+    {"🍢", "oden", "food oden skewer", "关东煮", "食物 关东煮 串"},
+    {"🍡", "dango", "food dango sweet skewer", "团子", "食物 团子 甜点"},
+    {"🍧", "shaved ice", "food dessert shaved ice", "刨冰", "甜点 刨冰 冰"},
+    {"🍨", "ice cream", "food dessert ice cream", "冰淇淋", "甜点 冰淇淋"},
+    {"🍦", "soft ice cream", "food dessert ice cream soft serve", "圆筒冰激凌", "甜点 冰淇淋 甜筒"},
+    {"🥧", "pie", "food dessert pie", "派", "甜点 派 馅饼"},
+    {"🧁", "cupcake", "food dessert cupcake", "纸杯蛋糕", "甜点 蛋糕 纸杯蛋糕"},
+    {"🍰", "shortcake", "food dessert cake slice", "水果蛋糕", "甜点 蛋糕"},
+    {"🎂", "birthday cake", "food dessert cake birthday celebration", "生日蛋糕", "甜点 蛋糕 生日 庆祝"},
+    {"🍮", "custard", "food dessert pudding custard", "奶黄", "甜点 布丁"},
+    {"🍭", "lollipop", "food candy sweet lollipop", "棒棒糖", "糖果 棒棒糖 甜"},
+    {"🍬", "candy", "food candy sweet", "糖", "糖果 甜"},
+    {"🍫", "chocolate bar", "food chocolate sweet", "巧克力", "糖果 巧克力 甜"},
+    {"🍿", "popcorn", "food popcorn movie snack", "爆米花", "零食 爆米花 电影"},
+    {"🍩", "doughnut", "food donut sweet", "甜甜圈", "甜点 甜甜圈"},
+    {"🍪", "cookie", "food cookie biscuit", "饼干", "甜点 饼干 曲奇"},
+    {"🌰", "chestnut", "food chestnut nut", "栗子", "食物 栗子 坚果"},
+    {"🥜", "peanuts", "food peanut nut", "花生", "食物 花生 坚果"},
+    {"🍯", "honey pot", "food honey sweet", "蜂蜜", "食物 蜂蜜 甜"},
+    {"🥛", "glass of milk", "drink milk", "一杯奶", "饮料 牛奶"},
+    {"🍼", "baby bottle", "drink milk baby bottle", "奶瓶", "饮料 奶瓶 婴儿"},
+    {"☕", "hot beverage", "drink coffee tea hot", "热饮", "饮料 咖啡 茶 热"},
+    {"🍵", "teacup without handle", "drink tea green tea", "热茶", "饮料 茶 绿茶"},
+    {"🧃", "beverage box", "drink juice box", "饮料盒", "饮料 果汁"},
+    {"🥤", "cup with straw", "drink soda juice straw", "带吸管杯", "饮料 汽水 吸管"},
+    {"🍶", "sake", "drink sake bottle cup japanese", "清酒", "饮料 清酒 酒"},
+    {"🍺", "beer mug", "drink beer alcohol", "啤酒", "饮料 啤酒 酒"},
+    {"🍻", "clinking beer mugs", "drink beer cheers alcohol", "干杯", "饮料 啤酒 干杯 酒"},
+    {"🥂", "clinking glasses", "drink champagne cheers celebration", "碰杯", "饮料 香槟 干杯 庆祝"},
+    {"🍷", "wine glass", "drink wine alcohol", "葡萄酒", "饮料 红酒 葡萄酒 酒"},
+    {"🥃", "tumbler glass", "drink whisky liquor", "平底杯", "饮料 威士忌 酒"},
+    {"🍸", "cocktail glass", "drink cocktail martini", "鸡尾酒", "饮料 鸡尾酒 酒"},
+    {"🍹", "tropical drink", "drink tropical cocktail", "热带水果饮料", "饮料 热带 鸡尾酒"},
+    {"🧉", "mate", "drink mate tea", "马黛茶", "饮料 马黛茶 茶"},
+    {"🍾", "bottle with popping cork", "drink champagne celebration party", "开香槟", "饮料 香槟 庆祝 派对"},
+    {"🧊", "ice", "ice cube cold", "冰块", "冰 冰块 冷"},
+    {"🥄", "spoon", "spoon cutlery", "勺子", "餐具 勺子"},
+    {"🍴", "fork and knife", "cutlery fork knife", "刀叉", "餐具 刀叉"},
+    {"🍽️", "fork and knife with plate", "cutlery plate dinner", "餐具", "餐具 盘子 晚餐"},
+    {"🥣", "bowl with spoon", "bowl cereal breakfast", "碗勺", "碗 勺子 早餐 麦片"},
+    {"🥡", "takeout box", "takeout box food delivery", "外卖盒", "外卖 盒子 食物"},
+
+    // Sports & Activities
+    {"⚽", "soccer ball", "sport soccer football ball", "足球", "运动 足球 球"},
+    {"🏀", "basketball", "sport basketball ball", "篮球", "运动 篮球 球"},
+    {"🏈", "american football", "sport football ball", "美式橄榄球", "运动 橄榄球 球"},
+    {"⚾", "baseball", "sport baseball ball", "棒球", "运动 棒球 球"},
+    {"🥎", "softball", "sport softball ball", "垒球", "运动 垒球 球"},
+    {"🎾", "tennis", "sport tennis ball", "网球", "运动 网球 球"},
+    {"🏐", "volleyball", "sport volleyball ball", "排球", "运动 排球 球"},
+    {"🏉", "rugby football", "sport rugby ball", "英式橄榄球", "运动 橄榄球 球"},
+    {"🥏", "flying disc", "sport frisbee disc", "飞盘", "运动 飞盘"},
+    {"🎱", "pool 8 ball", "game billiards pool eight ball", "台球", "游戏 台球 桌球"},
+    {"🪀", "yo-yo", "toy yoyo", "悠悠球", "玩具 溜溜球"},
+    {"🏓", "ping pong", "sport ping pong table tennis", "乒乓球", "运动 乒乓球 球"},
+    {"🏸", "badminton", "sport badminton", "羽毛球", "运动 羽毛球"},
+    {"🏒", "ice hockey", "sport hockey ice", "冰球", "运动 冰球"},
+    {"🏑", "field hockey", "sport hockey field", "曲棍球", "运动 曲棍球"},
+    {"🥍", "lacrosse", "sport lacrosse", "长曲棍球", "运动 长曲棍球"},
+    {"🏏", "cricket game", "sport cricket bat", "板球", "运动 板球"},
+    {"🥅", "goal net", "sport goal net", "球门", "运动 球门"},
+    {"⛳", "flag in hole", "sport golf flag", "高尔夫球洞", "运动 高尔夫"},
+    {"🪁", "kite", "toy kite fly", "风筝", "玩具 风筝"},
+    {"🏹", "bow and arrow", "sport archery bow arrow", "弓和箭", "运动 射箭 弓箭"},
+    {"🎣", "fishing pole", "sport fishing fish", "钓鱼竿", "运动 钓鱼"},
+    {"🤿", "diving mask", "sport diving scuba snorkel", "潜水面罩", "运动 潜水"},
+    {"🥊", "boxing glove", "sport boxing glove", "拳击手套", "运动 拳击"},
+    {"🥋", "martial arts uniform", "sport martial arts judo karate", "练武服", "运动 武术 柔道 空手道"},
+    {"🎽", "running shirt", "sport running shirt marathon", "跑步衫", "运动 跑步 马拉松"},
+    {"🛹", "skateboard", "sport skateboard", "滑板", "运动 滑板"},
+    {"🛷", "sled", "sport sled sledge winter", "雪橇", "运动 雪橇 冬天"},
+    {"⛸️", "ice skate", "sport skating ice", "滑冰", "运动 滑冰"},
+    {"🥌", "curling stone", "sport curling", "冰壶", "运动 冰壶"},
+    {"🎿", "skis", "sport ski snow", "滑雪", "运动 滑雪 雪"},
+    {"⛷️", "skier", "sport ski snow person", "滑雪的人", "运动 滑雪 雪"},
+    {"🏂", "snowboarder", "sport snowboard snow", "单板滑雪", "运动 单板滑雪 雪"},
+    {"🪂", "parachute", "sport parachute skydive", "降落伞", "运动 跳伞 降落伞"},
+    {"🏋️", "person lifting weights", "sport weight lifting gym", "举重的人", "运动 举重 健身"},
+    {"🤼", "people wrestling", "sport wrestling", "摔跤选手", "运动 摔跤"},
+    {"🤸", "person cartwheeling", "sport gymnastics cartwheel", "侧手翻", "运动 体操 侧手翻"},
+    {"🤺", "person fencing", "sport fencing sword", "击剑选手", "运动 击剑"},
+    {"⛹️", "person bouncing ball", "sport basketball ball", "运球", "运动 篮球 运球"},
+    {"🤾", "person playing handball", "sport handball", "手球", "运动 手球"},
+    {"🏌️", "person golfing", "sport golf", "打高尔夫的人", "运动 高尔夫"},
+    {"🏇", "horse racing", "sport horse racing jockey", "赛马", "运动 赛马 马"},
+    {"🧘", "person in lotus position", "sport yoga meditation", "盘腿的人", "运动 瑜伽 冥想"},
+    {"🏊", "person swimming", "sport swim swimming", "游泳者", "运动 游泳"},
+    {"🤽", "person playing water polo", "sport water polo", "水球", "运动 水球"},
+    {"🚣", "person rowing boat", "sport rowing boat", "划艇", "运动 划船"},
+    {"🧗", "person climbing", "sport climbing rock", "攀岩的人", "运动 攀岩"},
+    {"🚴", "person biking", "sport cycling bicycle", "骑自行车的人", "运动 骑行 自行车"},
+    {"🚵", "person mountain biking", "sport cycling mountain bike", "骑山地车的人", "运动 骑行 山地车"},
+    {"🤹", "person juggling", "juggle skill", "玩杂耍", "杂耍 技巧"},
+    {"🎪", "circus tent", "circus tent", "马戏团帐篷", "马戏团 帐篷"},
+    {"🎭", "performing arts", "art theater masks", "表演艺术", "艺术 戏剧 面具"},
+    {"🎨", "artist palette", "art painting palette", "调色盘", "艺术 绘画 调色板"},
+    {"🎬", "clapper board", "movie film clapper", "场记板", "电影 拍摄"},
+    {"🎤", "microphone", "music sing karaoke mic", "麦克风", "音乐 唱歌 卡拉OK 话筒"},
+    {"🎧", "headphone", "music headphones audio", "耳机", "音乐 耳机"},
+    {"🎼", "musical score", "music score notes", "乐谱", "音乐 乐谱"},
+    {"🎹", "musical keyboard", "music piano keyboard", "音乐键盘", "音乐 钢琴 键盘"},
+    {"🥁", "drum", "music drum", "鼓", "音乐 鼓"},
+    {"🎷", "saxophone", "music saxophone jazz", "萨克斯管", "音乐 萨克斯 爵士"},
+    {"🎺", "trumpet", "music trumpet", "小号", "音乐 小号"},
+    {"🎸", "guitar", "music guitar rock", "吉他", "音乐 吉他 摇滚"},
+    {"🪕", "banjo", "music banjo", "班卓琴", "音乐 班卓琴"},
+    {"🎻", "violin", "music violin", "小提琴", "音乐 小提琴"},
+    {"🎲", "game die", "game dice", "骰子", "游戏 骰子"},
+    {"♟️", "chess pawn", "game chess pawn", "兵", "游戏 国际象棋 棋"},
+    {"🎯", "direct hit", "game target bullseye dart", "正中靶心", "游戏 靶心 飞镖 目标"},
+    {"🎳", "bowling", "sport game bowling", "保龄球", "运动 保龄球"},
+    {"🎮", "video game", "game controller gaming", "游戏手柄", "游戏 手柄 电子游戏"},
+    {"🎰", "slot machine", "game gambling slot casino", "老虎机", "游戏 老虎机 赌博"},
+    {"🧩", "puzzle piece", "game jigsaw puzzle", "拼图", "游戏 拼图"},
+
+    // Travel & Places
+    {"🚗", "automobile", "car vehicle", "汽车", "交通 汽车 车"},
+    {"🚕", "taxi", "car taxi vehicle", "出租车", "交通 出租车 车"},
+    {"🚙", "sport utility vehicle", "car suv vehicle", "运动型多用途车", "交通 越野车 车"},
+    {"🚌", "bus", "bus vehicle", "公交车", "交通 公交 巴士"},
+    {"🚎", "trolleybus", "bus trolley vehicle", "无轨电车", "交通 电车 公交"},
+    {"🏎️", "racing car", "car racing fast", "赛车", "交通 赛车 车"},
+    {"🚓", "police car", "car police vehicle", "警车", "交通 警车 警察"},
+    {"🚑", "ambulance", "vehicle ambulance hospital", "救护车", "交通 救护车 医院"},
+    {"🚒", "fire engine", "vehicle fire truck", "消防车", "交通 消防车 火"},
+    {"🚐", "minibus", "vehicle minibus van", "小巴", "交通 小巴 面包车"},
+    {"🚚", "delivery truck", "vehicle truck delivery", "货车", "交通 货车 卡车 快递"},
+    {"🚛", "articulated lorry", "vehicle truck lorry", "铰接式货车", "交通 货车 卡车"},
+    {"🚜", "tractor", "vehicle tractor farm", "拖拉机", "交通 拖拉机 农场"},
+    {"🦯", "white cane", "cane blind accessibility", "盲杖", "盲人 拐杖 无障碍"},
+    {"🦽", "manual wheelchair", "wheelchair accessibility", "手动轮椅", "轮椅 无障碍"},
+    {"🦼", "motorized wheelchair", "wheelchair accessibility", "电动轮椅", "轮椅 无障碍"},
+    {"🛴", "kick scooter", "vehicle scooter kick", "滑板车", "交通 滑板车"},
+    {"🚲", "bicycle", "vehicle bicycle bike", "自行车", "交通 自行车 单车"},
+    {"🛵", "motor scooter", "vehicle scooter moped", "摩托车", "交通 电动车 摩托车"},
+    {"🏍️", "motorcycle", "vehicle motorcycle racing", "摩托", "交通 摩托车"},
+    {"🛺", "auto rickshaw", "vehicle rickshaw tuk tuk", "三轮摩托车", "交通 三轮车 嘟嘟车"},
+    {"🚨", "police car light", "police siren light emergency", "警车灯", "警察 警报 警灯 紧急"},
+    {"🚔", "oncoming police car", "car police vehicle", "迎面驶来的警车", "交通 警车 警察"},
+    {"🚍", "oncoming bus", "bus vehicle", "迎面驶来的公交车", "交通 公交 巴士"},
+    {"🚘", "oncoming automobile", "car vehicle", "迎面驶来的汽车", "交通 汽车 车"},
+    {"🚖", "oncoming taxi", "car taxi vehicle", "迎面驶来的出租车", "交通 出租车"},
+    {"🚡", "aerial tramway", "cable car tramway", "空中缆车", "交通 缆车"},
+    {"🚠", "mountain cableway", "cable car mountain", "缆车", "交通 缆车 山"},
+    {"🚟", "suspension railway", "railway train", "悬挂式铁路", "交通 铁路"},
+    {"🚃", "railway car", "train railway car", "轨道车", "交通 火车 车厢"},
+    {"🚋", "tram car", "tram car", "有轨电车车厢", "交通 电车 车厢"},
+    {"🚞", "mountain railway", "train railway mountain", "山区铁路", "交通 火车 山"},
+    {"🚝", "monorail", "train monorail", "单轨", "交通 单轨"},
+    {"🚄", "high-speed train", "train fast bullet", "高速列车", "交通 高铁 火车 动车"},
+    {"🚅", "bullet train", "train fast shinkansen", "子弹头高速列车", "交通 高铁 火车 新干线"},
+    {"🚈", "light rail", "train light rail", "轻轨", "交通 轻轨 火车"},
+    {"🚂", "locomotive", "train steam engine", "蒸汽火车", "交通 火车 蒸汽"},
+    {"🚆", "train", "train railway", "火车", "交通 火车"},
+    {"🚇", "metro", "train subway metro", "地铁", "交通 地铁"},
+    {"🚊", "tram", "tram trolley", "有轨电车", "交通 电车"},
+    {"🚉", "station", "train station", "车站", "交通 车站 火车站"},
+    {"✈️", "airplane", "travel plane flight", "飞机", "交通 飞机 旅行 航班"},
+    {"🛫", "airplane departure", "travel plane departure takeoff", "航班起飞", "交通 飞机 起飞 出发"},
+    {"🛬", "airplane arrival", "travel plane arrival landing", "航班降落", "交通 飞机 降落 到达"},
+    {"🛩️", "small airplane", "travel plane", "小型飞机", "交通 飞机"},
+    {"💺", "seat", "seat chair travel", "座位", "座位 椅子 旅行"},
+    {"🛰️", "satellite", "space satellite", "卫星", "太空 卫星"},
+    {"🚀", "rocket", "space rocket launch", "火箭", "太空 火箭 发射"},
+    {"🛸", "flying saucer", "space ufo alien", "飞碟", "太空 飞碟 外星人"},
+    {"🚁", "helicopter", "vehicle helicopter", "直升机", "交通 直升机"},
+    {"🛶", "canoe", "boat canoe", "独木舟", "船 独木舟"},
+    {"⛵", "sailboat", "boat sail", "帆船", "船 帆船"},
+    {"🚤", "speedboat", "boat speedboat", "快艇", "船 快艇"},
+    {"🛥️", "motor boat", "boat motorboat", "摩托艇", "船 摩托艇"},
+    {"🛳️", "passenger ship", "boat ship cruise", "客轮", "船 客轮 邮轮"},
+    {"⛴️", "ferry", "boat ferry", "渡轮", "船 渡轮"},
+    {"🚢", "ship", "boat ship", "船", "船 轮船"},
+    {"⚓", "anchor", "ship anchor", "锚", "船 锚"},
+    {"⛽", "fuel pump", "gas station fuel", "油泵", "加油站 汽油"},
+    {"🚧", "construction", "construction barrier work", "路障", "施工 路障"},
+    {"🚦", "vertical traffic light", "traffic light signal", "竖直的红绿灯", "交通 红绿灯 信号灯"},
+    {"🚥", "horizontal traffic light", "traffic light signal", "横着的红绿灯", "交通 红绿灯 信号灯"},
+    {"🚏", "bus stop", "bus stop", "公交车站", "交通 公交站"},
+    {"🗺️", "world map", "map world travel", "世界地图", "地图 世界 旅行"},
+    {"🗿", "moai", "statue moai easter island", "摩埃", "雕像 复活节岛"},
+    {"🗽", "statue of liberty", "statue liberty new york", "自由女神像", "雕像 自由女神 纽约"},
+    {"🗼", "tokyo tower", "tower tokyo japan", "东京塔", "塔 东京 日本"},
+    {"🏰", "castle", "castle european", "欧洲城堡", "城堡"},
+    {"🏯", "japanese castle", "castle japan", "日本城堡", "城堡 日本"},
+    {"🏟️", "stadium", "stadium arena", "体育馆", "体育馆 体育场"},
+    {"🎡", "ferris wheel", "ferris wheel amusement park", "摩天轮", "摩天轮 游乐园"},
+    {"🎢", "roller coaster", "roller coaster amusement park", "过山车", "过山车 游乐园"},
+    {"🎠", "carousel horse", "carousel merry go round", "旋转木马", "旋转木马 游乐园"},
+    {"⛲", "fountain", "fountain", "喷泉", "喷泉"},
+    {"⛱️", "umbrella on ground", "beach umbrella sun", "沙滩伞", "伞 沙滩 阳光"},
+    {"🏖️", "beach with umbrella", "beach summer vacation", "沙滩", "海滩 夏天 度假"},
+    {"🏝️", "desert island", "island tropical vacation", "无人荒岛", "岛 热带 度假"},
+    {"🏜️", "desert", "desert sand", "沙漠", "沙漠 沙子"},
+    {"🌋", "volcano", "volcano eruption mountain", "火山", "火山 喷发 山"},
+    {"⛰️", "mountain", "mountain", "山", "山"},
+    {"🏔️", "snow-capped mountain", "mountain snow cold", "雪山", "山 雪 冷"},
+    {"🗻", "mount fuji", "mountain fuji japan", "富士山", "山 富士山 日本"},
+    {"🏕️", "camping", "camping outdoors", "露营", "露营 户外"},
+    {"⛺", "tent", "tent camping", "帐篷", "帐篷 露营"},
+    {"🏠", "house", "house home building", "房子", "房子 家 建筑"},
+    {"🏡", "house with garden", "house home garden", "别墅", "房子 家 花园"},
+    {"🏘️", "houses", "houses neighborhood", "房屋建筑", "房子 社区"},
+    {"🏚️", "derelict house", "house abandoned", "废墟", "房子 废弃"},
+    {"🏗️", "building construction", "building construction crane", "施工", "建筑 施工 起重机"},
+    {"🏭", "factory", "factory building industry", "工厂", "工厂 建筑 工业"},
+    {"🏢", "office building", "building office work", "办公楼", "建筑 办公楼 上班"},
+    {"🏬", "department store", "building store shopping", "商场", "建筑 商场 购物"},
+    {"🏣", "japanese post office", "building post office japan", "日本邮局", "建筑 邮局 日本"},
+    {"🏤", "post office", "building post office", "邮局", "建筑 邮局"},
+    {"🏥", "hospital", "building hospital doctor", "医院", "建筑 医院 医生"},
+    {"🏦", "bank", "building bank money", "银行", "建筑 银行 钱"},
+
+    // Objects
+    {"⌚", "watch", "watch clock time", "手表", "手表 时间"},
+    {"📱", "mobile phone", "phone mobile cell smartphone", "手机", "手机 电话"},
+    {"📲", "mobile phone with arrow", "phone mobile call receive", "带有箭头的手机", "手机 来电 接收"},
+    {"💻", "laptop", "computer laptop pc", "笔记本电脑", "电脑 笔记本"},
+    {"⌨️", "keyboard", "computer keyboard typing", "键盘", "电脑 键盘 打字"},
+    {"🖥️", "desktop computer", "computer desktop monitor", "台式电脑", "电脑 台式机 显示器"},
+    {"🖨️", "printer", "computer printer print", "打印机", "电脑 打印机 打印"},
+    {"🖱️", "computer mouse", "computer mouse", "电脑鼠标", "电脑 鼠标"},
+    {"🖲️", "trackball", "computer trackball", "轨迹球", "电脑 轨迹球"},
+    {"🕹️", "joystick", "game joystick controller", "游戏操控杆", "游戏 摇杆"},
+    {"🗜️", "clamp", "clamp compression vise", "夹钳", "夹子 压缩"},
+    {"💽", "computer disk", "disk minidisc", "电脑光盘", "光盘 磁盘"},
+    {"💾", "floppy disk", "disk floppy save", "软盘", "软盘 保存"},
+    {"💿", "optical disk", "disk cd", "光盘", "光盘 CD"},
+    {"📀", "dvd", "disk dvd", "DVD", "光盘 DVD"},
+    {"📼", "videocassette", "video tape vhs", "录像带", "录像带 磁带"},
+    {"📷", "camera", "camera photo", "相机", "相机 拍照 照片"},
+    {"📸", "camera with flash", "camera photo flash", "开闪光灯的相机", "相机 拍照 闪光灯"},
+    {"📹", "video camera", "camera video record", "摄像机", "摄像机 录像"},
+    {"🎥", "movie camera", "camera movie film", "电影摄影机", "摄影机 电影"},
+    {"📽️", "film projector", "film projector movie", "电影放映机", "放映机 电影"},
+    {"🎞️", "film frames", "film movie frames", "影片帧", "胶片 电影"},
+    {"📞", "telephone receiver", "phone call telephone", "电话听筒", "电话 听筒"},
+    {"☎️", "telephone", "phone telephone", "电话", "电话 座机"},
+    {"📟", "pager", "pager", "寻呼机", "寻呼机 BP机"},
+    {"📠", "fax machine", "fax", "传真机", "传真机"},
+    {"📺", "television", "tv television", "电视机", "电视 电视机"},
+    {"📻", "radio", "radio", "收音机", "收音机 广播"},
+    {"🎙️", "studio microphone", "microphone studio podcast", "录音室麦克风", "麦克风 录音 播客"},
+    {"🎚️", "level slider", "slider level audio", "电平滑块", "滑块 音量"},
+    {"🎛️", "control knobs", "knobs control audio", "控制旋钮", "旋钮 控制"},
+    {"🧭", "compass", "compass navigation direction", "指南针", "指南针 方向 导航"},
+    {"⏱️", "stopwatch", "clock stopwatch timer", "秒表", "秒表 计时"},
+    {"⏲️", "timer clock", "clock timer", "定时器", "定时器 计时"},
+    {"⏰", "alarm clock", "clock alarm wake", "闹钟", "闹钟 起床"},
+    {"🕰️", "mantelpiece clock", "clock time", "座钟", "钟 时间"},
+    {"⌛", "hourglass done", "hourglass time sand", "沙漏", "沙漏 时间"},
+    {"⏳", "hourglass not done", "hourglass time waiting", "流沙漏", "沙漏 时间 等待"},
+    {"📡", "satellite antenna", "antenna satellite dish signal", "卫星天线", "天线 卫星 信号"},
+    {"🔋", "battery", "battery power energy", "电池", "电池 电量"},
+    {"🔌", "electric plug", "plug electric power", "电源插头", "插头 电源"},
+    {"💡", "light bulb", "idea light bulb", "灯泡", "灯泡 主意 想法 点子"},
+    {"🔦", "flashlight", "flashlight torch light", "手电筒", "手电筒 光"},
+    {"🕯️", "candle", "candle light", "蜡烛", "蜡烛 光"},
+    {"🪔", "diya lamp", "lamp oil diya", "印度油灯", "油灯 灯"},
+    {"🧯", "fire extinguisher", "fire extinguisher safety", "灭火器", "灭火器 消防"},
+    {"🛢️", "oil drum", "oil drum barrel", "石油桶", "石油 油桶"},
+    {"💸", "money with wings", "money spend fly", "长翅膀的钱", "钱 花钱 飞走"},
+    {"💵", "dollar banknote", "money dollar bill", "美元", "钱 美元 纸币"},
+    {"💴", "yen banknote", "money yen bill", "日元", "钱 日元 纸币"},
+    {"💶", "euro banknote", "money euro bill", "欧元", "钱 欧元 纸币"},
+    {"💷", "pound banknote", "money pound bill", "英镑", "钱 英镑 纸币"},
+    {"💰", "money bag", "money bag rich", "钱袋", "钱 钱袋 有钱"},
+    {"💳", "credit card", "money card credit", "信用卡", "钱 信用卡 银行卡"},
+    {"💎", "gem stone", "gem diamond jewel", "宝石", "宝石 钻石"},
+    {"⚖️", "balance scale", "scale justice balance law", "天平", "天平 公正 法律"},
+    {"🧰", "toolbox", "tool toolbox", "工具箱", "工具 工具箱"},
+    {"🔧", "wrench", "tool wrench spanner fix", "扳手", "工具 扳手 修理"},
+    {"🔨", "hammer", "tool hammer", "锤子", "工具 锤子"},
+    {"⚒️", "hammer and pick", "tool hammer pick mining", "锤子与镐", "工具 锤子 镐"},
+    {"🛠️", "hammer and wrench", "tool hammer wrench fix", "锤子与扳手", "工具 锤子 扳手 修理"},
+    {"⛏️", "pick", "tool pick mining", "镐", "工具 镐 挖矿"},
+    {"🔩", "nut and bolt", "tool nut bolt", "螺母与螺栓", "工具 螺丝 螺母"},
+    {"⚙️", "gear", "tool gear cog settings", "齿轮", "工具 齿轮 设置"},
+    {"🧱", "brick", "brick wall clay", "砖", "砖 墙"},
+    {"⛓️", "chains", "chain link", "链条", "链条 锁链"},
+    {"🧲", "magnet", "magnet attraction", "磁铁", "磁铁 吸引"},
+    {"🔫", "water pistol", "gun pistol water", "水枪", "枪 水枪"},
+    {"💣", "bomb", "bomb explode", "炸弹", "炸弹 爆炸"},
+    {"🧨", "firecracker", "firecracker explode fireworks", "爆竹", "鞭炮 爆竹 烟花 春节"},
+    {"🪓", "axe", "tool axe wood", "斧头", "工具 斧头"},
+    {"🔪", "kitchen knife", "knife kitchen cooking", "菜刀", "刀 菜刀 厨房"},
+    {"🗡️", "dagger", "dagger knife weapon", "匕首", "匕首 刀 武器"},
+    {"⚔️", "crossed swords", "swords weapon fight", "交叉放置的剑", "剑 武器 战斗"},
+    {"🛡️", "shield", "shield weapon defense", "盾牌", "盾牌 防御"},
+    {"🚬", "cigarette", "cigarette smoking", "香烟", "香烟 吸烟"},
+    {"⚰️", "coffin", "coffin death funeral", "棺材", "棺材 死亡 葬礼"},
+    {"⚱️", "funeral urn", "urn death funeral", "骨灰缸", "骨灰盒 葬礼"},
+    {"🏺", "amphora", "amphora vase jar", "双耳瓶", "瓶子 花瓶"},
+    {"🔮", "crystal ball", "crystal ball fortune magic", "水晶球", "水晶球 算命 魔法"},
+    {"📿", "prayer beads", "prayer beads religion", "念珠", "念珠 佛珠 宗教"},
+    {"🧿", "nazar amulet", "amulet evil eye charm", "纳扎尔护身符", "护身符 邪眼"},
+    {"💈", "barber pole", "barber haircut", "理发店", "理发 理发店"},
+    {"⚗️", "alembic", "chemistry alembic", "蒸馏器", "化学 蒸馏"},
+    {"🔭", "telescope", "telescope science astronomy", "望远镜", "望远镜 科学 天文"},
+    {"🔬", "microscope", "microscope science lab", "显微镜", "显微镜 科学 实验室"},
+    {"🕳️", "hole", "hole", "洞", "洞"},
+    {"🩹", "adhesive bandage", "bandage band-aid injury", "创可贴", "创可贴 受伤"},
+    {"🩺", "stethoscope", "doctor stethoscope medicine", "听诊器", "医生 听诊器 医疗"},
+    {"💊", "pill", "pill medicine drug", "药丸", "药 药丸 医疗"},
+    {"💉", "syringe", "syringe needle vaccine medicine", "注射器", "注射 针 疫苗 医疗"},
+    {"🩸", "drop of blood", "blood drop donation", "血滴", "血 献血"},
+    {"🧬", "dna", "dna gene biology", "DNA", "DNA 基因 生物"},
+    {"🦠", "microbe", "microbe virus bacteria germ", "微生物", "微生物 病毒 细菌"},
+    {"🧫", "petri dish", "petri dish biology lab", "培养皿", "培养皿 生物 实验室"},
+    {"🧪", "test tube", "test tube chemistry lab", "试管", "试管 化学 实验室"},
+
+    // Symbols & Hearts
+    {"❤️", "red heart", "heart love red", "红心", "心 爱 红色"},
+    {"🧡", "orange heart", "heart love orange", "橙心", "心 爱 橙色"},
+    {"💛", "yellow heart", "heart love yellow", "黄心", "心 爱 黄色"},
+    {"💚", "green heart", "heart love green", "绿心", "心 爱 绿色"},
+    {"💙", "blue heart", "heart love blue", "蓝心", "心 爱 蓝色"},
+    {"💜", "purple heart", "heart love purple", "紫心", "心 爱 紫色"},
+    {"🖤", "black heart", "heart black", "黑心", "心 黑色"},
+    {"🤍", "white heart", "heart white", "白心", "心 白色"},
+    {"🤎", "brown heart", "heart brown", "棕心", "心 棕色"},
+    {"💔", "broken heart", "heart broken sad breakup", "心碎", "心 心碎 伤心 分手"},
+    {"❣️", "heart exclamation", "heart exclamation love", "心叹号", "心 感叹号 爱"},
+    {"💕", "two hearts", "heart love hearts", "两颗心", "心 爱"},
+    {"💞", "revolving hearts", "heart love hearts", "旋转的心", "心 爱"},
+    {"💓", "beating heart", "heart love beating", "心跳", "心 爱 心跳"},
+    {"💗", "growing heart", "heart love growing", "增大的心", "心 爱"},
+    {"💖", "sparkling heart", "heart love sparkle", "闪亮的心", "心 爱 闪亮"},
+    {"💘", "heart with arrow", "heart love cupid arrow", "心中箭了", "心 爱 丘比特 箭"},
+    {"💝", "heart with ribbon", "heart love gift valentine", "系有缎带的心", "心 爱 礼物 情人节"},
+    {"💟", "heart decoration", "heart decoration", "心型装饰", "心 装饰"},
+    {"☮️", "peace symbol", "peace symbol", "和平符号", "和平 符号"},
+    {"✝️", "latin cross", "cross christian religion", "十字架", "十字架 基督教 宗教"},
+    {"☪️", "star and crescent", "islam religion", "星月", "伊斯兰教 宗教"},
+    {"🕉️", "om", "om hindu religion", "奥姆", "印度教 宗教"},
+    {"☸️", "wheel of dharma", "dharma buddhist religion", "法轮", "佛教 宗教"},
+    {"✡️", "star of david", "star david jewish religion", "六芒星", "犹太教 宗教"},
+    {"🔯", "dotted six-pointed star", "star six pointed fortune", "带中心点的六芒星", "六芒星 算命"},
+    {"🕎", "menorah", "menorah jewish religion", "烛台", "烛台 犹太教"},
+    {"☯️", "yin yang", "yin yang tao", "阴阳", "阴阳 道教 太极"},
+    {"☦️", "orthodox cross", "cross orthodox christian", "东正教十字架", "十字架 东正教"},
+    {"🛐", "place of worship", "worship religion pray", "宗教场所", "宗教 礼拜 祈祷"},
+    {"⛎", "ophiuchus", "zodiac ophiuchus", "蛇夫座", "星座 蛇夫座"},
+    {"♈", "aries", "zodiac aries horoscope", "白羊座", "星座 白羊座"},
+    {"♉", "taurus", "zodiac taurus horoscope", "金牛座", "星座 金牛座"},
+    {"♊", "gemini", "zodiac gemini horoscope", "双子座", "星座 双子座"},
+    {"♋", "cancer", "zodiac cancer horoscope", "巨蟹座", "星座 巨蟹座"},
+    {"♌", "leo", "zodiac leo horoscope", "狮子座", "星座 狮子座"},
+    {"♍", "virgo", "zodiac virgo horoscope", "处女座", "星座 处女座"},
+    {"♎", "libra", "zodiac libra horoscope", "天秤座", "星座 天秤座"},
+    {"♏", "scorpio", "zodiac scorpio horoscope", "天蝎座", "星座 天蝎座"},
+    {"♐", "sagittarius", "zodiac sagittarius horoscope", "射手座", "星座 射手座"},
+    {"♑", "capricorn", "zodiac capricorn horoscope", "摩羯座", "星座 摩羯座"},
+    {"♒", "aquarius", "zodiac aquarius horoscope", "水瓶座", "星座 水瓶座"},
+    {"♓", "pisces", "zodiac pisces horoscope", "双鱼座", "星座 双鱼座"},
+    {"🆔", "id button", "id identity", "身份证", "身份 ID"},
+    {"⚛️", "atom symbol", "atom science physics", "原子符号", "原子 科学 物理"},
+    {"🉑", "japanese acceptable button", "japanese acceptable", "可", "可以 接受"},
+    {"☢️", "radioactive", "radioactive danger nuclear", "辐射", "辐射 危险 核"},
+    {"☣️", "biohazard", "biohazard danger", "生物危害", "生物危害 危险"},
+    {"📴", "mobile phone off", "phone off silent", "手机关机", "手机 关机"},
+    {"📳", "vibration mode", "phone vibrate", "振动模式", "手机 振动"},
+    {"🈶", "japanese not free of charge button", "japanese charge", "有", "有 收费"},
+    {"🈚", "japanese free of charge button", "japanese free", "无", "无 免费"},
+    {"🈸", "japanese application button", "japanese application", "申", "申请"},
+    {"🈺", "japanese open for business button", "japanese open business", "营", "营业"},
+    {"🈷️", "japanese monthly amount button", "japanese monthly", "月", "每月"},
+    {"✴️", "eight-pointed star", "star eight pointed", "八角星", "星星 八角星"},
+    {"🆚", "vs button", "versus vs", "VS", "对战 对比"},
+    {"💮", "white flower", "flower white well done", "白花", "花 白色 做得好"},
+    {"🉐", "japanese bargain button", "japanese bargain", "得", "得 便宜"},
+    {"㊙️", "japanese secret button", "japanese secret", "秘", "秘密"},
+    {"㊗️", "japanese congratulations button", "japanese congratulations", "祝", "祝贺 恭喜"},
+    {"🈴", "japanese passing grade button", "japanese passing grade", "合", "合格 及格"},
+    {"🈵", "japanese no vacancy button", "japanese full no vacancy", "满", "客满 满"},
+    {"🈹", "japanese discount button", "japanese discount", "割", "打折 折扣"},
+    {"🈲", "japanese prohibited button", "japanese prohibited", "禁", "禁止"},
+    {"🅰️", "a button (blood type)", "letter a blood type", "A型血", "字母 A 血型"},
+    {"🅱️", "b button (blood type)", "letter b blood type", "B型血", "字母 B 血型"},
+    {"🆎", "ab button (blood type)", "letter ab blood type", "AB型血", "字母 AB 血型"},
+    {"🆑", "cl button", "clear cl", "CL 按钮", "清除"},
+    {"🅾️", "o button (blood type)", "letter o blood type", "O型血", "字母 O 血型"},
+    {"🆘", "sos button", "sos help emergency", "SOS", "求救 帮助 紧急"},
+    {"❌", "cross mark", "cross x no wrong cancel", "叉号", "叉 错误 取消 否"},
+    {"⭕", "hollow red circle", "circle o correct", "红色空心圆圈", "圆圈 正确 对"},
+    {"🛑", "stop sign", "stop sign octagonal", "停止标志", "停止 停车"},
+    {"⛔", "no entry", "no entry forbidden", "禁止通行", "禁止 通行"},
+    {"📛", "name badge", "name badge tag", "姓名牌", "名牌 姓名"},
+    {"🚫", "prohibited", "prohibited forbidden no not allowed", "禁止", "禁止 不允许"},
+    {"💯", "hundred points", "score hundred perfect 100", "一百分", "满分 一百 完美"},
+    {"💢", "anger symbol", "angry anger symbol", "怒", "愤怒 生气"},
+    {"♨️", "hot springs", "hot springs onsen steam", "温泉", "温泉 热"},
+    {"🚷", "no pedestrians", "forbidden pedestrian walking", "禁止行人通行", "禁止 行人"},
+    {"🚯", "no littering", "forbidden litter trash", "禁止乱扔垃圾", "禁止 垃圾"},
+    {"🚳", "no bicycles", "forbidden bicycle bike", "禁止自行车", "禁止 自行车"},
+    {"🚱", "non-potable water", "water not drinkable", "非饮用水", "水 禁止饮用"},
+    {"🔞", "no one under eighteen", "forbidden age 18 adult", "18禁", "禁止 成人 未成年"},
+    {"📵", "no mobile phones", "forbidden phone mobile", "禁止使用手机", "禁止 手机"},
+    {"🚭", "no smoking", "forbidden smoking cigarette", "禁止吸烟", "禁止 吸烟"},
+    {"❗", "red exclamation mark", "exclamation mark warning", "红色感叹号", "感叹号 警告 注意"},
+    {"❕", "white exclamation mark", "exclamation mark", "白色感叹号", "感叹号"},
+    {"❓", "red question mark", "question mark", "红色问号", "问号 疑问"},
+    {"❔", "white question mark", "question mark", "白色问号", "问号 疑问"},
+    {"‼️", "double exclamation mark", "exclamation mark double", "双感叹号", "感叹号"},
+    {"⁉️", "exclamation question mark", "exclamation question interrobang", "感叹问号", "感叹号 问号"},
+    {"🔅", "dim button", "brightness dim low", "低亮度", "亮度 暗"},
+    {"🔆", "bright button", "brightness bright high", "高亮度", "亮度 亮"},
+    {"〽️", "part alternation mark", "mark part", "庵点", "符号"},
+    {"⚠️", "warning", "warning caution alert", "警告", "警告 注意 小心"},
+    {"🚸", "children crossing", "children crossing school", "儿童过街", "儿童 过马路 学校"},
+    {"🔱", "trident emblem", "trident emblem", "三叉戟徽章", "三叉戟 徽章"},
+    {"⚜️", "fleur-de-lis", "fleur de lis emblem", "百合花饰", "百合花 徽章"},
+    {"🔰", "japanese symbol for beginner", "beginner japanese", "日本新手驾驶标志", "新手 初学者"},
+    {"♻️", "recycling symbol", "recycle recycling green", "回收标志", "回收 环保"},
+    {"✅", "check mark button", "check mark done yes ok", "勾号按钮", "勾 完成 正确 对"},
+    {"🈯", "japanese reserved button", "japanese reserved", "指", "预约 指定"},
+    {"💹", "chart increasing with yen", "chart yen market", "趋势向上且带有日元符号的图表", "图表 日元 增长"},
+    {"❇️", "sparkle", "sparkle star", "火花", "闪光 星星"},
+    {"✳️", "eight-spoked asterisk", "asterisk star", "八轮辐星号", "星号"},
+    {"❎", "cross mark button", "cross x square", "叉号按钮", "叉 错误"},
+    {"🌐", "globe with meridians", "globe world internet web", "带经纬线的地球", "地球 世界 互联网 网络"},
+    {"💠", "diamond with a dot", "diamond dot", "带圆点的菱形", "菱形"},
+    {"Ⓜ️", "circled m", "letter m circle metro", "圆圈包围的M", "字母 M 地铁"},
+    {"🌀", "cyclone", "cyclone typhoon hurricane weather", "台风", "台风 飓风 天气 旋风"},
+
+    // Flags (selection)
+    {"🏁", "chequered flag", "flag checkered race finish", "终点旗", "旗 终点 比赛"},
+    {"🚩", "triangular flag", "flag triangular red", "三角旗", "旗 三角旗"},
+    {"🎌", "crossed flags", "flag crossed japan", "交叉旗", "旗 日本"},
+    {"🏴", "black flag", "flag black", "举黑旗", "旗 黑旗"},
+    {"🏳️", "white flag", "flag white surrender", "举白旗", "旗 白旗 投降"},
+    {"🏳️‍🌈", "rainbow flag", "flag rainbow pride", "彩虹旗", "旗 彩虹"},
+    {"🏳️‍⚧️", "transgender flag", "flag transgender pride", "跨性别旗", "旗 跨性别"},
+    {"🏴‍☠️", "pirate flag", "flag pirate skull", "海盗旗", "旗 海盗 骷髅"},
+    {"🇨🇳", "flag: china", "flag china cn", "旗: 中国", "旗 中国 国旗"},
+    {"🇺🇸", "flag: united states", "flag usa us america", "旗: 美国", "旗 美国 国旗"},
+    {"🇬🇧", "flag: united kingdom", "flag uk gb britain", "旗: 英国", "旗 英国 国旗"},
+    {"🇯🇵", "flag: japan", "flag japan jp", "旗: 日本", "旗 日本 国旗"},
+    {"🇰🇷", "flag: south korea", "flag korea kr", "旗: 韩国", "旗 韩国 国旗"},
+    {"🇫🇷", "flag: france", "flag france fr", "旗: 法国", "旗 法国 国旗"},
+    {"🇩🇪", "flag: germany", "flag germany de", "旗: 德国", "旗 德国 国旗"},
+    {"🇮🇹", "flag: italy", "flag italy it", "旗: 意大利", "旗 意大利 国旗"},
+    {"🇪🇸", "flag: spain", "flag spain es", "旗: 西班牙", "旗 西班牙 国旗"},
+    {"🇷🇺", "flag: russia", "flag russia ru", "旗: 俄罗斯", "旗 俄罗斯 国旗"},
+    {"🇨🇦", "flag: canada", "flag canada ca", "旗: 加拿大", "旗 加拿大 国旗"},
+    {"🇦🇺", "flag: australia", "flag australia au", "旗: 澳大利亚", "旗 澳大利亚 国旗"},
+    {"🇧🇷", "flag: brazil", "flag brazil br", "旗: 巴西", "旗 巴西 国旗"},
+    {"🇮🇳", "flag: india", "flag india in", "旗: 印度", "旗 印度 国旗"},
+    {"🇲🇽", "flag: mexico", "flag mexico mx", "旗: 墨西哥", "旗 墨西哥 国旗"},
+    {"🇸🇬", "flag: singapore", "flag singapore sg", "旗: 新加坡", "旗 新加坡 国旗"},
+};
+
+inline constexpr int kCount = int(std::size(kEntries));
+
+} // namespace EmojiTable
+
+#endif // EMOJITABLE_H
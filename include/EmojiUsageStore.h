@@ -0,0 +1,61 @@
+#ifndef EMOJIUSAGESTORE_H
+#define EMOJIUSAGESTORE_H
+
+#include <QDateTime>
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+class QTimer;
+
+/**
+ * @brief 表情的使用次数与最近使用时间，持久化为 JSON 文件
+ *
+ * 分数 = 使用次数 × 按最近使用时间衰减的权重（半衰期一周），
+ * 经常用、最近用过的表情排在搜索结果与 "常用" 一行的前面。
+ * 写入在短暂延迟后合并保存。
+ */
+class EmojiUsageStore : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit EmojiUsageStore(const QString &filePath, QObject *parent = nullptr);
+    ~EmojiUsageStore() override;
+
+    /**
+     * @brief 记录一次使用
+     */
+    void record(const QString &glyph);
+
+    /**
+     * @brief 表情当前的使用分数，从未使用过时为 0
+     */
+    float score(const QString &glyph, const QDateTime &now) const;
+
+    /**
+     * @brief 分数最高的若干个表情
+     */
+    QStringList mostUsed(int limit) const;
+
+    /**
+     * @brief 立即把未写入的修改保存到磁盘
+     */
+    void flush();
+
+private:
+    struct Usage
+    {
+        int count;
+        QDateTime lastUsed;
+    };
+
+    void load();
+
+    QString m_filePath;
+    QHash<QString, Usage> m_usage;
+    QTimer *m_saveTimer;
+};
+
+#endif // EMOJIUSAGESTORE_H
@@ -0,0 +1,93 @@
+#ifndef HEADINGINDEX_H
+#define HEADINGINDEX_H
+
+#include <QAbstractListModel>
+#include <QPointer>
+#include <QString>
+#include <QTextBlock>
+#include <QTextDocument>
+#include <vector>
+
+/**
+ * @brief 增量维护的 Markdown 标题索引（同时作为大纲视图的模型）
+ *
+ * 解析规则与预览渲染保持一致：以 "# "、"## "、"### " 开头的行是标题，
+ * ``` 围栏内的行不参与解析。每个文本块的围栏状态保存在
+ * QTextBlock::userState() 中，文档变化时只重新解析受影响的文本块，
+ * 仅当围栏状态发生翻转时才继续向后传播。
+ */
+class HeadingIndex : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 单个标题条目
+     */
+    struct Heading
+    {
+        int blockNumber;
+        int level;
+        QString title;
+
+        bool operator==(const Heading &other) const
+        {
+            return blockNumber == other.blockNumber && level == other.level && title == other.title;
+        }
+    };
+
+    enum Roles {
+        LevelRole = Qt::UserRole + 1,
+        BlockNumberRole
+    };
+
+    explicit HeadingIndex(QObject *parent = nullptr);
+    ~HeadingIndex() override;
+
+    /**
+     * @brief 设置要索引的文档并完整解析一次
+     */
+    void setDocument(QTextDocument *document);
+
+    const std::vector<Heading> &headings() const;
+
+    /**
+     * @brief 二分查找给定文本块所在的章节
+     * @return 位于该文本块或其之前的最后一个标题的下标，没有时返回 -1
+     */
+    int headingIndexForBlock(int blockNumber) const;
+
+    /**
+     * @brief 解析单行 Markdown 标题
+     * @param line 行文本
+     * @param title 输出标题文本（可为空指针）
+     * @return 标题级别 1-3，非标题返回 0
+     */
+    static int headingLevel(const QString &line, QString *title = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private slots:
+    void onContentsChange(int position, int charsRemoved, int charsAdded);
+
+private:
+    void rebuild();
+
+    /**
+     * @brief 从 first 开始解析文本块直到越过 last 且围栏状态收敛
+     * @return 最后一个被解析的文本块
+     */
+    QTextBlock parseBlocks(const QTextBlock &first, const QTextBlock &last, std::vector<Heading> &out);
+
+    /**
+     * @brief 用 fresh 替换 [from, to) 范围内的条目，并发出最小化的模型变更信号
+     */
+    void replaceRange(int from, int to, std::vector<Heading> &fresh);
+
+    QPointer<QTextDocument> m_document;
+    std::vector<Heading> m_headings;  ///< 按 blockNumber 升序排列
+    int m_blockCount;                 ///< 上次更新后的文本块数量，用于计算行号偏移
+};
+
+#endif // HEADINGINDEX_H
@@ -0,0 +1,55 @@
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <QtGlobal>
+#include <array>
+
+/**
+ * @brief HDR 风格的延迟直方图（单位：微秒）
+ *
+ * 小于 128 µs 的值逐一计数；更大的值按 2 的幂分段，每段再均分为 64 个子桶，
+ * 相对误差不超过 1/64（约 1.6%），范围到约一小时，超出的值计入最后一个桶。
+ * 记录是 O(1) 的一次数组自增，没有内存分配；百分位数通过一次累加扫描得到。
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr int kSubBucketBits = 7;
+    static constexpr int kSubBucketCount = 1 << kSubBucketBits;  // 128
+    static constexpr int kHalfSubBucketCount = kSubBucketCount / 2;
+    static constexpr int kMaxShift = 26;  // 2^(26+6) µs ≈ 71 分钟
+    static constexpr int kBucketCount = kSubBucketCount + kMaxShift * kHalfSubBucketCount;
+
+    LatencyHistogram();
+
+    void record(qint64 micros);
+    void reset();
+
+    qint64 count() const;
+    qint64 min() const;
+    qint64 max() const;
+    double mean() const;
+
+    /**
+     * @brief 百分位数（0–100），返回所在桶的中间值；没有样本时返回 0
+     */
+    qint64 valueAtPercentile(double percentile) const;
+
+    /**
+     * @brief 桶的计数与覆盖范围 [lowerBound, upperBound]，用于导出完整分布
+     */
+    qint64 bucketCount(int index) const;
+    static qint64 bucketLowerBound(int index);
+    static qint64 bucketUpperBound(int index);
+
+private:
+    static int bucketIndex(qint64 micros);
+
+    std::array<qint64, kBucketCount> m_counts;
+    qint64 m_total;
+    qint64 m_min;
+    qint64 m_max;
+    double m_sum;
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,40 @@
+#ifndef LATENCYHUD_H
+#define LATENCYHUD_H
+
+#include <QLabel>
+
+class QTimer;
+
+/**
+ * @brief 浮在编辑区右上角的延迟面板
+ *
+ * 每 500 ms 从 LatencyMonitor 读取一次分位数；右键菜单可把直方图导出为
+ * CSV/JSON 或清零。面板只在可见时启用监视器，隐藏后不再产生任何开销。
+ */
+class LatencyHud : public QLabel
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @param editor 面板叠放在其右上角（放在滚动区域上而非视口上，滚动时不随内容移动）
+     */
+    explicit LatencyHud(QWidget *editor);
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+    void contextMenuEvent(QContextMenuEvent *event) override;
+
+private slots:
+    void refresh();
+
+private:
+    void reposition();
+    void exportTo(bool json);
+
+    QTimer *m_refreshTimer;
+};
+
+#endif // LATENCYHUD_H
@@ -0,0 +1,81 @@
+#ifndef LATENCYMONITOR_H
+#define LATENCYMONITOR_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <array>
+#include "LatencyHistogram.h"
+
+class QTimer;
+
+/**
+ * @brief 编辑器响应延迟的计数器（仅在 GUI 线程使用，归应用程序所有，退出事件循环时停止）
+ *
+ * 每个指标各有一个 LatencyHistogram：
+ * - KeyToPaint：输入事件到达 MarkdownEditor 到下一次绘制完成编辑区；
+ * - PreviewRender：一次预览刷新（Markdown 转 HTML 并排版）的耗时；
+ * - EventLoopLag：50 ms 精确定时器的迟到量，反映事件循环的卡顿；
+ * - ThemeSwitch：切换主题（调色板与样式表、预览换色）到下一轮事件循环，近似包含重绘。
+ * 未启用时 inputReceived()/inputPainted() 只做一次布尔判断；
+ * 直方图可随时导出为 CSV（分位数汇总）或 JSON（汇总加完整的桶分布）。
+ */
+class LatencyMonitor : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Metric {
+        KeyToPaint,
+        PreviewRender,
+        EventLoopLag,
+        ThemeSwitch,
+        MetricCount
+    };
+
+    static LatencyMonitor &instance();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    /**
+     * @brief 一个会修改文本的输入事件到达编辑器
+     */
+    void inputReceived();
+
+    /**
+     * @brief 编辑区绘制完成；此前尚未显示的输入各记录一次延迟
+     */
+    void inputPainted();
+
+    /**
+     * @brief 直接记录一次耗时（微秒）
+     */
+    void record(Metric metric, qint64 micros);
+
+    const LatencyHistogram &histogram(Metric metric) const;
+    static QString metricName(Metric metric);
+
+    void reset();
+
+    bool exportCsv(const QString &filePath, QString *error) const;
+    bool exportJson(const QString &filePath, QString *error) const;
+
+private slots:
+    void onLagTick();
+
+private:
+    explicit LatencyMonitor(QObject *parent = nullptr);
+
+    bool writeFile(const QString &filePath, const QByteArray &data, QString *error) const;
+
+    bool m_enabled;
+    QElapsedTimer m_clock;
+    QVector<qint64> m_pendingInputs;  // 尚未绘制的输入时刻（ns）
+    QTimer *m_lagTimer;
+    qint64 m_lastTickNs;
+    std::array<LatencyHistogram, MetricCount> m_histograms;
+};
+
+#endif // LATENCYMONITOR_H
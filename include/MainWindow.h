@@ -13,17 +13,38 @@
 #include <QHBoxLayout>
 #include <QVBoxLayout>
 #include <QLabel>
+#include <QPixmap>
 #include <QScrollArea>
-#include <QSettings>
 #include <QComboBox>
 #include <QTimer>
 #include <QCloseEvent>
+#include <QShowEvent>
+#include <QHideEvent>
 #include <QFileDialog>
 #include <QMessageBox>
 #include <QShortcut>
 #include <QWheelEvent>
 #include <QSplitter>
+#include <QDockWidget>
+#include <QListView>
 #include "MarkdownEditor.h"
+#include "HeadingIndex.h"
+#include "PdfExporter.h"
+#include "PreviewSnapshotCache.h"
+#include "SettingsManager.h"
+#include "WeatherBackend.h"
+#include "WeatherRequestCoordinator.h"
+#include "WeatherSupervisor.h"
+#include "WeatherRefreshScheduler.h"
+#include "WeatherCache.h"
+#include "WeatherDashboardModel.h"
+#include "WeatherHistoryStore.h"
+#include "SparklineWidget.h"
+#include "ZoomController.h"
+#include "LatencyHud.h"
+#include <QTableView>
+#include <QJsonObject>
+#include <QProgressDialog>
 
 class MainWindow : public QMainWindow
 {
@@ -36,14 +57,14 @@ public:
 protected:
     void closeEvent(QCloseEvent *event) override;
     void wheelEvent(QWheelEvent *event) override;
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
 
 private slots:
-    void onProcessFinished(int exitCode, QProcess::ExitStatus exitStatus);
-    void onProcessError(QProcess::ProcessError error);
-    void onProcessReadyRead();
-    void onProcessTimeout();
+    void onWeatherReady(const QString &city, const QJsonObject &data);
+    void onWeatherFailed(const QString &city, const QString &error);
     void onMarkdownTextChanged();
-    void attemptPythonRestart();
 
     // 文件操作
     void openFile();
@@ -55,26 +76,51 @@ private slots:
     void zoomOut();
     void zoomReset();
 
+    // 大纲导航
+    void onOutlineActivated(const QModelIndex &index);
+    void syncOutlineWithCursor();
+
+    // PDF 导出
+    void exportPdf();
+    void onPdfExportFinished(bool ok, const QString &filePath, const QString &error);
+
 private:
     QString enhanceMarkdownPreview(const QString &markdown);
-    QString processInlineMarkdown(const QString &text);
     void onDefaultCityChanged(int index);
     void loadWeatherForDefaultCity();
+    void fetchWeather(const QString &city, bool showLoading, bool immediate = false);
+    bool showCachedWeather(const QString &city);
+    void recordWeather(const QString &city, const QJsonObject &data);
+    void updateSparkline(const QString &city);
+    void displayWeather(const QJsonObject &data);
+    void refreshDashboard(bool force);
+    void onDashboardReady(const QJsonObject &response);
+    void onDashboardFailed(const QString &error);
     void applyTheme(const QString &themeName);
+    int swapPreviewTheme(bool wasDark, bool isDark);
     void toggleTheme();
     void updateWindowTitle();
     void setZoom(double level);
+    void applyZoomFrame(double zoom);
+    void applyPreviewZoom(double zoom);
+    void hidePreviewZoomOverlay();
+    void setLatencyHudVisible(bool visible);
     bool maybeSave();
+    void jumpToHeading(int row);
+    void refreshPreview();
+    bool loadFile(const QString &fileName, QByteArray *fileData = nullptr);
+    void restoreSession();
+    void saveSession();
 
 private:
     void setupUI();
     QString getPythonScriptPath() const;
+    bool prepareWeatherBackend();
     QString findPythonExecutable() const;
-    QString formatWeatherHTML(const QString &output, const QString &city) const;
-    QString getSkeletonHTML(const QString &city) const;
+    QString discoverPythonExecutable() const;
     void handleWeatherError(const QString &errorMsg);
-    void restartPythonProcess();
-    bool isPythonProcessHealthy() const;
+    void updateWeatherStatsToolTip();
+    void updateRefreshActivity();
 
     // 主布局组件
     QWidget *m_centralWidget;
@@ -87,6 +133,7 @@ private:
     QLabel *m_weatherTempLabel;
     QLabel *m_weatherConditionLabel;
     QLabel *m_weatherDetailsLabel;
+    SparklineWidget *m_weatherSparkline;
     QComboBox *m_defaultCityCombo;
     QPushButton *m_refreshButton;
     QPushButton *m_themeButton;
@@ -103,21 +150,44 @@ private:
 
     // 缩放 UI
     QPushButton *m_zoomResetButton;
+    QLabel *m_previewZoomOverlay;  // 缩放手势期间显示按比例缩放的预览截图
+    QPixmap m_previewZoomSnapshot;
+
+    // 延迟面板（Ctrl+Shift+L），首次打开时创建
+    LatencyHud *m_latencyHud;
+
+    // 大纲面板
+    QDockWidget *m_outlineDock;
+    QListView *m_outlineView;
+    HeadingIndex *m_headingIndex;
+
+    // PDF 导出
+    PdfExporter *m_pdfExporter;
+    QProgressDialog *m_pdfProgress;
+
+    // 会话恢复
+    PreviewSnapshotCache m_previewSnapshots;
+    QString m_previewHtml;  // 当前预览的 HTML，用于写入会话快照
     
 
     
     // 后端
-    QProcess *m_process;
-    QTimer *m_processTimeout;
+    WeatherBackend *m_weatherBackend;  // Python 工作进程或原生 HTTP 客户端，由 weatherBackend 设置决定
+    WeatherRequestCoordinator *m_weatherRequests;  // 侧边栏请求：去抖、合并，只保留最新的
+    WeatherSupervisor *m_weatherSupervisor;
+    WeatherRefreshScheduler *m_refreshScheduler;
+    WeatherCache *m_weatherCache;
+    QJsonObject m_displayedWeather;  // 侧边栏当前显示的天气，用于跳过相同值的更新
+    QString m_displayedCity;         // m_displayedWeather 所属的城市（显示时的 m_currentCity）
+    WeatherHistoryStore m_weatherHistory;  // 每次成功获取的温度，按城市保存在 cache/history/
+
+    // 天气仪表盘
+    WeatherDashboardModel *m_dashboardModel;
+    QTableView *m_dashboardView;
+    int m_dashboardRequestId;  // 进行中的批量请求，0 表示没有
     QString m_currentCity;
-    QString m_processOutput;
-    QSettings *m_settings;
-    
-    // Python 进程管理
-    int m_pythonRestartAttempts;
-    int m_maxRestartAttempts;
-    QTimer *m_restartTimer;
-    QString m_pendingCity;
+    SettingsManager *m_settings;
+    mutable QString m_pythonExecutable;  // 缓存的 Python 解释器路径
 
     // 文件管理
     QString m_currentFilePath;
@@ -127,13 +197,15 @@ private:
 
     // 缩放管理
     double m_currentZoom;
-    double m_previewBaseZoom;  // 追踪预览的基础缩放因子
+    double m_previewZoom;  // 预览当前布局所用的缩放
+    double m_previewBasePointSize;  // 100% 时预览的字号
+    ZoomController *m_zoomController;
     QTimer *m_previewUpdateTimer;  // 预览更新的防抖定时器
-    QTimer *m_zoomSettingsSaveTimer;  // 缩放设置写入的防抖定时器
     static constexpr double ZOOM_STEP = 0.1;
     static constexpr double ZOOM_MIN = 0.5;
     static constexpr double ZOOM_MAX = 3.0;
     static constexpr double DEFAULT_ZOOM = 1.0;
+    static constexpr double EDITOR_BASE_POINT_SIZE = 10.5;  // 100% 时编辑器的字号（96 DPI 下 14px）
 };
 
 #endif // MAINWINDOW_H
@@ -12,10 +12,18 @@
 #include <QInputDialog>
 #include <QStringList>
 #include <QDialog>
-#include <QGridLayout>
 #include <QPushButton>
-#include <QScrollArea>
+#include <QListView>
 #include <QLabel>
+#include <QLineEdit>
+#include <QKeyEvent>
+#include <QResizeEvent>
+#include <QVector>
+
+class DocumentSearch;
+class QCompleter;
+class EmojiModel;
+class EmojiUsageStore;
 
 /**
  * @brief 具有 Markdown 支持和图片粘贴功能的自定义文本编辑器
@@ -26,7 +34,12 @@
  * - 为粘贴的图片插入 Markdown 链接
  */
 /**
- * @brief 具有网格布局的自定义表情选择器对话框
+ * @brief 表情选择器对话框
+ *
+ * 基于 QListView + EmojiModel + EmojiDelegate：只有可见单元被绘制，
+ * 字形来自按 DPI 与字号缓存的图集，对话框本身只有少量部件。
+ * 顶部的搜索框按中英文名称与关键词过滤（EmojiSearchIndex），
+ * 结果与 "常用" 一行按使用频率和最近使用时间排序（EmojiUsageStore）。
  */
 class EmojiPickerDialog : public QDialog
 {
@@ -42,16 +55,34 @@ public:
      */
     QString selectedEmoji() const;
 
+    /**
+     * @brief 清除上次的选择后以模态方式显示（对话框会被复用）
+     */
+    int exec() override;
+
 private slots:
-    void onEmojiClicked();
+    void onEmojiActivated(const QModelIndex &index);
+    void onSearchTextChanged(const QString &text);
+    void onSearchReturnPressed();
 
 private:
     void setupUI();
-    QStringList getEmojiList() const;
+    QListView *createEmojiView(EmojiModel *model, const QString &objectName);
+
+    /**
+     * @brief 重新计算使用分数并刷新 "常用" 一行
+     */
+    void refreshUsage();
     
     QString m_selectedEmoji;
-    QGridLayout *m_gridLayout;
-    QScrollArea *m_scrollArea;
+    QLineEdit *m_searchEdit;
+    QLabel *m_recentLabel;
+    QListView *m_recentView;
+    QListView *m_view;
+    EmojiModel *m_recentModel;
+    EmojiModel *m_model;
+    EmojiUsageStore *m_usage;
+    QVector<float> m_usageScores;  // 按表格下标，打开对话框时计算
 };
 
 /**
@@ -70,6 +101,22 @@ public:
      */
     QPlainTextEdit* editor() const;
 
+    /**
+     * @brief 编辑器上方的格式工具栏
+     */
+    QToolBar* toolbar() const;
+
+    /**
+     * @brief 查找/替换栏（未激活时隐藏）
+     */
+    QWidget* findBar() const;
+
+signals:
+    /**
+     * @brief 表情选择对话框首次创建时发出，用于设置主题样式表
+     */
+    void emojiPickerCreated(QWidget *picker);
+
 private slots:
     void insertHeading();
     void insertBold();
@@ -84,6 +131,8 @@ private slots:
     void insertImage();
     void insertTable();
     void insertEmoji();
+    void showFind();
+    void showReplace();
 
 private:
     void setupToolbar();
@@ -92,6 +141,8 @@ private:
     QVBoxLayout *m_layout;
     QToolBar *m_toolbar;
     class MarkdownEditor *m_editor;
+    class FindReplaceBar *m_findBar;
+    EmojiPickerDialog *m_emojiDialog;  // 首次使用时创建，之后复用
 };
 
 /**
@@ -117,6 +168,18 @@ public:
      */
     QString imageSaveDirectory() const;
 
+    /**
+     * @brief 获取绑定到本编辑器文档的查找引擎
+     */
+    DocumentSearch* search() const;
+
+    /**
+     * @brief 将图片保存到磁盘并返回文件路径
+     * @param image 要保存的图片
+     * @return 保存图片的相对路径，失败时返回空字符串
+     */
+    QString saveImage(const QImage &image);
+
 protected:
     /**
      * @brief 检查 MIME 数据是否可以插入
@@ -131,13 +194,41 @@ protected:
      */
     void insertFromMimeData(const QMimeData *source) override;
 
+    void resizeEvent(QResizeEvent *event) override;
+
+    /**
+     * @brief 在输入 ":前缀" 时弹出表情短代码补全
+     */
+    void keyPressEvent(QKeyEvent *event) override;
+
+    /**
+     * @brief 输入法提交的文本同样计入键入延迟
+     */
+    void inputMethodEvent(QInputMethodEvent *event) override;
+
+    /**
+     * @brief 绘制完成后通知 LatencyMonitor，结束"输入到绘制"的计时
+     */
+    void paintEvent(QPaintEvent *event) override;
+
+private slots:
+    void insertShortcode(const QModelIndex &index);
+
 private:
     /**
-     * @brief 将图片保存到磁盘并返回文件路径
-     * @param image 要保存的图片
-     * @return 保存图片的相对路径，失败时返回空字符串
+     * @brief 短代码补全器，首次输入冒号时创建
      */
-    QString saveImage(const QImage &image);
+    QCompleter *shortcodeCompleter();
+
+    /**
+     * @brief 光标前正在输入的短代码前缀（不含冒号），不在短代码中时返回空
+     */
+    QString shortcodePrefix() const;
+
+    /**
+     * @brief 只为视口内可见的匹配生成高亮
+     */
+    void updateSearchHighlights();
 
     /**
      * @brief 为图片生成唯一文件名
@@ -152,6 +243,49 @@ private:
     bool ensureImageDirectoryExists();
 
     QString m_imageSaveDir;  ///< 图片保存的目录
+    DocumentSearch *m_search;  ///< 文档查找/替换引擎
+    QCompleter *m_shortcodeCompleter;  ///< 表情短代码补全
+};
+
+/**
+ * @brief 编辑器上方的查找/替换栏
+ */
+class FindReplaceBar : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit FindReplaceBar(MarkdownEditor *editor, QWidget *parent = nullptr);
+    ~FindReplaceBar() override;
+
+    /**
+     * @brief 显示查找栏并聚焦输入框
+     * @param withReplace 是否同时显示替换行
+     */
+    void activate(bool withReplace);
+
+protected:
+    void keyPressEvent(QKeyEvent *event) override;
+
+private slots:
+    void updateQuery();
+    void findNext();
+    void findPrevious();
+    void replaceCurrent();
+    void replaceAll();
+    void updateStatus();
+
+private:
+    void selectMatch(int index);
+    int currentMatchIndex() const;
+
+    MarkdownEditor *m_editor;
+    QLineEdit *m_findEdit;
+    QLineEdit *m_replaceEdit;
+    QPushButton *m_caseButton;
+    QPushButton *m_regexButton;
+    QLabel *m_statusLabel;
+    QWidget *m_replaceRow;
 };
 
 #endif // MARKDOWNEDITOR_H
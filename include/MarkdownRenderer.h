@@ -0,0 +1,54 @@
+#ifndef MARKDOWNRENDERER_H
+#define MARKDOWNRENDERER_H
+
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief 将 Markdown 转换为预览 HTML 的渲染器
+ *
+ * 只依赖 QtCore，不持有任何状态，可以在 MainWindow 之外、
+ * 在无界面环境以及多个工作线程中同时使用。
+ */
+class MarkdownRenderer
+{
+public:
+    MarkdownRenderer() = delete;
+
+    /**
+     * @brief 渲染完整的预览文档（样式前导 + 正文）
+     * @param markdown Markdown 源文本
+     * @param isDark 是否使用深色主题配色
+     * @return 可直接交给 QTextBrowser::setHtml 的 HTML
+     */
+    static QString renderDocument(const QString &markdown, bool isDark);
+
+    /**
+     * @brief 只渲染正文部分，不包含 <style> 前导
+     */
+    static QString renderBody(const QString &markdown);
+
+    /**
+     * @brief 获取指定主题的 CSS 样式前导（按主题缓存）
+     */
+    static const QString &stylePrelude(bool isDark);
+
+    /**
+     * @brief 样式前导使用的颜色（#rrggbb，取自 ThemeTokens），两个主题按相同顺序排列
+     */
+    static const QStringList &themeColors(bool isDark);
+
+    /**
+     * @brief 处理行内 Markdown 语法（粗体、斜体、代码、链接、表情短代码等）
+     * @param text 已去除块级标记的行文本
+     * @return 转义并替换后的 HTML 片段
+     */
+    static QString processInline(const QString &text);
+
+    /**
+     * @brief 标题锚点名称（<a name>），按标题所在的源文本行号（从 0 开始）命名
+     */
+    static QString headingAnchor(int lineNumber);
+};
+
+#endif // MARKDOWNRENDERER_H
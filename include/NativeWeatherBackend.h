@@ -0,0 +1,89 @@
+#ifndef NATIVEWEATHERBACKEND_H
+#define NATIVEWEATHERBACKEND_H
+
+#include "WeatherBackend.h"
+#include <QHash>
+#include <QList>
+#include <QUrl>
+#include <QVector>
+
+class QNetworkAccessManager;
+class QNetworkReply;
+
+/**
+ * @brief 直接在 C++ 中访问 Open-Meteo 的天气后端
+ *
+ * 所有请求共用一个 QNetworkAccessManager，同一主机的连接在请求之间保持
+ * keep-alive（服务器支持时使用 HTTP/2 多路复用），不需要 Python 运行时。
+ * 城市坐标与 Python 后端共用同一个地理编码表，响应格式与 weather_service.py 一致。
+ *
+ * 接口地址可通过环境变量 OPEN_METEO_GEOCODING_URL / OPEN_METEO_FORECAST_URL 覆盖，
+ * 便于指向本地的替身服务器（python/open_meteo_stub_server.py）。
+ */
+class NativeWeatherBackend : public WeatherBackend
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @param geocodeTablePath 地理编码表（城市名小写 -> {name, latitude, longitude}）
+     */
+    explicit NativeWeatherBackend(const QString &geocodeTablePath, QObject *parent = nullptr);
+    ~NativeWeatherBackend() override;
+
+    int requestWeather(const QString &city) override;
+    int requestWeatherBatch(const QStringList &cities) override;
+    void cancel(int requestId) override;
+    int ping() override;
+    void stop(const QString &reason) override;
+    int pendingCount() const override;
+    bool isRunning() const override;
+
+    /**
+     * @brief 地理编码表的位置：环境变量 WEATHER_GEOCODE_TABLE，否则为程序目录下的 python/geocode_cache.json
+     */
+    static QString defaultGeocodeTablePath();
+
+    /**
+     * @brief 命令行查询模式：WeatherApp --weather [--batch] <城市>...
+     *
+     * 每个结果以一行 JSON 写到 stdout；不带 --batch 时逐个城市依次请求。
+     * @return 进程退出码（全部成功为 0）
+     */
+    static int runFromCommandLine(const QStringList &arguments);
+
+private:
+    struct PendingRequest
+    {
+        QStringList cities;
+        bool batch;
+        QVector<QJsonObject> locations;  // 已解析的坐标，空对象表示尚未解析或解析失败
+        QVector<QJsonObject> results;    // 地理编码失败的城市在这里放入错误结果
+        int unresolved;
+        QList<QNetworkReply *> replies;
+    };
+
+    int startRequest(const QStringList &cities, bool batch);
+    QNetworkReply *get(const QUrl &url, int requestId);
+    void resolveCity(int requestId, int index);
+    void onGeocodeFinished(int requestId, int index, QNetworkReply *reply);
+    void fetchForecast(int requestId);
+    void onForecastFinished(int requestId, const QVector<int> &indexes, QNetworkReply *reply);
+    void finishRequest(int requestId);
+    void abortReplies(PendingRequest &request);
+    void failLater(int requestId, const QString &error);
+
+    QJsonObject lookupLocation(const QString &city);
+    void storeLocation(const QString &city, const QJsonObject &location);
+
+    QNetworkAccessManager *m_network;
+    QUrl m_geocodingUrl;
+    QUrl m_forecastUrl;
+    QString m_geocodeTablePath;
+    bool m_geocodeTableLoaded;
+    QJsonObject m_geocodeTable;
+    QHash<int, PendingRequest> m_pending;
+    int m_nextRequestId;
+};
+
+#endif // NATIVEWEATHERBACKEND_H
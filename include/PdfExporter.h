@@ -0,0 +1,80 @@
+#ifndef PDFEXPORTER_H
+#define PDFEXPORTER_H
+
+#include <QByteArray>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QTextDocument>
+#include <QThread>
+#include <atomic>
+
+/**
+ * @brief 在后台线程中把预览文档导出为 PDF
+ *
+ * 调用线程只负责克隆文档并复制其中图片的资源，分页、排版和绘制都在工作线程中进行，
+ * 逐页报告进度并可随时取消。导出结果按文档内容与页面参数的哈希缓存，
+ * 未修改的文档再次导出时直接写出缓存的 PDF。
+ */
+class PdfExporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PdfExporter(QObject *parent = nullptr);
+    ~PdfExporter() override;
+
+    /**
+     * @brief 开始导出
+     * @param document 要导出的文档（在调用线程中克隆，之后不再访问）；
+     *        其中的图片通过 document->resource() 取得，例如 QTextBrowser 已加载的图片
+     * @param filePath 目标 PDF 路径
+     * @return 已有导出任务在运行时返回 false
+     */
+    bool start(const QTextDocument *document, const QString &filePath);
+
+    /**
+     * @brief 请求取消当前导出，在排版或当前页绘制完成后生效
+     */
+    void cancel();
+
+    bool isRunning() const;
+
+signals:
+    /**
+     * @brief 已完成的页数
+     */
+    void progress(int page, int pageCount);
+
+    /**
+     * @brief 导出结束（成功、失败或取消）
+     * @param ok 是否成功写出文件
+     * @param filePath 目标路径
+     * @param error 失败原因，成功时为空
+     */
+    void finished(bool ok, const QString &filePath, const QString &error);
+
+private:
+    /**
+     * @brief 已缓存的导出结果
+     */
+    struct CachedPdf
+    {
+        QByteArray key;
+        QByteArray data;
+        int pageCount;
+    };
+
+    void exportInThread(QTextDocument *document, const QString &filePath);
+    bool lookupCache(const QByteArray &key, CachedPdf *entry);
+    void storeCache(const CachedPdf &entry);
+    bool writeFile(const QString &filePath, const QByteArray &data, QString *error) const;
+
+    QThread *m_thread;
+    std::atomic<bool> m_cancelled;
+    QMutex m_cacheMutex;
+    QList<CachedPdf> m_cache;  ///< 最近使用的在前
+};
+
+#endif // PDFEXPORTER_H
@@ -0,0 +1,42 @@
+#ifndef PREVIEWSNAPSHOTCACHE_H
+#define PREVIEWSNAPSHOTCACHE_H
+
+#include <QByteArray>
+#include <QString>
+
+/**
+ * @brief 磁盘上的预览快照缓存
+ *
+ * 以"文件原始字节 + 主题"的哈希为键，保存压缩后的预览 HTML。
+ * 启动时若磁盘文件未变化，可直接显示上次的预览而无需重新渲染。
+ * 损坏或版本不符的快照按未命中处理。
+ */
+class PreviewSnapshotCache
+{
+public:
+    explicit PreviewSnapshotCache(const QString &directory);
+
+    /**
+     * @brief 根据文件内容与主题计算快照键
+     */
+    static QByteArray keyFor(const QByteArray &fileData, const QString &theme);
+
+    /**
+     * @brief 读取快照
+     * @return 预览 HTML，未命中时为空
+     */
+    QString load(const QByteArray &key) const;
+
+    /**
+     * @brief 写入快照，并清理超出数量上限的旧快照
+     */
+    bool store(const QByteArray &key, const QString &html) const;
+
+private:
+    QString pathFor(const QByteArray &key) const;
+    void prune() const;
+
+    QString m_directory;
+};
+
+#endif // PREVIEWSNAPSHOTCACHE_H
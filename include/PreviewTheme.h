@@ -0,0 +1,26 @@
+#ifndef PREVIEWTHEME_H
+#define PREVIEWTHEME_H
+
+class QTextDocument;
+
+/**
+ * @brief 切换主题时就地替换预览文档的配色
+ *
+ * QTextDocument 在解析 HTML 时把 CSS 颜色写进各个文本格式，之后不再引用
+ * 样式表或调色板，因此换色只能修改格式。这里按颜色值把一个主题的前导颜色
+ * （MarkdownRenderer::themeColors）替换为另一个主题的对应颜色，不重新解析
+ * HTML，也不重新渲染 Markdown；修改集中在一个编辑块中，文档只重新布局一次。
+ */
+class PreviewTheme
+{
+public:
+    PreviewTheme() = delete;
+
+    /**
+     * @brief 把文档中旧主题的颜色替换为新主题的颜色
+     * @return 修改过的格式数量
+     */
+    static int recolor(QTextDocument *document, bool wasDark, bool isDark);
+};
+
+#endif // PREVIEWTHEME_H
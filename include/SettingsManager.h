@@ -1,21 +1,37 @@
 #ifndef SETTINGSMANAGER_H
 #define SETTINGSMANAGER_H
 
-#include <QSettings>
-#include <QString>
-#include <QCoreApplication>
-#include <QDir>
+#include "SettingsSchema.h"
+#include <QHash>
 #include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QThreadPool>
+#include <QVariant>
+#include <atomic>
+#include <memory>
+
+class QTimer;
 
 /**
- * @brief 管理应用程序设置的单例类
- * 
- * 此类提供对应用程序配置的集中访问，
- * 使用 INI 格式的 QSettings。它确保线程安全访问，
- * 并为常见的设置操作提供便捷方法。
+ * @brief 管理应用程序设置的单例类，程序中唯一访问 config.ini 的地方
+ *
+ * 启动时把 INI 文件整个读入内存缓存，之后的读取只查缓存，不再经过 QSettings。
+ * 写入先更新缓存并发出 valueChanged，再合并到待写队列：短时间内的多次写入
+ * 在后台线程中一次落盘（按提交顺序执行）。sync() 立即写入并等待完成，
+ * 程序退出前会自动调用。
+ *
+ * 读取不加锁：缓存是一份不可变快照，写入时复制出新快照并原子地发布（RCU 式），
+ * 读线程在线程局部变量中持有当前快照，版本号未变时直接使用，既不加锁也不分配内存。
+ * 写入之间由互斥量串行化。所有方法都可在任意线程调用。
+ *
+ * SettingsSchema.h 中声明的设置项通过 get<Key>()/set<Key>() 类型化访问；
+ * getValue/setValue 用于模式之外的键。
  */
-class SettingsManager
+class SettingsManager : public QObject
 {
+    Q_OBJECT
+
 public:
     // 删除拷贝构造函数和赋值运算符
     SettingsManager(const SettingsManager&) = delete;
@@ -27,6 +43,13 @@ public:
      */
     static SettingsManager& instance();
 
+    /**
+     * @brief 使用指定的设置文件构造独立实例，供基准与测试使用（程序中只用 instance()）
+     * @param filePath INI 文件路径
+     */
+    explicit SettingsManager(const QString& filePath);
+    ~SettingsManager() override;
+
     /**
      * @brief 获取设置值
      * @param key 设置键
@@ -36,7 +59,7 @@ public:
     QVariant getValue(const QString& key, const QVariant& defaultValue = QVariant()) const;
 
     /**
-     * @brief 设置设置值
+     * @brief 设置设置值（值未改变时不写入也不发出信号）
      * @param key 设置键
      * @param value 设置值
      */
@@ -50,41 +73,76 @@ public:
     bool contains(const QString& key) const;
 
     /**
-     * @brief 移除设置
+     * @brief 移除设置（包括以 key/ 开头的子键）
      * @param key 设置键
      */
     void remove(const QString& key);
 
     /**
-     * @brief 将设置同步到磁盘
+     * @brief 立即把待写入的修改同步到磁盘，并等待写入完成
      */
     void sync();
 
-    // 常见设置的便捷方法
-    QString getTheme() const;
-    void setTheme(const QString& theme);
-
-    QString getDefaultCity() const;
-    void setDefaultCity(const QString& city);
-
-    QByteArray getWindowGeometry() const;
-    void setWindowGeometry(const QByteArray& geometry);
-
-    QByteArray getWindowState() const;
-    void setWindowState(const QByteArray& state);
-
-    int getPythonRestartAttempts() const;
-    void setPythonRestartAttempts(int attempts);
+    /**
+     * @brief 读取模式中的设置项，例如 get<Settings::Key::Zoom>()
+     *
+     * 编译期确定元组下标，不做字符串查找；文件中缺失或无效的值已替换为默认值。
+     */
+    template <Settings::Key K>
+    typename Settings::KeySpec<K>::Type get() const
+    {
+        return std::get<std::size_t(K)>(snapshot().typed);
+    }
 
-    int getPythonRestartDelay() const;
-    void setPythonRestartDelay(int delayMs);
+    /**
+     * @brief 写入模式中的设置项；未通过校验的值被拒绝并返回 false
+     */
+    template <Settings::Key K>
+    bool set(const typename Settings::KeySpec<K>::Type& value)
+    {
+        using Spec = Settings::KeySpec<K>;
+        if (!Spec::isValid(value)) {
+            warnInvalid(Spec::name, QVariant::fromValue(value));
+            return false;
+        }
+        setValue(QString::fromLatin1(Spec::name), QVariant::fromValue(value));
+        return true;
+    }
+
+signals:
+    /**
+     * @brief 设置值改变（在调用 setValue/remove 的线程中发出；移除时 value 无效）
+     */
+    void valueChanged(const QString& key, const QVariant& value);
 
 private:
     SettingsManager();
-    ~SettingsManager();
 
-    QSettings* m_settings;
-    mutable QMutex m_mutex;
+    /**
+     * @brief 某一时刻的全部设置；发布后不再修改
+     */
+    struct Snapshot
+    {
+        quint64 version = 0;
+        QHash<QString, QVariant> values;
+        Settings::Values typed;  // 模式中各项的类型化值，随快照一起发布
+    };
+
+    const Snapshot& snapshot() const;
+    void publish(Snapshot* next);
+    static void updateTypedCache(Snapshot* snapshot, const QString& key, const QVariant& value);
+    static void warnInvalid(const char* name, const QVariant& value);
+    void scheduleWrite();
+    void flushPendingWrites();
+
+    QString m_filePath;
+    std::shared_ptr<const Snapshot> m_snapshot;  // 只通过 std::atomic_load/atomic_store 访问
+    std::atomic<quint64> m_version;
+    QHash<QString, QVariant> m_pendingWrites;  // 无效的 QVariant 表示删除
+    QMutex m_mutex;  // 串行化写入并保护 m_pendingWrites
+
+    QTimer* m_writeTimer;
+    QThreadPool m_writer;  // 单线程，保证写入顺序
 };
 
 #endif // SETTINGSMANAGER_H
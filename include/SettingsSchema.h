@@ -0,0 +1,238 @@
+#ifndef SETTINGSSCHEMA_H
+#define SETTINGSSCHEMA_H
+
+#include <QByteArray>
+#include <QString>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+/**
+ * @brief config.ini 的编译期模式
+ *
+ * 每个设置项是 Key 中的一个枚举值，KeySpec<Key> 给出它在 INI 中的键名、
+ * 静态类型、默认值与校验函数。SettingsManager::get<Key::Zoom>() 在编译期
+ * 解析为 Values 元组中的固定位置，运行时不做字符串查找；拼错的键名是编译错误。
+ *
+ * 新增设置项：在 Key 中 Count 之前添加枚举值，并特化 KeySpec。
+ */
+namespace Settings {
+
+enum class Key : std::size_t {
+    Theme,
+    DefaultCity,
+    Zoom,
+    WindowGeometry,
+    WindowState,
+    PythonRestartAttempts,
+    PythonRestartDelay,
+    WeatherBackend,
+    WeatherCacheTtl,
+    WeatherRefreshInterval,
+    LatencyHud,
+    SessionFile,
+    SessionCursor,
+    SessionEditorScroll,
+    SessionPreviewScroll,
+    Count
+};
+
+constexpr std::size_t kKeyCount = std::size_t(Key::Count);
+
+template <Key K>
+struct KeySpec;
+
+template <>
+struct KeySpec<Key::Theme>
+{
+    using Type = QString;
+    static constexpr const char *name = "theme";
+    static Type defaultValue() { return QStringLiteral("dark"); }
+    static bool isValid(const Type &value) { return value == QLatin1String("dark") || value == QLatin1String("light"); }
+};
+
+template <>
+struct KeySpec<Key::DefaultCity>
+{
+    using Type = QString;
+    static constexpr const char *name = "defaultCity";
+    static Type defaultValue() { return QStringLiteral("Beijing"); }
+    static bool isValid(const Type &value) { return !value.trimmed().isEmpty(); }
+};
+
+template <>
+struct KeySpec<Key::Zoom>
+{
+    using Type = double;
+    static constexpr const char *name = "zoomLevel";
+    static constexpr Type defaultValue() { return 1.0; }
+    static constexpr bool isValid(Type value) { return value >= 0.5 && value <= 3.0; }
+};
+
+template <>
+struct KeySpec<Key::WindowGeometry>
+{
+    using Type = QByteArray;
+    static constexpr const char *name = "geometry";
+    static Type defaultValue() { return QByteArray(); }
+    static bool isValid(const Type &) { return true; }
+};
+
+template <>
+struct KeySpec<Key::WindowState>
+{
+    using Type = QByteArray;
+    static constexpr const char *name = "windowState";
+    static Type defaultValue() { return QByteArray(); }
+    static bool isValid(const Type &) { return true; }
+};
+
+template <>
+struct KeySpec<Key::PythonRestartAttempts>
+{
+    using Type = int;
+    static constexpr const char *name = "pythonRestartAttempts";
+    static constexpr Type defaultValue() { return 3; }
+    static constexpr bool isValid(Type value) { return value >= 1 && value <= 100; }
+};
+
+template <>
+struct KeySpec<Key::PythonRestartDelay>
+{
+    using Type = int;
+    static constexpr const char *name = "pythonRestartDelay";  // 毫秒
+    static constexpr Type defaultValue() { return 2000; }
+    static constexpr bool isValid(Type value) { return value >= 100 && value <= 10 * 60 * 1000; }
+};
+
+template <>
+struct KeySpec<Key::WeatherBackend>
+{
+    using Type = QString;
+    static constexpr const char *name = "weatherBackend";
+    static Type defaultValue() { return QStringLiteral("python"); }
+    static bool isValid(const Type &value) { return value == QLatin1String("python") || value == QLatin1String("native"); }
+};
+
+template <>
+struct KeySpec<Key::WeatherCacheTtl>
+{
+    using Type = int;
+    static constexpr const char *name = "weatherCacheTtl";  // 秒
+    static constexpr Type defaultValue() { return 600; }
+    static constexpr bool isValid(Type value) { return value >= 0 && value <= 7 * 24 * 3600; }
+};
+
+template <>
+struct KeySpec<Key::WeatherRefreshInterval>
+{
+    using Type = int;
+    static constexpr const char *name = "weatherRefreshInterval";  // 秒
+    static constexpr Type defaultValue() { return 15 * 60; }
+    static constexpr bool isValid(Type value) { return value >= 60 && value <= 24 * 3600; }
+};
+
+template <>
+struct KeySpec<Key::LatencyHud>
+{
+    using Type = bool;
+    static constexpr const char *name = "latencyHud";
+    static constexpr Type defaultValue() { return false; }
+    static constexpr bool isValid(Type) { return true; }
+};
+
+template <>
+struct KeySpec<Key::SessionFile>
+{
+    using Type = QString;
+    static constexpr const char *name = "session/file";
+    static Type defaultValue() { return QString(); }
+    static bool isValid(const Type &) { return true; }
+};
+
+template <>
+struct KeySpec<Key::SessionCursor>
+{
+    using Type = int;
+    static constexpr const char *name = "session/cursor";
+    static constexpr Type defaultValue() { return 0; }
+    static constexpr bool isValid(Type value) { return value >= 0; }
+};
+
+template <>
+struct KeySpec<Key::SessionEditorScroll>
+{
+    using Type = int;
+    static constexpr const char *name = "session/editorScroll";
+    static constexpr Type defaultValue() { return 0; }
+    static constexpr bool isValid(Type value) { return value >= 0; }
+};
+
+template <>
+struct KeySpec<Key::SessionPreviewScroll>
+{
+    using Type = int;
+    static constexpr const char *name = "session/previewScroll";
+    static constexpr Type defaultValue() { return 0; }
+    static constexpr bool isValid(Type value) { return value >= 0; }
+};
+
+namespace detail {
+
+template <std::size_t... I>
+std::tuple<typename KeySpec<Key(I)>::Type...> valuesFor(std::index_sequence<I...>);
+
+template <std::size_t... I>
+constexpr std::array<const char *, sizeof...(I)> namesFor(std::index_sequence<I...>)
+{
+    return {KeySpec<Key(I)>::name...};
+}
+
+constexpr bool equal(const char *a, const char *b)
+{
+    while (*a && *a == *b) {
+        ++a;
+        ++b;
+    }
+    return *a == *b;
+}
+
+constexpr bool namesAreUnique(const std::array<const char *, kKeyCount> &names)
+{
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        for (std::size_t j = i + 1; j < names.size(); ++j) {
+            if (equal(names[i], names[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+/**
+ * @brief 所有设置项的类型化值，按 Key 的顺序排列
+ */
+using Values = decltype(detail::valuesFor(std::make_index_sequence<kKeyCount>()));
+
+/**
+ * @brief 按 Key 顺序排列的 INI 键名，供从文件加载时把字符串映射回 Key
+ */
+constexpr std::array<const char *, kKeyCount> kKeyNames = detail::namesFor(std::make_index_sequence<kKeyCount>());
+
+static_assert(detail::namesAreUnique(kKeyNames), "duplicate settings key name");
+static_assert(KeySpec<Key::Zoom>::isValid(KeySpec<Key::Zoom>::defaultValue()), "invalid default zoom");
+static_assert(KeySpec<Key::PythonRestartAttempts>::isValid(KeySpec<Key::PythonRestartAttempts>::defaultValue()),
+              "invalid default restart attempts");
+static_assert(KeySpec<Key::PythonRestartDelay>::isValid(KeySpec<Key::PythonRestartDelay>::defaultValue()),
+              "invalid default restart delay");
+static_assert(KeySpec<Key::WeatherCacheTtl>::isValid(KeySpec<Key::WeatherCacheTtl>::defaultValue()),
+              "invalid default cache TTL");
+static_assert(KeySpec<Key::WeatherRefreshInterval>::isValid(KeySpec<Key::WeatherRefreshInterval>::defaultValue()),
+              "invalid default refresh interval");
+
+} // namespace Settings
+
+#endif // SETTINGSSCHEMA_H
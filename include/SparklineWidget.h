@@ -0,0 +1,34 @@
+#ifndef SPARKLINEWIDGET_H
+#define SPARKLINEWIDGET_H
+
+#include "WeatherHistoryStore.h"
+#include <QVector>
+#include <QWidget>
+
+/**
+ * @brief 温度迷你走势图
+ *
+ * 每个桶画出最低到最高温度的区间带，并用折线连接区间中点；没有数据的桶留空。
+ * 颜色取自前景色（QSS 中的 color 属性）。
+ */
+class SparklineWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit SparklineWidget(QWidget *parent = nullptr);
+
+    void setBuckets(const QVector<WeatherHistoryStore::Bucket> &buckets);
+
+    QSize sizeHint() const override;
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    QVector<WeatherHistoryStore::Bucket> m_buckets;
+    float m_min;
+    float m_max;
+};
+
+#endif // SPARKLINEWIDGET_H
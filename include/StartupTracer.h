@@ -0,0 +1,62 @@
+#ifndef STARTUPTRACER_H
+#define STARTUPTRACER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QVector>
+
+class QWidget;
+
+/**
+ * @brief 记录启动各阶段的时间戳
+ *
+ * 计时从 main() 调用 begin() 开始，各阶段通过 mark() 打点。
+ * 首次绘制与"首次可编辑"由 watchFirstPaint() 自动记录：被监视的部件
+ * 第一次收到 Paint 事件即为首次绘制，之后事件循环首次空闲即为可编辑时刻。
+ * 使用 --trace-startup 参数或设置 MDCODER_TRACE_STARTUP 环境变量时，
+ * 可编辑后把各阶段耗时输出到 stderr。
+ */
+class StartupTracer : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 开始计时并根据命令行/环境变量决定是否输出报告
+     */
+    static void begin(int argc, char *argv[]);
+
+    /**
+     * @brief 记录一个阶段的结束时刻
+     * @param phase 阶段名称（须为字符串字面量）
+     */
+    static void mark(const char *phase);
+
+    /**
+     * @brief 监视部件的首次绘制，并在其后记录首次可编辑时刻
+     */
+    static void watchFirstPaint(QWidget *widget);
+
+    static bool isEnabled();
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    struct Phase
+    {
+        const char *name;
+        qint64 elapsedNs;
+    };
+
+    StartupTracer() = default;
+    static StartupTracer &instance();
+    void printReport() const;
+
+    QElapsedTimer m_timer;
+    QVector<Phase> m_phases;
+    bool m_enabled = false;
+    bool m_finished = false;
+};
+
+#endif // STARTUPTRACER_H
@@ -0,0 +1,101 @@
+#ifndef THEMEMANAGER_H
+#define THEMEMANAGER_H
+
+#include <QColor>
+#include <QHash>
+#include <QObject>
+#include <QPalette>
+#include <QPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class QWidget;
+
+/**
+ * @brief 基于命名颜色令牌的主题引擎
+ *
+ * 每个主题是一组令牌（accent、surface、border……）的取值，由令牌生成
+ * QPalette。窗口级样式表 resources/styles/base.qss 不含颜色，启动时设置
+ * 一次；大部分部件按调色板绘制，切换主题只需 QApplication::setPalette。
+ * 少数需要样式表颜色的部件使用 resources/styles/theme.qss 中与其对象名
+ * 同名的一节：模板只解析一次，每个主题展开一次后缓存，切换时只重新
+ * 设置到这些部件上，不会重新 polish 整个窗口。令牌取值见 ThemeTokens.h。
+ */
+class ThemeManager : public QObject
+{
+    Q_OBJECT
+
+public:
+    ThemeManager(const ThemeManager &) = delete;
+    ThemeManager &operator=(const ThemeManager &) = delete;
+
+    static ThemeManager &instance();
+
+    /**
+     * @brief 所有可用主题的名称（第一个为默认主题）
+     */
+    static const QStringList &themeNames();
+
+    const QString &currentTheme() const;
+    bool isDark() const;
+
+    /**
+     * @brief 当前主题中令牌的颜色；未知令牌返回无效颜色
+     */
+    QColor color(const QString &token) const;
+
+    /**
+     * @brief 与主题无关的窗口级样式表，由顶层窗口在启动时设置一次
+     */
+    const QString &baseStyleSheet() const;
+
+    /**
+     * @brief 让部件使用 theme.qss 中与其对象名同名的一节
+     *
+     * 立即设置当前主题的样式表，之后每次切换主题时更新；部件销毁后自动忽略。
+     */
+    void addStyleTarget(QWidget *widget);
+
+    /**
+     * @brief 把主题应用到应用程序调色板与已注册部件的样式表，然后发出 themeChanged
+     * @param name 主题名称，未知名称回退到默认主题
+     * @return 同步部分的耗时（毫秒），不含之后的重绘；主题未变时直接返回 0
+     */
+    double apply(const QString &name);
+
+signals:
+    void themeChanged(const QString &name);
+
+private:
+    struct Theme
+    {
+        QHash<QString, QString> tokens;
+        QPalette palette;
+        QHash<QString, QString> styleSheets;  // 对象名 -> 展开后的一节
+    };
+
+    // 模板片段：普通文本或令牌名
+    struct Segment
+    {
+        QString text;
+        bool isToken;
+    };
+
+    ThemeManager();
+
+    const Theme &theme(const QString &name);
+    void loadTemplate();
+    void applyStyleSheet(QWidget *widget) const;
+    QString expandTemplate(const QString &name, const QVector<Segment> &segments,
+                           const QHash<QString, QString> &tokens) const;
+    static QPalette buildPalette(const QHash<QString, QString> &tokens);
+
+    QString m_baseStyleSheet;
+    QHash<QString, QVector<Segment>> m_template;  // 对象名 -> 该节的片段
+    QHash<QString, Theme> m_themes;
+    QVector<QPointer<QWidget>> m_targets;
+    QString m_current;
+};
+
+#endif // THEMEMANAGER_H
@@ -0,0 +1,56 @@
+#ifndef THEMETOKENS_H
+#define THEMETOKENS_H
+
+#include <QByteArray>
+
+/**
+ * @brief 主题令牌的取值表
+ *
+ * ThemeManager 用它生成调色板与样式表，MarkdownRenderer 用它生成预览的
+ * 样式前导，界面与预览因此共用一份颜色。只依赖 QtCore，可在工作线程中使用。
+ */
+namespace ThemeTokens {
+
+// 每列对应 ThemeManager::themeNames() 中的一个主题
+struct Token
+{
+    const char *name;
+    const char *dark;
+    const char *light;
+};
+
+inline constexpr Token kTokens[] = {
+    {"window",             "#0a0a0a", "#f5f5f7"},
+    {"surface",            "#1a1a1a", "#ffffff"},
+    {"surfaceRaised",      "#2d2d2d", "#e8e8ed"},
+    {"border",             "#2d2d2d", "#d2d2d7"},
+    {"hover",              "#3d3d3d", "#d2d2d7"},
+    {"pressed",            "#1d1d1d", "#c1c1c6"},
+    {"text",               "#ffffff", "#1d1d1f"},
+    {"textSecondary",      "#aaaaaa", "#86868b"},
+    {"disabledText",       "#666666", "#86868b"},
+    {"disabledBackground", "#1d1d1d", "#f5f5f7"},
+    {"accent",             "#00d4ff", "#0071e3"},
+    {"accentSoft",         "#5dade2", "#0071e3"},
+    {"accentText",         "#000000", "#ffffff"},
+    // 只用于预览
+    {"inlineCode",         "#2a2a2a", "#e8e8ed"},
+    {"tableStripe",        "#0f0f0f", "#f9f9fb"},
+};
+
+/**
+ * @brief 令牌在深色或浅色主题中的颜色（#rrggbb）；未知令牌返回 nullptr
+ */
+inline const char *value(const char *name, bool isDark)
+{
+    for (const Token &token : kTokens) {
+        if (qstrcmp(token.name, name) == 0) {
+            return isDark ? token.dark : token.light;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace ThemeTokens
+
+#endif // THEMETOKENS_H
@@ -0,0 +1,77 @@
+#ifndef WEATHERBACKEND_H
+#define WEATHERBACKEND_H
+
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief 天气数据后端的公共接口
+ *
+ * 请求立即返回一个 id，结果通过信号异步返回（失败通知也总是异步的）。
+ * 单城市响应与 weather_service.py 的输出格式相同；批量响应为
+ * {"status": "success", "results": [...]}，每项带 "query" 字段。
+ */
+class WeatherBackend : public QObject
+{
+    Q_OBJECT
+
+public:
+    using QObject::QObject;
+    ~WeatherBackend() override = default;
+
+    /**
+     * @brief 查询单个城市
+     * @return 请求 id
+     */
+    virtual int requestWeather(const QString &city) = 0;
+
+    /**
+     * @brief 一次 HTTP 请求查询多个城市
+     * @return 请求 id
+     */
+    virtual int requestWeatherBatch(const QStringList &cities) = 0;
+
+    /**
+     * @brief 放弃一个未完成的请求，之后不会再收到它的结果
+     */
+    virtual void cancel(int requestId) = 0;
+
+    /**
+     * @brief 心跳：后端健康时以 {"status": "success", "pong": true} 经 weatherReady 响应
+     *
+     * Python 后端未运行时会先启动进程，可用于预热。
+     * @return 请求 id
+     */
+    virtual int ping() = 0;
+
+    /**
+     * @brief 中止所有未完成的请求（不阻塞），它们以 reason 失败结束
+     */
+    virtual void stop(const QString &reason) = 0;
+
+    /**
+     * @brief 尚未返回结果的请求数（不含已取消的）
+     */
+    virtual int pendingCount() const = 0;
+
+    /**
+     * @brief 后端当前是否处于可立即响应的状态
+     */
+    virtual bool isRunning() const = 0;
+
+signals:
+    /**
+     * @brief 请求已发出（在 request*/ping 返回之前同步发出）
+     */
+    void requestStarted(int requestId);
+
+    /**
+     * @brief 收到响应（status 字段可能为 "error"，由调用方处理）
+     */
+    void weatherReady(int requestId, const QJsonObject &data);
+    void requestFailed(int requestId, const QString &error);
+};
+
+#endif // WEATHERBACKEND_H
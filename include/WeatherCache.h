@@ -0,0 +1,66 @@
+#ifndef WEATHERCACHE_H
+#define WEATHERCACHE_H
+
+#include <QDateTime>
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+
+class QTimer;
+
+/**
+ * @brief 两级天气缓存：内存 + 磁盘上的 JSON 文件
+ *
+ * 每个城市只保留最近一次成功的响应及其获取时间。超过 TTL 的条目仍可读取
+ * （用于先显示旧值、同时在后台刷新），由调用方通过 isFresh() 决定是否需要重新获取。
+ * 写入在内存中立即生效，磁盘文件在短暂延迟后合并写入。
+ */
+class WeatherCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief 缓存条目
+     */
+    struct Entry
+    {
+        QJsonObject data;
+        QDateTime fetchedAt;
+    };
+
+    WeatherCache(const QString &filePath, int ttlSeconds, QObject *parent = nullptr);
+    ~WeatherCache() override;
+
+    /**
+     * @brief 查找城市的缓存值（无论是否过期）
+     */
+    bool lookup(const QString &city, Entry *entry);
+
+    /**
+     * @brief 条目是否仍在 TTL 之内
+     */
+    bool isFresh(const Entry &entry) const;
+
+    /**
+     * @brief 保存一次成功的响应
+     */
+    void store(const QString &city, const QJsonObject &data);
+
+    /**
+     * @brief 立即把未写入的修改保存到磁盘
+     */
+    void flush();
+
+private:
+    void ensureLoaded();
+
+    QString m_filePath;
+    int m_ttlSeconds;
+    bool m_loaded;
+    QHash<QString, Entry> m_entries;
+    QTimer *m_saveTimer;
+};
+
+#endif // WEATHERCACHE_H
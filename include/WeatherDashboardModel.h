@@ -0,0 +1,65 @@
+#ifndef WEATHERDASHBOARDMODEL_H
+#define WEATHERDASHBOARDMODEL_H
+
+#include <QAbstractTableModel>
+#include <QDateTime>
+#include <QJsonObject>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief 所有城市天气的表格模型
+ *
+ * 每行对应一个配置的城市，行顺序与 setCities() 给出的顺序一致。
+ * updateCity() 只在数值变化时发出该行的 dataChanged。
+ */
+class WeatherDashboardModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column {
+        CityColumn,
+        TemperatureColumn,
+        FeelsLikeColumn,
+        ConditionColumn,
+        HumidityColumn,
+        WindColumn,
+        PressureColumn,
+        UpdatedColumn,
+        ColumnCount
+    };
+
+    explicit WeatherDashboardModel(QObject *parent = nullptr);
+
+    /**
+     * @brief 设置要显示的城市（重置模型）
+     */
+    void setCities(const QStringList &cities);
+    QStringList cities() const;
+
+    /**
+     * @brief 更新一个城市的数据
+     * @param city 请求时使用的城市名（与 setCities 中的名称一致）
+     * @param data 天气响应；status 为 "error" 时显示错误信息
+     * @param fetchedAt 数据获取时间
+     */
+    void updateCity(const QString &city, const QJsonObject &data, const QDateTime &fetchedAt);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+    struct Row
+    {
+        QString city;
+        QJsonObject data;
+        QDateTime fetchedAt;
+    };
+
+    QVector<Row> m_rows;
+};
+
+#endif // WEATHERDASHBOARDMODEL_H
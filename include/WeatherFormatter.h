@@ -0,0 +1,30 @@
+#ifndef WEATHERFORMATTER_H
+#define WEATHERFORMATTER_H
+
+#include <QString>
+
+/**
+ * @brief 把天气后端的 JSON 输出格式化为富文本 HTML
+ *
+ * 只依赖 QtCore，不读取设置：主题由调用方传入，可在无界面环境（基准程序）中调用。
+ */
+class WeatherFormatter
+{
+public:
+    WeatherFormatter() = delete;
+
+    /**
+     * @brief 格式化一次天气查询的结果
+     * @param output 后端输出的 JSON 文本；无法解析或 status 为 error 时生成错误卡片
+     * @param city 请求的城市名
+     * @param isDark 是否使用深色主题配色
+     */
+    static QString formatWeatherHTML(const QString &output, const QString &city, bool isDark);
+
+    /**
+     * @brief 天气数据返回之前显示的骨架占位
+     */
+    static QString skeletonHTML(const QString &city, bool isDark);
+};
+
+#endif // WEATHERFORMATTER_H
@@ -0,0 +1,69 @@
+#ifndef WEATHERHISTORYSTORE_H
+#define WEATHERHISTORYSTORE_H
+
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+class QFile;
+
+/**
+ * @brief 每个城市的温度时间序列，保存在内存映射的二进制文件中
+ *
+ * 文件格式（小端）：16 字节文件头 {"WXH1", 记录数 u32, 最后一条记录的时间 i64（自纪元起的分钟）}，
+ * 之后是定长 4 字节记录 {与上一条的间隔分钟数 u16, 温度 i16（0.1°C）}。
+ * 时间戳以差值编码，查询从最后一条记录向前遍历，因此只触及所查询时间窗口内的记录。
+ * 10 分钟一次采样，每个城市一年约 200 KB。
+ *
+ * 追加通过普通写入完成（先写记录、再更新文件头），读取使用 QFile::map()；
+ * 未完整写入的记录在下次打开时被截掉。
+ */
+class WeatherHistoryStore
+{
+public:
+    /**
+     * @brief 一个时间桶内的最低/最高温度
+     */
+    struct Bucket
+    {
+        float min = 0;
+        float max = 0;
+        bool valid = false;  // 桶内没有采样时为 false
+    };
+
+    explicit WeatherHistoryStore(const QString &directory);
+    ~WeatherHistoryStore();
+
+    WeatherHistoryStore(const WeatherHistoryStore &) = delete;
+    WeatherHistoryStore &operator=(const WeatherHistoryStore &) = delete;
+
+    /**
+     * @brief 追加一次读数；与上一条记录在同一分钟内时忽略
+     * @return 是否写入
+     */
+    bool append(const QString &city, const QDateTime &time, double temperature);
+
+    /**
+     * @brief 把 [from, to) 均分为 bucketCount 个桶，返回每个桶的最低/最高温度
+     */
+    QVector<Bucket> downsample(const QString &city, const QDateTime &from, const QDateTime &to, int bucketCount);
+
+private:
+    struct Series
+    {
+        QFile *file = nullptr;
+        uchar *map = nullptr;    // 整个文件的只读映射，追加后失效、下次读取时重新映射
+        quint32 count = 0;
+        qint64 lastMinute = 0;
+    };
+
+    Series *series(const QString &city);
+    bool mapSeries(Series *series);
+    QString filePath(const QString &city) const;
+
+    QString m_directory;
+    QHash<QString, Series *> m_series;  // 城市名（小写） -> 打开的文件
+};
+
+#endif // WEATHERHISTORYSTORE_H
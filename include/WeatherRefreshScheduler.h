@@ -0,0 +1,78 @@
+#ifndef WEATHERREFRESHSCHEDULER_H
+#define WEATHERREFRESHSCHEDULER_H
+
+#include <QDateTime>
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+
+class QTimer;
+
+/**
+ * @brief 后台天气刷新的调度器，刷新间隔随天气变化的快慢自适应
+ *
+ * 每轮刷新结束后比较各城市与上一次读数的差异：温度变化大或天气状况改变时
+ * 间隔减半，几乎不变时间隔放大 1.5 倍，限制在 [min, max] 之内。
+ * 到期时间对齐到整分钟并使用粗粒度定时器，与其他周期性工作合并唤醒。
+ * 窗口最小化或隐藏时暂停，恢复时若已过期则立即刷新。
+ */
+class WeatherRefreshScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Policy
+    {
+        int minIntervalSecs = 5 * 60;
+        int initialIntervalSecs = 15 * 60;
+        int maxIntervalSecs = 60 * 60;
+    };
+
+    explicit WeatherRefreshScheduler(const Policy &policy, QObject *parent = nullptr);
+
+    /**
+     * @brief 窗口可见时为 true；暂停期间不会发出 refreshDue
+     */
+    void setActive(bool active);
+
+    /**
+     * @brief 记录一次成功的读数（无论来自后台刷新还是手动刷新）
+     */
+    void recordReading(const QString &city, const QJsonObject &data);
+
+    /**
+     * @brief 一轮刷新结束（成功或失败），根据本轮的变化调整间隔并安排下一次
+     */
+    void refreshFinished();
+
+    int intervalSeconds() const;
+
+signals:
+    void refreshDue();
+
+private slots:
+    void onTimeout();
+
+private:
+    struct Reading
+    {
+        double temperature;
+        QString description;
+    };
+
+    void scheduleNext();
+    void startTimer();
+
+    Policy m_policy;
+    QTimer *m_timer;
+    bool m_active;
+    int m_intervalSecs;
+    QDateTime m_nextDue;
+    QHash<QString, Reading> m_lastReadings;
+    double m_roundMaxChange;      // 本轮最大的温度变化（°C）
+    bool m_roundConditionChanged;
+    bool m_roundHasReadings;
+};
+
+#endif // WEATHERREFRESHSCHEDULER_H
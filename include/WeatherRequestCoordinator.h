@@ -0,0 +1,75 @@
+#ifndef WEATHERREQUESTCOORDINATOR_H
+#define WEATHERREQUESTCOORDINATOR_H
+
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+
+class QTimer;
+class WeatherBackend;
+
+/**
+ * @brief 侧边栏天气请求的协调器：只有最新的请求有效
+ *
+ * - 新请求取代旧请求，但不重启后端：旧请求只是被取消，其响应被丢弃；
+ * - 快速连续的请求经过去抖，只有最后一个真正发给后端；
+ * - 与正在进行的请求城市相同时直接合并，不重复发送。
+ *
+ * 后端的信号是广播的，协调器只处理自己发出的请求 id。
+ */
+class WeatherRequestCoordinator : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit WeatherRequestCoordinator(WeatherBackend *backend, QObject *parent = nullptr);
+
+    /**
+     * @brief 请求城市天气，取代之前的所有请求
+     * @param immediate 为 true 时跳过去抖立即发送（例如手动刷新）
+     */
+    void request(const QString &city, bool immediate = false);
+
+    /**
+     * @brief 放弃当前请求（包括尚未发出的），不会发出任何信号
+     */
+    void cancel();
+
+    /**
+     * @brief 是否有尚未返回的请求（等待去抖或已发出）
+     */
+    bool isBusy() const;
+
+    /**
+     * @brief 最新请求的城市
+     */
+    QString currentCity() const;
+
+signals:
+    /**
+     * @brief 请求真正发给后端时发出
+     */
+    void requestStarted(const QString &city);
+
+    /**
+     * @brief 最新请求的响应（status 字段可能为 "error"，由调用方处理）
+     */
+    void weatherReady(const QString &city, const QJsonObject &data);
+    void requestFailed(const QString &city, const QString &error);
+
+private slots:
+    void sendPending();
+    void onBackendReady(int requestId, const QJsonObject &data);
+    void onBackendFailed(int requestId, const QString &error);
+
+private:
+    void abandonInFlight();
+
+    WeatherBackend *m_backend;
+    QTimer *m_debounceTimer;
+    QString m_wantedCity;    // 最新请求的城市，空表示没有请求
+    QString m_inFlightCity;  // 已发给后端、尚未返回的城市
+    int m_inFlightId;        // 0 表示没有
+};
+
+#endif // WEATHERREQUESTCOORDINATOR_H
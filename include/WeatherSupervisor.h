@@ -0,0 +1,109 @@
+#ifndef WEATHERSUPERVISOR_H
+#define WEATHERSUPERVISOR_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QVector>
+
+class QTimer;
+class WeatherBackend;
+
+/**
+ * @brief 天气后端的监督者：心跳、超时、带抖动的指数退避重启与熔断
+ *
+ * - 后端空闲且在运行时定期发送心跳；有未完成的请求而在超时时间内没有任何
+ *   响应时，认为后端卡死并重启（未完成的请求以超时失败结束）；
+ * - 连续失败后按 base * 2^n 加随机抖动的间隔重启，达到上限后熔断：
+ *   熔断期间 allowRequest() 返回 false，冷却结束后用一次心跳探测，成功则恢复；
+ * - 记录请求数、失败、超时、重启次数以及最近请求的延迟分位数。
+ *
+ * 所有等待都由定时器完成，不会阻塞事件循环。
+ */
+class WeatherSupervisor : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Policy
+    {
+        int requestTimeoutMs = 30000;      // 有未完成请求时，多久没有响应算卡死
+        int heartbeatIntervalMs = 30000;   // 空闲时的心跳间隔
+        int restartDelayMs = 2000;         // 退避的基础间隔（pythonRestartDelay）
+        int maxFailures = 3;               // 连续失败多少次后熔断（pythonRestartAttempts）
+    };
+
+    enum class CircuitState {
+        Closed,    // 正常
+        Open,      // 熔断中，拒绝请求
+        HalfOpen   // 冷却结束，正在探测
+    };
+
+    struct Stats
+    {
+        int completed = 0;
+        int failures = 0;
+        int timeouts = 0;
+        int restarts = 0;
+        qint64 p50Ms = 0;
+        qint64 p95Ms = 0;
+        qint64 p99Ms = 0;
+    };
+
+    WeatherSupervisor(WeatherBackend *backend, const Policy &policy, QObject *parent = nullptr);
+
+    /**
+     * @brief 熔断器关闭时才应发出新请求
+     */
+    bool allowRequest() const;
+
+    /**
+     * @brief 熔断时距离下一次探测的毫秒数
+     */
+    int retryAfterMs() const;
+
+    CircuitState circuitState() const;
+    Stats stats() const;
+
+signals:
+    void circuitOpened(int retryAfterMs);
+    void circuitClosed();
+    void statsChanged();
+
+private slots:
+    void onRequestStarted(int requestId);
+    void onWeatherReady(int requestId);
+    void onRequestFailed(int requestId);
+    void checkProgress();
+    void sendHeartbeat();
+    void onRestartTimer();
+
+private:
+    void recordSuccess();
+    void recordFailure();
+    void scheduleRestart();
+    void openCircuit();
+    int backoffMs(int attempt) const;
+    void recordLatency(qint64 ms);
+    static qint64 percentile(const QVector<qint64> &sorted, double fraction);
+
+    WeatherBackend *m_backend;
+    Policy m_policy;
+    QElapsedTimer m_clock;
+    QTimer *m_watchdogTimer;
+    QTimer *m_heartbeatTimer;
+    QTimer *m_restartTimer;
+
+    CircuitState m_state;
+    int m_consecutiveFailures;
+    qint64 m_lastProgressMs;       // 最近一次收到响应（或开始等待）的时间
+    int m_heartbeatId;             // 进行中的心跳/探测，0 表示没有
+    QHash<int, qint64> m_startTimes;  // 请求 id -> 发出时间
+
+    Stats m_stats;
+    QVector<qint64> m_latencies;   // 最近请求的延迟（环形缓冲区）
+    int m_latencyNext;
+};
+
+#endif // WEATHERSUPERVISOR_H
@@ -0,0 +1,89 @@
+#ifndef WEATHERWORKER_H
+#define WEATHERWORKER_H
+
+#include "WeatherBackend.h"
+#include <QByteArray>
+#include <QHash>
+#include <QProcess>
+
+/**
+ * @brief 常驻的 Python 天气工作进程
+ *
+ * 以 --server 模式启动 weather_service.py 并保持运行，通过 stdin/stdout
+ * 交换 JSON-lines：每个请求带一个递增的 id，响应按 id 与请求对应。
+ * 进程只需导入一次依赖，HTTP 连接在请求之间保持 keep-alive。
+ * 进程退出时所有未完成的请求都会收到失败通知，下一个请求会自动重新启动进程。
+ * 失败通知总是经由事件循环异步发出。
+ */
+class WeatherWorker : public WeatherBackend
+{
+    Q_OBJECT
+
+public:
+    explicit WeatherWorker(QObject *parent = nullptr);
+    ~WeatherWorker() override;
+
+    /**
+     * @brief 设置解释器与脚本路径；与运行中的进程不同时，进程会在下一个请求前重启
+     */
+    void setProgram(const QString &pythonExecutable, const QString &scriptPath);
+
+    /**
+     * @brief 发送天气请求（必要时先启动进程）
+     * @return 请求 id，响应通过 weatherReady/requestFailed 返回
+     */
+    int requestWeather(const QString &city) override;
+
+    /**
+     * @brief 一次 HTTP 请求查询多个城市
+     * @return 请求 id；响应的 "results" 数组与 cities 顺序一致，每项带 "query" 字段
+     */
+    int requestWeatherBatch(const QStringList &cities) override;
+
+    /**
+     * @brief 放弃一个未完成的请求，之后到达的响应会被忽略
+     */
+    void cancel(int requestId) override;
+
+    /**
+     * @brief 心跳（必要时先启动进程，可用于预热）
+     * @return 请求 id，进程回复的 pong 经 weatherReady 返回
+     */
+    int ping() override;
+
+    /**
+     * @brief 立即终止进程（不阻塞），未完成的请求以 reason 失败结束
+     */
+    void stop(const QString &reason) override;
+    int pendingCount() const override;
+
+    bool isRunning() const override;
+
+signals:
+    /**
+     * @brief 解释器无法启动（路径失效等）
+     */
+    void failedToStart();
+
+private slots:
+    void onReadyReadStandardOutput();
+    void onReadyReadStandardError();
+    void onProcessFinished(int exitCode, QProcess::ExitStatus exitStatus);
+    void onProcessError(QProcess::ProcessError error);
+
+private:
+    QProcess *createProcess();
+    bool ensureStarted();
+    int send(const QJsonObject &request, const QString &description);
+    void failPending(const QString &error);
+
+    QProcess *m_process;
+    QString m_pythonExecutable;
+    QString m_scriptPath;
+    QByteArray m_stdoutBuffer;   // 尚未凑成完整一行的输出
+    QByteArray m_stderrTail;     // 最近的 stderr 输出，用于错误信息
+    QHash<int, QString> m_pending;  // 请求 id -> 城市（批量请求为逗号分隔的列表）
+    int m_nextRequestId;
+};
+
+#endif // WEATHERWORKER_H
@@ -0,0 +1,67 @@
+#ifndef ZOOMCONTROLLER_H
+#define ZOOMCONTROLLER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+
+class QTimer;
+
+/**
+ * @brief 把连续的缩放请求合并为每帧至多一次的绝对缩放
+ *
+ * 缩放值是绝对量：每次只应用最新的目标值，不存在逐步累积的舍入误差。
+ * 一次手势中的第一个请求立即应用，之后每帧（约 16 ms）最多应用一次；
+ * 输入停止一段时间后发出 settled()，昂贵的工作（预览重新布局）放在那里只做一次。
+ * 每次手势结束时在调试输出中记录请求数、帧数与每帧耗时。
+ */
+class ZoomController : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ZoomController(double initialZoom, QObject *parent = nullptr);
+
+    /**
+     * @brief 设置目标缩放
+     */
+    void setTarget(double zoom);
+
+    double target() const;
+
+    /**
+     * @brief 立即应用当前目标并结束手势（启动时恢复缩放）
+     */
+    void flush();
+
+signals:
+    /**
+     * @brief 每帧至多一次：应用廉价的缩放（编辑器字体、预览截图）
+     */
+    void frame(double zoom);
+
+    /**
+     * @brief 输入停止后：应用昂贵的缩放（预览重新布局）
+     */
+    void settled(double zoom);
+
+private slots:
+    void onFrameTimeout();
+    void onSettleTimeout();
+
+private:
+    void emitFrame();
+
+    QTimer *m_frameTimer;
+    QTimer *m_settleTimer;
+    double m_target;
+    double m_applied;
+
+    // 当前手势的统计
+    int m_requests;
+    int m_frames;
+    qint64 m_totalFrameNs;
+    qint64 m_maxFrameNs;
+    QElapsedTimer m_gestureTimer;
+};
+
+#endif // ZOOMCONTROLLER_H
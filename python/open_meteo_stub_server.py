@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Open-Meteo 替身服务器
+
+在本地提供 /v1/search（地理编码）与 /v1/forecast（当前天气），返回
+fixtures/open_meteo/ 中录制的响应，使两个天气后端都能在离线环境下测试。
+
+用法：
+    python open_meteo_stub_server.py [端口]
+
+然后让客户端指向它：
+    OPEN_METEO_GEOCODING_URL=http://127.0.0.1:<端口>/v1/search
+    OPEN_METEO_FORECAST_URL=http://127.0.0.1:<端口>/v1/forecast
+"""
+
+import json
+import os
+import sys
+import threading
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+FIXTURES_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "fixtures", "open_meteo")
+
+
+def _load_fixture(name):
+    with open(os.path.join(FIXTURES_DIR, name), "r", encoding="utf-8") as f:
+        return json.load(f)
+
+
+class StubServer(ThreadingHTTPServer):
+    """记录请求数与连接数的替身服务器，用于检查客户端是否复用连接。"""
+
+    daemon_threads = True
+
+    def __init__(self, port=0):
+        super().__init__(("127.0.0.1", port), StubHandler)
+        self.geocoding = _load_fixture("geocoding.json")
+        self.forecast = _load_fixture("forecast.json")
+        self.lock = threading.Lock()
+        self.request_count = 0
+        self.connection_count = 0
+
+    @property
+    def base_url(self):
+        return f"http://127.0.0.1:{self.server_address[1]}"
+
+    def environment(self):
+        """客户端需要设置的环境变量。"""
+        return {
+            "OPEN_METEO_GEOCODING_URL": self.base_url + "/v1/search",
+            "OPEN_METEO_FORECAST_URL": self.base_url + "/v1/forecast",
+        }
+
+
+class StubHandler(BaseHTTPRequestHandler):
+    # HTTP/1.1 + Content-Length，连接在请求之间保持打开
+    protocol_version = "HTTP/1.1"
+
+    def setup(self):
+        super().setup()
+        with self.server.lock:
+            self.server.connection_count += 1
+
+    def log_message(self, format, *args):
+        pass
+
+    def do_GET(self):
+        with self.server.lock:
+            self.server.request_count += 1
+
+        url = urlparse(self.path)
+        query = parse_qs(url.query)
+        if url.path == "/v1/search":
+            self._search(query)
+        elif url.path == "/v1/forecast":
+            self._forecast(query)
+        else:
+            self._send(404, {"error": True, "reason": f"Not found: {url.path}"})
+
+    def _search(self, query):
+        name = query.get("name", [""])[0].strip().lower()
+        recorded = self.server.geocoding.get(name)
+        # 未知城市：与真实接口一样返回没有 results 字段的对象
+        self._send(200, recorded if recorded else {"generationtime_ms": 0.1})
+
+    def _forecast(self, query):
+        try:
+            latitudes = [float(value) for value in query["latitude"][0].split(",")]
+            longitudes = [float(value) for value in query["longitude"][0].split(",")]
+        except (KeyError, ValueError):
+            self._send(400, {"error": True, "reason": "Invalid latitude/longitude"})
+            return
+        if len(latitudes) != len(longitudes):
+            self._send(400, {"error": True, "reason": "Parameter 'latitude' and 'longitude' must have the same number of elements"})
+            return
+
+        items = []
+        for latitude, longitude in zip(latitudes, longitudes):
+            key = f"{latitude:.2f},{longitude:.2f}"
+            recorded = self.server.forecast.get(key)
+            if recorded is None:
+                self._send(400, {"error": True, "reason": f"No recorded response for {key}"})
+                return
+            items.append(recorded)
+
+        # 单个坐标返回对象，多个坐标返回数组
+        self._send(200, items[0] if len(items) == 1 else items)
+
+    def _send(self, status, payload):
+        body = json.dumps(payload, ensure_ascii=False).encode("utf-8")
+        self.send_response(status)
+        self.send_header("Content-Type", "application/json; charset=utf-8")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+
+def main():
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else 8765
+    server = StubServer(port)
+    print(f"Open-Meteo stub listening on {server.base_url}", file=sys.stderr)
+    for name, value in server.environment().items():
+        print(f"  {name}={value}", file=sys.stderr)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
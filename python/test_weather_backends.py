@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Test both weather backends against the local Open-Meteo stub server.
+
+Usage:
+    python test_weather_backends.py                  # Python backend only
+    python test_weather_backends.py <WeatherApp>     # also the native backend (WeatherApp --weather)
+
+The native backend must return the same results as weather_service.py,
+and sequential requests must reuse a single connection.
+"""
+
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import threading
+
+from open_meteo_stub_server import StubServer
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+CITIES = ["Beijing", "Tokyo", "Reykjavik", "Atlantis"]
+
+
+def run_json_lines(command, env):
+    result = subprocess.run(command, env=env, capture_output=True, text=True, encoding="utf-8", timeout=60)
+    results = []
+    for line in result.stdout.splitlines():
+        if line.strip():
+            # weather_service.py --batch prints one array; WeatherApp prints one object per line
+            parsed = json.loads(line)
+            results.extend(parsed if isinstance(parsed, list) else [parsed])
+    return results
+
+
+def comparable(result):
+    """Error messages differ between HTTP stacks; compare everything else."""
+    if result.get("status") == "success":
+        return result
+    return {key: value for key, value in result.items() if key not in ("error_message", "description")}
+
+
+def main():
+    failures = []
+
+    def check(condition, message):
+        print(("PASS: " if condition else "FAIL: ") + message)
+        if not condition:
+            failures.append(message)
+
+    server = StubServer()
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+
+    work_dir = tempfile.mkdtemp()
+    geocode_table = os.path.join(work_dir, "geocode_cache.json")
+    shutil.copy(os.path.join(SCRIPT_DIR, "geocode_cache.json"), geocode_table)
+
+    env = dict(os.environ, PYTHONIOENCODING="utf-8", WEATHER_GEOCODE_TABLE=geocode_table)
+    env.update(server.environment())
+
+    try:
+        # Python backend
+        service = [sys.executable, os.path.join(SCRIPT_DIR, "weather_service.py")]
+        single = run_json_lines(service + ["Beijing"], env)
+        check(len(single) == 1 and single[0]["status"] == "success" and single[0]["city"] == "Beijing",
+              "python: single city")
+
+        batch = run_json_lines(service + ["--batch"] + CITIES, env)
+        check([item["query"] for item in batch] == CITIES, "python: batch keeps request order")
+        check([item["status"] for item in batch] == ["success", "success", "success", "error"],
+              "python: unknown city fails alone")
+        with open(geocode_table, "r", encoding="utf-8") as f:
+            check("reykjavik" in json.load(f), "python: geocoding result written back")
+
+        # Native backend
+        if len(sys.argv) > 1:
+            app = [sys.argv[1], "--weather"]
+            shutil.copy(os.path.join(SCRIPT_DIR, "geocode_cache.json"), geocode_table)
+
+            connections_before = server.connection_count
+            sequential = run_json_lines(app + ["Beijing", "Tokyo", "Reykjavik"], env)
+            check([item["status"] for item in sequential] == ["success"] * 3, "native: sequential requests")
+            check(server.connection_count - connections_before == 1,
+                  f"native: one connection for sequential requests ({server.connection_count - connections_before} opened)")
+
+            native_batch = run_json_lines(app + ["--batch"] + CITIES, env)
+            check([comparable(item) for item in native_batch] == [comparable(item) for item in batch],
+                  "native: batch matches python backend")
+        else:
+            print("SKIP: native backend (pass the WeatherApp executable to test it)")
+    finally:
+        server.shutdown()
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    print(f"\n{len(failures)} failure(s)")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
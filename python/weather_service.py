@@ -6,8 +6,19 @@
 """
 
 import json
+import os
 import sys
-from typing import Dict, Optional
+import tempfile
+from typing import Dict, List, Optional
+
+# 城市名 → 坐标的持久化表，随程序分发并预置内置城市
+GEOCODE_CACHE_PATH = os.environ.get(
+    "WEATHER_GEOCODE_TABLE",
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "geocode_cache.json"))
+
+# Open-Meteo 接口地址；测试时可通过环境变量指向本地的替身服务器
+GEOCODING_URL = os.environ.get("OPEN_METEO_GEOCODING_URL", "https://geocoding-api.open-meteo.com/v1/search")
+FORECAST_URL = os.environ.get("OPEN_METEO_FORECAST_URL", "https://api.open-meteo.com/v1/forecast")
 
 
 class WeatherService:
@@ -16,10 +27,86 @@ class WeatherService:
     这是在后续阶段将进行扩展的原型实现。
     """
 
-    def __init__(self):
+    def __init__(self, geocode_cache_path: str = GEOCODE_CACHE_PATH):
         """初始化天气服务。"""
         self.api_key = None
         self.base_url = "https://api.openweathermap.org/data/2.5/weather"
+        self._session = None
+        self._geocode_cache_path = geocode_cache_path
+        self._geocode_cache = self._load_geocode_cache()
+
+    def _load_geocode_cache(self) -> Dict[str, Dict[str, any]]:
+        """读取地理编码表，文件缺失或损坏时返回空表。"""
+        try:
+            with open(self._geocode_cache_path, "r", encoding="utf-8") as f:
+                table = json.load(f)
+            return table if isinstance(table, dict) else {}
+        except (OSError, ValueError):
+            return {}
+
+    def _save_geocode_cache(self) -> None:
+        """
+        原子地写回地理编码表。
+
+        安装目录可能不可写，此时只保留在内存中，不影响本次查询。
+        """
+        directory = os.path.dirname(self._geocode_cache_path)
+        try:
+            fd, temp_path = tempfile.mkstemp(dir=directory, suffix=".tmp")
+            with os.fdopen(fd, "w", encoding="utf-8") as f:
+                json.dump(self._geocode_cache, f, ensure_ascii=False, indent=2)
+                f.write("\n")
+            os.replace(temp_path, self._geocode_cache_path)
+        except OSError as e:
+            print(f"无法写入地理编码表：{e}", file=sys.stderr)
+
+    def geocode(self, city: str) -> Dict[str, any]:
+        """
+        将城市名解析为坐标与规范名称。
+
+        先查本地表，未命中时调用地理编码 API 并把结果写回表中。
+
+        返回：
+            {"name": ..., "latitude": ..., "longitude": ...}
+        """
+        key = city.strip().lower()
+        location = self._geocode_cache.get(key)
+        if location:
+            return location
+
+        import urllib.parse
+
+        geocode_url = f"{GEOCODING_URL}?name={urllib.parse.quote(city)}&count=1&language=en&format=json"
+
+        response = self._http().get(geocode_url, timeout=5)
+        response.raise_for_status()
+        geo_data = response.json()
+
+        if 'results' not in geo_data or len(geo_data['results']) == 0:
+            raise Exception(f"未找到城市 '{city}'")
+
+        result = geo_data['results'][0]
+        location = {
+            "name": result['name'],
+            "latitude": result['latitude'],
+            "longitude": result['longitude'],
+        }
+        self._geocode_cache[key] = location
+        self._save_geocode_cache()
+        return location
+
+    def _http(self):
+        """
+        返回复用的 HTTP 会话。
+
+        在服务器模式下同一会话会跨请求保持 keep-alive 连接，
+        避免每次请求都重新建立 TCP/TLS 连接。
+        """
+        if self._session is None:
+            import requests
+            self._session = requests.Session()
+            self._session.headers["User-Agent"] = "mdCoder-weather/1.0"
+        return self._session
 
     def set_api_key(self, api_key: str) -> None:
         """
@@ -30,6 +117,71 @@ class WeatherService:
         """
         self.api_key = api_key
 
+    # 将天气代码映射到描述
+    WEATHER_CODES = {
+        0: "晴朗", 1: "晴间多云", 2: "部分多云", 3: "阴天",
+        45: "雾", 48: "沉积雾",
+        51: "毛毛雨", 53: "中等毛毛雨", 55: "密集的毛毛雨",
+        61: "小雨", 63: "中雨", 65: "大雨",
+        71: "小雪", 73: "中雪", 75: "大雪",
+        77: "雪粒", 80: "小阵雨", 81: "中等阵雨",
+        82: "剧烈阵雨", 85: "小阵雪", 86: "大阵雪",
+        95: "雷暴", 96: "雷暴伴有小冰雹", 99: "雷暴伴有大冰雹"
+    }
+
+    CURRENT_FIELDS = "temperature_2m,relative_humidity_2m,apparent_temperature,weather_code,wind_speed_10m,surface_pressure"
+
+    def _fetch_current(self, locations):
+        """
+        一次请求获取多个坐标的当前天气。
+
+        Open-Meteo 接受逗号分隔的经纬度列表；多个坐标时返回数组，单个坐标时返回对象。
+
+        返回：
+            与 locations 顺序一致的 current 字典列表
+        """
+        latitudes = ",".join(str(location['latitude']) for location in locations)
+        longitudes = ",".join(str(location['longitude']) for location in locations)
+        weather_url = f"{FORECAST_URL}?latitude={latitudes}&longitude={longitudes}&current={self.CURRENT_FIELDS}&timezone=auto"
+
+        response = self._http().get(weather_url, timeout=10)
+        response.raise_for_status()
+        payload = response.json()
+        if isinstance(payload, dict):
+            payload = [payload]
+        if len(payload) != len(locations):
+            raise Exception(f"预期 {len(locations)} 个结果，实际收到 {len(payload)} 个")
+        return [item['current'] for item in payload]
+
+    def _format_current(self, current: Dict[str, any], city_name: str) -> Dict[str, any]:
+        """将 Open-Meteo 的 current 字段转换为应用使用的格式。"""
+        weather_code = current.get('weather_code', 0)
+        description = self.WEATHER_CODES.get(weather_code, "未知")
+
+        return {
+            "city": city_name,
+            "temperature": round(current['temperature_2m'], 1),
+            "humidity": current['relative_humidity_2m'],
+            "description": description,
+            "wind_speed": round(current['wind_speed_10m'], 1),
+            "feels_like": round(current['apparent_temperature'], 1),
+            "pressure": current['surface_pressure'],
+            "status": "success"
+        }
+
+    @staticmethod
+    def _error_result(city: str, error: Exception) -> Dict[str, any]:
+        """构造错误结果。"""
+        return {
+            "city": city,
+            "temperature": 0,
+            "humidity": 0,
+            "description": f"错误：{str(error)}",
+            "wind_speed": 0,
+            "status": "error",
+            "error_message": str(error)
+        }
+
     def get_weather(self, city: str) -> Dict[str, any]:
         """
         获取指定城市的天气数据。
@@ -41,70 +193,50 @@ class WeatherService:
             包含天气信息的字典
         """
         try:
-            import requests
-            import urllib.parse
-            
-            # 步骤 1：使用地理编码 API 从城市名称获取坐标
-            geocode_url = f"https://geocoding-api.open-meteo.com/v1/search?name={urllib.parse.quote(city)}&count=1&language=en&format=json"
-            
-            response = requests.get(geocode_url, timeout=5)
-            response.raise_for_status()
-            geo_data = response.json()
-            
-            if 'results' not in geo_data or len(geo_data['results']) == 0:
-                raise Exception(f"未找到城市 '{city}'")
-            
-            location = geo_data['results'][0]
-            lat = location['latitude']
-            lon = location['longitude']
-            city_name = location['name']
-            
+            # 步骤 1：从本地表（必要时从地理编码 API）获取坐标
+            location = self.geocode(city)
+
             # 步骤 2：使用坐标获取天气数据
-            weather_url = f"https://api.open-meteo.com/v1/forecast?latitude={lat}&longitude={lon}&current=temperature_2m,relative_humidity_2m,apparent_temperature,weather_code,wind_speed_10m,surface_pressure&timezone=auto"
-            
-            response = requests.get(weather_url, timeout=5)
-            response.raise_for_status()
-            weather_data_raw = response.json()
-            current = weather_data_raw['current']
-            
-            # 将天气代码映射到描述
-            weather_codes = {
-                0: "晴朗", 1: "晴间多云", 2: "部分多云", 3: "阴天",
-                45: "雾", 48: "沉积雾",
-                51: "毛毛雨", 53: "中等毛毛雨", 55: "密集的毛毛雨",
-                61: "小雨", 63: "中雨", 65: "大雨",
-                71: "小雪", 73: "中雪", 75: "大雪",
-                77: "雪粒", 80: "小阵雨", 81: "中等阵雨",
-                82: "剧烈阵雨", 85: "小阵雪", 86: "大阵雪",
-                95: "雷暴", 96: "雷暴伴有小冰雹", 99: "雷暴伴有大冰雹"
-            }
-            
-            weather_code = current.get('weather_code', 0)
-            description = weather_codes.get(weather_code, "未知")
-            
-            weather_data = {
-                "city": city_name,
-                "temperature": round(current['temperature_2m'], 1),
-                "humidity": current['relative_humidity_2m'],
-                "description": description,
-                "wind_speed": round(current['wind_speed_10m'], 1),
-                "feels_like": round(current['apparent_temperature'], 1),
-                "pressure": current['surface_pressure'],
-                "status": "success"
-            }
-            return weather_data
-                
+            current = self._fetch_current([location])[0]
+            return self._format_current(current, location['name'])
+
         except Exception as e:
             # 如果 API 调用失败，返回错误数据
-            return {
-                "city": city,
-                "temperature": 0,
-                "humidity": 0,
-                "description": f"错误：{str(e)}",
-                "wind_speed": 0,
-                "status": "error",
-                "error_message": str(e)
-            }
+            return self._error_result(city, e)
+
+    def get_weather_batch(self, cities: List[str]) -> List[Dict[str, any]]:
+        """
+        一次 HTTP 请求获取多个城市的天气。
+
+        无法解析坐标的城市单独返回错误，其余城市照常查询。
+
+        参数：
+            cities：城市名称列表
+
+        返回：
+            与 cities 顺序一致的结果列表，每项带有 "query" 字段（请求时的城市名）
+        """
+        results = [None] * len(cities)
+        located = []  # (索引, 坐标)
+
+        for index, city in enumerate(cities):
+            try:
+                located.append((index, self.geocode(city)))
+            except Exception as e:
+                results[index] = self._error_result(city, e)
+
+        if located:
+            try:
+                currents = self._fetch_current([location for _, location in located])
+                for (index, location), current in zip(located, currents):
+                    results[index] = self._format_current(current, location['name'])
+            except Exception as e:
+                for index, _ in located:
+                    results[index] = self._error_result(cities[index], e)
+
+        for city, result in zip(cities, results):
+            result["query"] = city
+        return results
 
     def format_weather_data(self, weather_data: Dict[str, any]) -> str:
         """
@@ -132,19 +264,90 @@ class WeatherService:
         return formatted.strip()
 
 
+def handle_request(service: WeatherService, line: str) -> Dict[str, any]:
+    """
+    处理一条 JSON 请求并返回带相同 id 的响应。
+
+    请求格式：{"id": 1, "city": "Beijing"}
+              {"id": 2, "cities": ["Beijing", "Tokyo"]}   批量查询，一次 HTTP 请求
+              {"id": 3, "op": "ping"}                     心跳，立即返回 {"pong": true}
+    """
+    try:
+        request = json.loads(line)
+    except ValueError as e:
+        return {"id": None, "status": "error", "error_message": f"无效的请求：{e}"}
+
+    request_id = request.get("id") if isinstance(request, dict) else None
+    if isinstance(request, dict) and request.get("op") == "ping":
+        return {"id": request_id, "status": "success", "pong": True}
+
+    cities = request.get("cities") if isinstance(request, dict) else None
+    if isinstance(cities, list):
+        return {
+            "id": request_id,
+            "status": "success",
+            "results": service.get_weather_batch([str(city) for city in cities]),
+        }
+
+    city = request.get("city") if isinstance(request, dict) else None
+    if not city:
+        return {"id": request_id, "status": "error", "error_message": "请求缺少 city 字段"}
+
+    response = service.get_weather(city)
+    response["id"] = request_id
+    return response
+
+
+def serve(stdin=None, stdout=None) -> None:
+    """
+    服务器模式：从 stdin 逐行读取 JSON 请求，向 stdout 逐行写出响应。
+
+    进程在 stdin 关闭（EOF）时退出。每条响应都立即刷新，
+    C++ 端按 id 将响应与请求对应。
+    """
+    stdin = stdin or sys.stdin
+    stdout = stdout or sys.stdout
+    service = WeatherService()
+
+    for line in stdin:
+        line = line.strip()
+        if not line:
+            continue
+        response = handle_request(service, line)
+        stdout.write(json.dumps(response) + "\n")
+        stdout.flush()
+
+
 def main():
     """
     命令行界面的主函数。
     将 JSON 输出到 stdout 以便 C++ 集成。
+
+    用法：
+        python weather_service.py <城市名称>   单次查询
+        python weather_service.py --batch <城市>...   批量查询
+        python weather_service.py --server     常驻进程，JSON-lines 协议
     """
     if len(sys.argv) < 2:
         error_output = {
             "status": "error",
-            "error_message": "用法：python weather_service.py <城市名称>"
+            "error_message": "用法：python weather_service.py <城市名称> | --server"
         }
         print(json.dumps(error_output))
         sys.exit(1)
 
+    if sys.argv[1] == "--server":
+        # 管道两端统一使用 UTF-8，不受系统区域设置影响
+        sys.stdin.reconfigure(encoding="utf-8")
+        sys.stdout.reconfigure(encoding="utf-8")
+        serve()
+        return
+
+    if sys.argv[1] == "--batch":
+        service = WeatherService()
+        print(json.dumps(service.get_weather_batch(sys.argv[2:])))
+        return
+
     city = sys.argv[1]
     service = WeatherService()
     weather_data = service.get_weather(city)
@@ -3,6 +3,7 @@
 """
 Weather Service Test Script with Configurable Delay
 Usage: python weather_service_test.py <city_name> [delay_seconds]
+       python weather_service_test.py --server [delay_seconds]
 """
 
 import json
@@ -57,6 +58,30 @@ def get_weather_with_delay(city: str, delay: int = 0) -> Dict[str, any]:
             "error_message": str(e)
         }
 
+def serve(delay: int) -> None:
+    """
+    Server mode mirroring weather_service.py --server: one JSON request per
+    stdin line, one tagged JSON response per stdout line.
+    """
+    for line in sys.stdin:
+        line = line.strip()
+        if not line:
+            continue
+        request = json.loads(line)
+        if request.get("op") == "ping":
+            response = {"status": "success", "pong": True}
+        elif "cities" in request:
+            results = [get_weather_with_delay(city, 0) for city in request["cities"]]
+            for city, result in zip(request["cities"], results):
+                result["query"] = city
+            time.sleep(delay)
+            response = {"status": "success", "results": results}
+        else:
+            response = get_weather_with_delay(request.get("city", ""), delay)
+        response["id"] = request.get("id")
+        sys.stdout.write(json.dumps(response) + "\n")
+        sys.stdout.flush()
+
 def main():
     """
     Main function for command line interface.
@@ -64,11 +89,15 @@ def main():
     if len(sys.argv) < 2:
         error_output = {
             "status": "error",
-            "error_message": "Usage: python weather_service_test.py <city_name> [delay_seconds]"
+            "error_message": "Usage: python weather_service_test.py <city_name> [delay_seconds] | --server [delay_seconds]"
         }
         print(json.dumps(error_output))
         sys.exit(1)
 
+    if sys.argv[1] == "--server":
+        serve(int(sys.argv[2]) if len(sys.argv) > 2 else 0)
+        return
+
     city = sys.argv[1]
     delay = int(sys.argv[2]) if len(sys.argv) > 2 else 0
 
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Run a Qt Test benchmark, write its results as JSON and compare them with a stored baseline.
+
+Usage:
+    python scripts/compare_benchmarks.py build/bin/app_benchmark                     # compare
+    python scripts/compare_benchmarks.py build/bin/app_benchmark --update-baseline   # record a new baseline
+    python scripts/compare_benchmarks.py build/bin/app_benchmark -- renderDocument   # extra Qt Test arguments
+
+The benchmark's XML log is converted to {"results": {"function/tag": {metric, value, iterations}}},
+where value is per iteration. A result regresses when it is slower than the baseline by more than
+--threshold (default 10%). Baselines are machine-specific: record them on the reference machine.
+Exit code is 1 on test failures or regressions, 0 otherwise.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import subprocess
+import sys
+import xml.etree.ElementTree as ElementTree
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+BASELINE_DIR = os.path.join(SCRIPT_DIR, "..", "benchmarks", "baselines")
+
+
+def run_benchmark(executable, median, extra_args):
+    env = dict(os.environ)
+    env.setdefault("QT_QPA_PLATFORM", "offscreen")  # saveImage constructs a widget
+    command = [executable, "-median", str(median), "-o", "-,xml"] + extra_args
+    result = subprocess.run(command, env=env, capture_output=True, text=True, encoding="utf-8")
+    if not result.stdout.strip():
+        sys.exit("Benchmark produced no output (exit code %d):\n%s" % (result.returncode, result.stderr))
+    return ElementTree.fromstring(result.stdout)
+
+
+def parse_results(root):
+    results = {}
+    failures = []
+    for function in root.iter("TestFunction"):
+        name = function.get("name")
+        for incident in function.iter("Incident"):
+            if incident.get("type") in ("fail", "xpass"):
+                description = incident.findtext("Description", default="").strip()
+                failures.append("%s/%s: %s" % (name, incident.findtext("DataTag", default=""), description))
+        for result in function.iter("BenchmarkResult"):
+            key = "%s/%s" % (name, result.get("tag"))
+            results[key] = {
+                "metric": result.get("metric"),
+                "value": float(result.get("value")),
+                "iterations": int(result.get("iterations")),
+            }
+    return results, failures
+
+
+def compare(results, baseline, threshold):
+    regressions = 0
+    print("%-48s %14s %14s %9s" % ("benchmark", "baseline", "current", "change"))
+    for key in sorted(set(results) | set(baseline)):
+        if key not in baseline:
+            print("%-48s %14s %14.4g %9s" % (key, "-", results[key]["value"], "new"))
+            continue
+        if key not in results:
+            print("%-48s %14.4g %14s %9s" % (key, baseline[key]["value"], "-", "missing"))
+            continue
+
+        before = baseline[key]["value"]
+        after = results[key]["value"]
+        change = (after - before) / before if before > 0 else 0.0
+        marker = ""
+        if baseline[key]["metric"] != results[key]["metric"]:
+            marker = "  metric changed"
+        elif change > threshold:
+            marker = "  REGRESSION"
+            regressions += 1
+        print("%-48s %14.4g %14.4g %+8.1f%%%s" % (key, before, after, change * 100, marker))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run a Qt Test benchmark and compare with a JSON baseline")
+    parser.add_argument("executable", help="benchmark executable, e.g. build/bin/app_benchmark")
+    parser.add_argument("--baseline", help="baseline JSON (default: benchmarks/baselines/<name>.json)")
+    parser.add_argument("--output", help="write the results JSON here (default: <name>_results.json)")
+    parser.add_argument("--threshold", type=float, default=0.10, help="allowed slowdown, default 0.10")
+    parser.add_argument("--median", type=int, default=5, help="Qt Test -median runs per data row")
+    parser.add_argument("--update-baseline", action="store_true", help="store the results as the new baseline")
+
+    # Everything after "--" goes to Qt Test unchanged
+    argv = sys.argv[1:]
+    qtest_args = []
+    if "--" in argv:
+        qtest_args = argv[argv.index("--") + 1:]
+        argv = argv[:argv.index("--")]
+    args = parser.parse_args(argv)
+
+    name = os.path.splitext(os.path.basename(args.executable))[0]
+    baseline_path = args.baseline or os.path.join(BASELINE_DIR, name + ".json")
+    output_path = args.output or name + "_results.json"
+
+    root = run_benchmark(args.executable, args.median, qtest_args)
+    results, failures = parse_results(root)
+    document = {
+        "benchmark": root.get("name"),
+        "qt_version": root.findtext("Environment/QtVersion", default=""),
+        "generated": datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds"),
+        "results": results,
+    }
+    with open(output_path, "w", encoding="utf-8") as f:
+        json.dump(document, f, indent=2, sort_keys=True)
+    print("Results written to %s (%d benchmarks)" % (output_path, len(results)))
+
+    for failure in failures:
+        print("FAIL " + failure)
+
+    if args.update_baseline:
+        os.makedirs(os.path.dirname(os.path.abspath(baseline_path)), exist_ok=True)
+        with open(baseline_path, "w", encoding="utf-8") as f:
+            json.dump(document, f, indent=2, sort_keys=True)
+        print("Baseline updated: %s" % baseline_path)
+        return 1 if failures else 0
+
+    if not os.path.exists(baseline_path):
+        print("No baseline at %s; run with --update-baseline to record one" % baseline_path)
+        return 1 if failures else 0
+
+    with open(baseline_path, encoding="utf-8") as f:
+        baseline = json.load(f)["results"]
+    regressions = compare(results, baseline, args.threshold)
+    if regressions:
+        print("%d benchmark(s) slower than baseline by more than %.0f%%" % (regressions, args.threshold * 100))
+    return 1 if failures or regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Generate the displacement table of the emoji shortcode perfect hash (include/EmojiShortcodeHash.h).
+
+Usage:
+    python scripts/generate_emoji_shortcode_hash.py            # rewrite include/EmojiShortcodeHash.h
+    python scripts/generate_emoji_shortcode_hash.py --check    # exit 1 when the header is out of date
+
+Shortcodes come from the names in include/EmojiTable.h and the kAliases table in
+src/EmojiShortcodes.cpp, in that order. The hashing (FNV-1a, mix, bucketOf, slotOf) mirrors
+src/EmojiShortcodes.cpp exactly; the compiler only checks that every key lands on its own slot,
+so rerun this script whenever either table changes.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.join(SCRIPT_DIR, "..")
+TABLE_HEADER = os.path.join(ROOT_DIR, "include", "EmojiTable.h")
+SHORTCODES_SOURCE = os.path.join(ROOT_DIR, "src", "EmojiShortcodes.cpp")
+OUTPUT_HEADER = os.path.join(ROOT_DIR, "include", "EmojiShortcodeHash.h")
+
+MASK64 = (1 << 64) - 1
+HASH_SEED = 0xcbf29ce484222325
+MAX_CODE_LENGTH = 40
+CODE_CHARS = set("abcdefghijklmnopqrstuvwxyz0123456789_+-")
+
+
+def read_entries():
+    with open(TABLE_HEADER, encoding="utf-8") as f:
+        text = f.read()
+    # {"glyph", "name", "keywords", "nameZh", "keywordsZh"}
+    return re.findall(r'^\s*\{"([^"]*)", "([^"]*)",', text, re.MULTILINE)
+
+
+def read_aliases():
+    with open(SHORTCODES_SOURCE, encoding="utf-8") as f:
+        text = f.read()
+    block = re.search(r"constexpr Alias kAliases\[\] = \{(.*?)\n\};", text, re.DOTALL)
+    if not block:
+        sys.exit("kAliases not found in %s" % SHORTCODES_SOURCE)
+    return re.findall(r'\{"([^"]*)", "([^"]*)"\}', block.group(1))
+
+
+def name_to_code(name):
+    # "flag: china" -> flag_china, "t-rex" -> t_rex
+    return "_".join(re.findall(r"[a-z0-9]+", name))
+
+
+def fnv1a(code):
+    value = HASH_SEED
+    for byte in code.encode("ascii"):
+        value = ((value ^ byte) * 0x100000001b3) & MASK64
+    return value
+
+
+def mix(value):
+    value ^= value >> 33
+    value = (value * 0xff51afd7ed558ccd) & MASK64
+    value ^= value >> 33
+    return value
+
+
+def slot_of(value, displacement, table_size):
+    d0 = displacement >> 16
+    d1 = displacement & 0xffff
+    return (((value & 0xffffffff) + d0 * (mix(value) | 1) + d1) & MASK64) % table_size
+
+
+def build_sources():
+    sources = [(name_to_code(name), glyph) for glyph, name in read_entries()]
+    sources += read_aliases()
+    for code, _ in sources:
+        if not code or len(code) > MAX_CODE_LENGTH or not set(code) <= CODE_CHARS:
+            sys.exit("invalid emoji shortcode: %r" % code)
+    return sources
+
+
+def build_table(sources):
+    bucket_count = len(sources) // 4 + 1
+
+    # Same code twice (an emoji listed under two categories, an alias equal to a name) is kept once
+    glyphs = {}
+    for code, glyph in sources:
+        if glyphs.setdefault(code, glyph) != glyph:
+            sys.exit("emoji shortcode %r maps to two different glyphs" % code)
+    table_size = len(glyphs)
+
+    buckets = [[] for _ in range(bucket_count)]
+    for code in glyphs:
+        value = fnv1a(code)
+        buckets[(value >> 32) % bucket_count].append(value)
+
+    # Largest buckets first; within a bucket try every d1 for each d0 until all keys fit
+    displacements = [0] * bucket_count
+    occupied = [False] * table_size
+    for bucket in sorted(range(bucket_count), key=lambda b: (-len(buckets[b]), b)):
+        values = buckets[bucket]
+        if not values:
+            break
+        for displacement in ((d0 << 16) | d1 for d0 in range(0x10000) for d1 in range(table_size)):
+            slots = [slot_of(value, displacement, table_size) for value in values]
+            if len(set(slots)) == len(slots) and not any(occupied[slot] for slot in slots):
+                break
+        else:
+            sys.exit("cannot place bucket %d" % bucket)
+        for slot in slots:
+            occupied[slot] = True
+        displacements[bucket] = displacement
+    return table_size, displacements
+
+
+def render(table_size, displacements):
+    lines = [
+        "// 由 scripts/generate_emoji_shortcode_hash.py 生成，不要手工修改。",
+        "// 修改 EmojiTable.h 或 EmojiShortcodes.cpp 中的别名后重新运行该脚本。",
+        "",
+        "#ifndef EMOJISHORTCODEHASH_H",
+        "#define EMOJISHORTCODEHASH_H",
+        "",
+        "#include <cstdint>",
+        "",
+        "namespace EmojiShortcodeHash {",
+        "",
+        "inline constexpr int kTableSize = %d;" % table_size,
+        "",
+        "// 每个桶的位移：高 16 位为探测步长的倍数，低 16 位为偏移",
+        "inline constexpr std::uint32_t kDisplacements[] = {",
+    ]
+    for i in range(0, len(displacements), 8):
+        lines.append("    " + " ".join("0x%08x," % d for d in displacements[i:i + 8]))
+    lines += [
+        "};",
+        "",
+        "} // namespace EmojiShortcodeHash",
+        "",
+        "#endif // EMOJISHORTCODEHASH_H",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the emoji shortcode displacement table.")
+    parser.add_argument("--check", action="store_true", help="only check that the header is up to date")
+    args = parser.parse_args()
+
+    content = render(*build_table(build_sources()))
+    if args.check:
+        with open(OUTPUT_HEADER, encoding="utf-8") as f:
+            if f.read() != content:
+                sys.exit("%s is out of date; rerun %s" % (os.path.normpath(OUTPUT_HEADER), os.path.basename(__file__)))
+        print("%s is up to date" % os.path.normpath(OUTPUT_HEADER))
+        return 0
+
+    with open(OUTPUT_HEADER, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content)
+    print("Wrote %s" % os.path.normpath(OUTPUT_HEADER))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
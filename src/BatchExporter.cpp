@@ -0,0 +1,198 @@
+#include "BatchExporter.h"
+#include "MarkdownRenderer.h"
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QSemaphore>
+#include <QStringConverter>
+#include <QThread>
+#include <QThreadPool>
+#include <atomic>
+#include <cstdio>
+
+namespace {
+
+// 与编辑器打开文件时的硬性上限保持一致
+constexpr qint64 kMaxFileSize = 20 * 1024 * 1024;
+
+// 每个工作线程允许排队的文件数，决定了内存占用的上界
+constexpr int kFilesPerThread = 2;
+
+void printLine(FILE *stream, const QString &text)
+{
+    std::fputs(qUtf8Printable(text + QLatin1Char('\n')), stream);
+    std::fflush(stream);
+}
+
+} // namespace
+
+BatchExporter::BatchExporter(const Options &options)
+    : m_options(options)
+{
+}
+
+BatchExporter::Stats BatchExporter::run()
+{
+    Stats stats;
+    QElapsedTimer timer;
+    timer.start();
+
+    const QDir inputDir(m_options.inputDir);
+    const QDir outputDir(m_options.outputDir);
+
+    const int threads = m_options.threads > 0 ? m_options.threads : QThread::idealThreadCount();
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    // 生产者在提交前获取名额，任务结束时归还：在途文件数不超过 threads * kFilesPerThread
+    QSemaphore inFlight(threads * kFilesPerThread);
+
+    std::atomic<int> exported{0};
+    std::atomic<int> failed{0};
+    std::atomic<qint64> bytesRead{0};
+    std::atomic<qint64> bytesWritten{0};
+    QMutex outputMutex;
+
+    QDirIterator it(inputDir.absolutePath(), {"*.md", "*.markdown"},
+                    QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        const QString sourcePath = it.next();
+        const QFileInfo relativeInfo(inputDir.relativeFilePath(sourcePath));
+        const QString targetPath = QDir::cleanPath(
+            outputDir.filePath(relativeInfo.path() + "/" + relativeInfo.completeBaseName() + ".html"));
+
+        inFlight.acquire();
+        pool.start([&, sourcePath, targetPath]() {
+            qint64 read = 0;
+            qint64 written = 0;
+            QString error;
+
+            if (exportFile(sourcePath, targetPath, &read, &written, &error)) {
+                ++exported;
+                bytesRead += read;
+                bytesWritten += written;
+            } else {
+                ++failed;
+                QMutexLocker locker(&outputMutex);
+                printLine(stderr, QString("Failed: %1 (%2)")
+                                  .arg(QDir::toNativeSeparators(sourcePath), error));
+            }
+
+            inFlight.release();
+        });
+    }
+
+    pool.waitForDone();
+
+    stats.exported = exported;
+    stats.failed = failed;
+    stats.bytesRead = bytesRead;
+    stats.bytesWritten = bytesWritten;
+    stats.elapsedMs = timer.elapsed();
+    return stats;
+}
+
+bool BatchExporter::exportFile(const QString &sourcePath, const QString &targetPath,
+                               qint64 *bytesRead, qint64 *bytesWritten, QString *error) const
+{
+    QFile file(sourcePath);
+    if (file.size() > kMaxFileSize) {
+        *error = "file exceeds the 20 MB limit";
+        return false;
+    }
+    if (!file.open(QFile::ReadOnly)) {
+        *error = file.errorString();
+        return false;
+    }
+    const QByteArray rawData = file.readAll();
+    file.close();
+
+    // 按 BOM 识别编码，没有 BOM 时按 UTF-8 解码（解码器会跳过 BOM）
+    QStringDecoder decoder(QStringConverter::encodingForData(rawData).value_or(QStringConverter::Utf8));
+    QString markdown = decoder(rawData);
+    if (decoder.hasError()) {
+        *error = "cannot decode file";
+        return false;
+    }
+    if (markdown.contains(QLatin1Char('\r'))) {
+        markdown.replace("\r\n", "\n");
+    }
+
+    const QByteArray html = QString(
+        "<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><title>%1</title></head>%2</html>\n")
+        .arg(QFileInfo(sourcePath).completeBaseName().toHtmlEscaped(),
+             MarkdownRenderer::renderDocument(markdown, m_options.isDark))
+        .toUtf8();
+
+    if (!QDir().mkpath(QFileInfo(targetPath).absolutePath())) {
+        *error = "cannot create output directory";
+        return false;
+    }
+
+    // 使用 QSaveFile 原子写入，失败时不会留下半个文件
+    QSaveFile output(targetPath);
+    if (!output.open(QIODevice::WriteOnly) || output.write(html) == -1 || !output.commit()) {
+        *error = output.errorString();
+        return false;
+    }
+
+    *bytesRead = rawData.size();
+    *bytesWritten = html.size();
+    return true;
+}
+
+int BatchExporter::runFromCommandLine(const QStringList &arguments)
+{
+    const QString usage = "Usage: WeatherApp --export <in-dir> <out-dir> [--theme dark|light] [--threads N]";
+
+    if (arguments.size() < 4) {
+        printLine(stderr, usage);
+        return 2;
+    }
+
+    Options options;
+    options.inputDir = arguments.at(2);
+    options.outputDir = arguments.at(3);
+
+    for (int i = 4; i < arguments.size(); ++i) {
+        const QString &argument = arguments.at(i);
+        if (argument == "--theme" && i + 1 < arguments.size()) {
+            options.isDark = arguments.at(++i) != "light";
+        } else if (argument == "--threads" && i + 1 < arguments.size()) {
+            options.threads = arguments.at(++i).toInt();
+        } else {
+            printLine(stderr, "Unknown option: " + argument);
+            printLine(stderr, usage);
+            return 2;
+        }
+    }
+
+    if (!QFileInfo(options.inputDir).isDir()) {
+        printLine(stderr, "Input directory not found: " + QDir::toNativeSeparators(options.inputDir));
+        return 2;
+    }
+
+    BatchExporter exporter(options);
+    const Stats stats = exporter.run();
+
+    const double seconds = qMax<qint64>(stats.elapsedMs, 1) / 1000.0;
+    const double inputMB = stats.bytesRead / (1024.0 * 1024.0);
+    const double outputMB = stats.bytesWritten / (1024.0 * 1024.0);
+
+    printLine(stdout, QString("Exported %1 file(s), %2 failed, in %3 s")
+                      .arg(stats.exported)
+                      .arg(stats.failed)
+                      .arg(seconds, 0, 'f', 3));
+    printLine(stdout, QString("Throughput: %1 files/s, %2 MB/s (read %3 MB, wrote %4 MB)")
+                      .arg(stats.exported / seconds, 0, 'f', 1)
+                      .arg(inputMB / seconds, 0, 'f', 2)
+                      .arg(inputMB, 0, 'f', 2)
+                      .arg(outputMB, 0, 'f', 2));
+
+    return stats.failed == 0 ? 0 : 1;
+}
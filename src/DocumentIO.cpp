@@ -0,0 +1,85 @@
+#include "DocumentIO.h"
+#include <QFile>
+#include <QSaveFile>
+
+bool DocumentIO::readFile(const QString &filePath, QByteArray *data, QString *error)
+{
+    QFile file(filePath);
+    if (!file.open(QFile::ReadOnly | QFile::Text)) {
+        *error = file.errorString();
+        return false;
+    }
+    *data = file.readAll();
+    return true;
+}
+
+DocumentIO::DecodeResult DocumentIO::decode(const QByteArray &rawData, Document *document)
+{
+    // Detect BOM and encoding
+    document->encoding = QStringConverter::Utf8;  // Default
+    document->bom.clear();
+    int bomSize = 0;
+
+    if (rawData.size() >= 3 &&
+        (unsigned char)rawData[0] == 0xEF &&
+        (unsigned char)rawData[1] == 0xBB &&
+        (unsigned char)rawData[2] == 0xBF) {
+        // UTF-8 BOM
+        document->encoding = QStringConverter::Utf8;
+        document->bom = rawData.left(3);
+        bomSize = 3;
+    } else if (rawData.size() >= 2) {
+        if ((unsigned char)rawData[0] == 0xFF && (unsigned char)rawData[1] == 0xFE) {
+            // UTF-16 LE BOM
+            document->encoding = QStringConverter::Utf16LE;
+            document->bom = rawData.left(2);
+            bomSize = 2;
+        } else if ((unsigned char)rawData[0] == 0xFE && (unsigned char)rawData[1] == 0xFF) {
+            // UTF-16 BE BOM
+            document->encoding = QStringConverter::Utf16BE;
+            document->bom = rawData.left(2);
+            bomSize = 2;
+        }
+    }
+
+    // Decode content
+    QStringDecoder decoder(document->encoding);
+    document->text = decoder(QByteArrayView(rawData).mid(bomSize));
+    if (!decoder.hasError()) {
+        return Decoded;
+    }
+
+    // Fallback to UTF-8
+    document->encoding = QStringConverter::Utf8;
+    QStringDecoder utf8Decoder(QStringConverter::Utf8);
+    document->text = utf8Decoder(rawData);
+    return utf8Decoder.hasError() ? DecodeFailed : DecodedAsUtf8;
+}
+
+bool DocumentIO::encode(Document *document, QByteArray *data)
+{
+    QStringEncoder encoder(document->encoding);
+    *data = encoder(document->text);
+    if (!encoder.hasError()) {
+        return true;
+    }
+
+    document->encoding = QStringConverter::Utf8;
+    QStringEncoder utf8Encoder(QStringConverter::Utf8);
+    *data = utf8Encoder(document->text);
+    return false;
+}
+
+bool DocumentIO::writeFile(const QString &filePath, const QByteArray &bom, const QByteArray &data, QString *error)
+{
+    // Use QSaveFile for atomic writes
+    QSaveFile file(filePath);
+    if (!file.open(QFile::WriteOnly | QFile::Text)
+        || (!bom.isEmpty() && file.write(bom) == -1)
+        || file.write(data) == -1
+        || !file.commit()) {
+        *error = file.errorString();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,457 @@
+#include "DocumentSearch.h"
+#include <QTextBlock>
+#include <QTextCursor>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// 受影响文本块不超过该数量时逐块替换，否则拼接整个区间一次性插入
+constexpr int kPerBlockEditLimit = 256;
+
+bool startsBefore(const DocumentSearch::Match &match, int position)
+{
+    return match.start < position;
+}
+
+bool endsBefore(const DocumentSearch::Match &match, int position)
+{
+    return match.start + match.length <= position;
+}
+
+} // namespace
+
+DocumentSearch::DocumentSearch(QObject *parent)
+    : QObject(parent)
+    , m_document(nullptr)
+    , m_caseSensitive(false)
+    , m_useRegex(false)
+    , m_suspended(false)
+{
+    m_skipTable.fill(1);
+}
+
+DocumentSearch::~DocumentSearch()
+{
+    // Qt handles cleanup
+}
+
+void DocumentSearch::setDocument(QTextDocument *document)
+{
+    if (m_document == document) {
+        return;
+    }
+
+    if (m_document) {
+        disconnect(m_document, nullptr, this, nullptr);
+    }
+
+    m_document = document;
+    if (m_document) {
+        connect(m_document, &QTextDocument::contentsChange,
+                this, &DocumentSearch::onContentsChange);
+    }
+
+    rescan();
+}
+
+void DocumentSearch::setQuery(const QString &pattern, bool caseSensitive, bool useRegex)
+{
+    if (pattern == m_pattern && caseSensitive == m_caseSensitive && useRegex == m_useRegex) {
+        return;
+    }
+
+    m_pattern = pattern;
+    m_caseSensitive = caseSensitive;
+    m_useRegex = useRegex;
+
+    if (m_useRegex) {
+        QRegularExpression::PatternOptions options = QRegularExpression::NoPatternOption;
+        if (!m_caseSensitive) {
+            options |= QRegularExpression::CaseInsensitiveOption;
+        }
+        m_regex = QRegularExpression(m_pattern, options);
+    } else {
+        m_regex = QRegularExpression();
+        rebuildSkipTable();
+    }
+
+    rescan();
+}
+
+void DocumentSearch::clear()
+{
+    setQuery(QString(), m_caseSensitive, m_useRegex);
+}
+
+QString DocumentSearch::pattern() const
+{
+    return m_pattern;
+}
+
+bool DocumentSearch::isActive() const
+{
+    if (m_pattern.isEmpty()) {
+        return false;
+    }
+    return !m_useRegex || m_regex.isValid();
+}
+
+QString DocumentSearch::errorString() const
+{
+    if (m_useRegex && !m_pattern.isEmpty() && !m_regex.isValid()) {
+        return m_regex.errorString();
+    }
+    return QString();
+}
+
+int DocumentSearch::matchCount() const
+{
+    return int(m_matches.size());
+}
+
+const std::vector<DocumentSearch::Match> &DocumentSearch::matches() const
+{
+    return m_matches;
+}
+
+std::pair<int, int> DocumentSearch::matchesInRange(int from, int to) const
+{
+    // 区间互不重叠，因此起点和终点都是有序的
+    auto first = std::lower_bound(m_matches.begin(), m_matches.end(), from, endsBefore);
+    auto last = std::lower_bound(first, m_matches.end(), to, startsBefore);
+    return {int(first - m_matches.begin()), int(last - m_matches.begin())};
+}
+
+int DocumentSearch::findNext(int position, bool backward) const
+{
+    if (m_matches.empty()) {
+        return -1;
+    }
+
+    auto it = std::lower_bound(m_matches.begin(), m_matches.end(), position, startsBefore);
+    int index = int(it - m_matches.begin());
+
+    if (backward) {
+        --index;
+        return index >= 0 ? index : int(m_matches.size()) - 1;
+    }
+    return index < int(m_matches.size()) ? index : 0;
+}
+
+int DocumentSearch::indexOf(int start, int length) const
+{
+    auto it = std::lower_bound(m_matches.begin(), m_matches.end(), start, startsBefore);
+    if (it != m_matches.end() && it->start == start && it->length == length) {
+        return int(it - m_matches.begin());
+    }
+    return -1;
+}
+
+int DocumentSearch::replaceAt(int index, const QString &replacement)
+{
+    if (!m_document || index < 0 || index >= int(m_matches.size())) {
+        return -1;
+    }
+
+    const Match match = m_matches[index];
+    QString text = replacement;
+
+    if (m_useRegex) {
+        // 重新匹配以取得捕获组，用于展开 \1 等反向引用
+        const QTextBlock block = m_document->findBlock(match.start);
+        const QString blockText = block.text();
+        const QRegularExpressionMatch regexMatch = m_regex.match(
+            blockText, match.start - block.position(),
+            QRegularExpression::NormalMatch, QRegularExpression::AnchorAtOffsetMatchOption);
+        if (regexMatch.hasMatch()) {
+            text = expandReplacement(replacement, regexMatch);
+        }
+    }
+
+    QTextCursor cursor(m_document);
+    cursor.setPosition(match.start);
+    cursor.setPosition(match.start + match.length, QTextCursor::KeepAnchor);
+    cursor.insertText(text);  // 由 contentsChange 增量更新匹配
+    return match.start + int(text.size());
+}
+
+int DocumentSearch::replaceAll(const QString &replacement)
+{
+    if (!m_document || m_matches.empty()) {
+        return 0;
+    }
+
+    const int count = int(m_matches.size());
+
+    // 收集包含匹配的文本块（匹配不会跨越文本块）
+    std::vector<QTextBlock> blocks;
+    int blockEnd = -1;
+    for (const Match &match : m_matches) {
+        if (match.start < blockEnd) {
+            continue;
+        }
+        const QTextBlock block = m_document->findBlock(match.start);
+        blocks.push_back(block);
+        blockEnd = block.position() + block.length();
+    }
+
+    // 批量编辑期间逐次触发增量更新会退化为 O(n²)，完成后统一重新扫描
+    m_suspended = true;
+
+    QTextCursor cursor(m_document);
+    cursor.beginEditBlock();
+
+    if (int(blocks.size()) <= kPerBlockEditLimit) {
+        // 从后向前替换，前面文本块的位置保持不变
+        for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+            const int position = it->position();
+            const int length = it->length() - 1;  // 不含段落分隔符
+            const QString text = replacedBlockText(*it, replacement);
+            cursor.setPosition(position);
+            cursor.setPosition(position + length, QTextCursor::KeepAnchor);
+            cursor.insertText(text);
+        }
+    } else {
+        // 大量替换：在内存中拼出整个受影响区间，只向文档插入一次
+        const QString raw = m_document->toRawText();
+        const int spanStart = blocks.front().position();
+        const int spanEnd = blocks.back().position() + blocks.back().length() - 1;
+
+        QString span;
+        span.reserve(spanEnd - spanStart + count * qMax<qsizetype>(0, replacement.size() - m_pattern.size()));
+
+        int position = spanStart;
+        for (const QTextBlock &block : blocks) {
+            span += QStringView(raw).mid(position, block.position() - position);
+            span += replacedBlockText(block, replacement);
+            position = block.position() + block.length() - 1;
+        }
+
+        cursor.setPosition(spanStart);
+        cursor.setPosition(spanEnd, QTextCursor::KeepAnchor);
+        cursor.insertText(span);
+    }
+
+    cursor.endEditBlock();
+    m_suspended = false;
+
+    rescan();
+    return count;
+}
+
+void DocumentSearch::onContentsChange(int position, int charsRemoved, int charsAdded)
+{
+    if (m_suspended || !m_document || !isActive()) {
+        return;
+    }
+
+    const int delta = charsAdded - charsRemoved;
+
+    // 受影响的文本块范围（新坐标）
+    QTextBlock first = m_document->findBlock(position);
+    if (!first.isValid()) {
+        first = m_document->lastBlock();
+    }
+    QTextBlock last = m_document->findBlock(position + charsAdded);
+    if (!last.isValid()) {
+        last = m_document->lastBlock();
+    }
+
+    const int rangeStart = first.position();
+    const int rangeEnd = last.position() + last.length();
+    const int oldRangeEnd = rangeEnd - delta;
+
+    // 丢弃旧范围内的匹配，平移其后的匹配
+    auto lower = std::lower_bound(m_matches.begin(), m_matches.end(), rangeStart, startsBefore);
+    auto upper = std::lower_bound(lower, m_matches.end(), oldRangeEnd, startsBefore);
+    if (delta != 0) {
+        for (auto it = upper; it != m_matches.end(); ++it) {
+            it->start += delta;
+        }
+    }
+
+    std::vector<Match> fresh;
+    scanBlocks(first, last, fresh);
+
+    const auto offset = lower - m_matches.begin();
+    m_matches.erase(lower, upper);
+    m_matches.insert(m_matches.begin() + offset, fresh.begin(), fresh.end());
+
+    emit matchesChanged();
+}
+
+void DocumentSearch::rescan()
+{
+    m_matches.clear();
+
+    if (m_document && isActive()) {
+        if (m_useRegex) {
+            scanBlocks(m_document->begin(), m_document->lastBlock(), m_matches);
+        } else {
+            // 普通模式直接扫描连续的原始文本；段落分隔符不会出现在查询中，
+            // 因此匹配不会跨越文本块，且位置与文档位置一一对应
+            const QString raw = m_document->toRawText();
+            scanPlain(raw, 0, m_matches);
+        }
+    }
+
+    emit matchesChanged();
+}
+
+void DocumentSearch::rebuildSkipTable()
+{
+    const qsizetype length = m_pattern.size();
+    m_skipTable.fill(int(qMax<qsizetype>(1, length)));
+
+    // 按低 8 位散列：冲突时保留最小跳距，结果仍然安全
+    const char16_t *needle = QStringView(m_pattern).utf16();
+    for (qsizetype i = 0; i + 1 < length; ++i) {
+        m_skipTable[needle[i] & 0xFF] = int(length - 1 - i);
+    }
+}
+
+void DocumentSearch::scanPlain(QStringView text, int basePosition, std::vector<Match> &out) const
+{
+    const qsizetype length = m_pattern.size();
+    if (length == 0 || text.size() < length) {
+        return;
+    }
+
+    if (!m_caseSensitive) {
+        // 不区分大小写时交给 Qt 的大小写折叠比较
+        qsizetype position = 0;
+        while ((position = text.indexOf(QStringView(m_pattern), position, Qt::CaseInsensitive)) >= 0) {
+            out.push_back({basePosition + int(position), int(length)});
+            position += length;
+        }
+        return;
+    }
+
+    if (length == 1) {
+        // 单字符：Qt 内部使用 SIMD 扫描，相当于 memchr
+        const QChar needle = m_pattern.at(0);
+        qsizetype position = 0;
+        while ((position = text.indexOf(needle, position)) >= 0) {
+            out.push_back({basePosition + int(position), 1});
+            ++position;
+        }
+        return;
+    }
+
+    // Boyer–Moore–Horspool：先比较窗口末字符，失配时按坏字符表跳转
+    const char16_t *haystack = text.utf16();
+    const char16_t *needle = QStringView(m_pattern).utf16();
+    const char16_t lastChar = needle[length - 1];
+    const qsizetype end = text.size() - length;
+
+    qsizetype i = 0;
+    while (i <= end) {
+        const char16_t c = haystack[i + length - 1];
+        if (c == lastChar && std::memcmp(haystack + i, needle, size_t(length - 1) * sizeof(char16_t)) == 0) {
+            out.push_back({basePosition + int(i), int(length)});
+            i += length;
+            continue;
+        }
+        i += m_skipTable[c & 0xFF];
+    }
+}
+
+void DocumentSearch::scanRegex(const QString &text, int basePosition, std::vector<Match> &out) const
+{
+    QRegularExpressionMatchIterator it = m_regex.globalMatch(text);
+    while (it.hasNext()) {
+        const QRegularExpressionMatch match = it.next();
+        // 忽略空匹配（例如 "a*"），它们无法高亮也无法替换
+        if (match.capturedLength() > 0) {
+            out.push_back({basePosition + int(match.capturedStart()), int(match.capturedLength())});
+        }
+    }
+}
+
+void DocumentSearch::scanBlocks(const QTextBlock &first, const QTextBlock &last, std::vector<Match> &out) const
+{
+    if (!first.isValid()) {
+        return;
+    }
+
+    const QTextBlock stop = last.isValid() ? last.next() : first.next();
+    for (QTextBlock block = first; block.isValid() && block != stop; block = block.next()) {
+        const QString text = block.text();
+        if (m_useRegex) {
+            scanRegex(text, block.position(), out);
+        } else {
+            scanPlain(text, block.position(), out);
+        }
+    }
+}
+
+QString DocumentSearch::replacedBlockText(const QTextBlock &block, const QString &replacement) const
+{
+    const QString text = block.text();
+    QString result;
+    result.reserve(text.size());
+
+    qsizetype cursor = 0;
+    if (m_useRegex) {
+        QRegularExpressionMatchIterator it = m_regex.globalMatch(text);
+        while (it.hasNext()) {
+            const QRegularExpressionMatch match = it.next();
+            if (match.capturedLength() == 0) {
+                continue;
+            }
+            result += QStringView(text).mid(cursor, match.capturedStart() - cursor);
+            result += expandReplacement(replacement, match);
+            cursor = match.capturedEnd();
+        }
+    } else {
+        std::vector<Match> local;
+        scanPlain(text, 0, local);
+        for (const Match &match : local) {
+            result += QStringView(text).mid(cursor, match.start - cursor);
+            result += replacement;
+            cursor = match.start + match.length;
+        }
+    }
+
+    result += QStringView(text).mid(cursor);
+    return result;
+}
+
+QString DocumentSearch::expandReplacement(const QString &replacement, const QRegularExpressionMatch &match) const
+{
+    if (!replacement.contains(QLatin1Char('\\'))) {
+        return replacement;
+    }
+
+    // 支持 \0-\99 反向引用与 \\ 转义，与 QString::replace 的约定一致
+    QString result;
+    result.reserve(replacement.size());
+    for (qsizetype i = 0; i < replacement.size(); ++i) {
+        const QChar c = replacement.at(i);
+        if (c != QLatin1Char('\\') || i + 1 >= replacement.size()) {
+            result += c;
+            continue;
+        }
+
+        const QChar next = replacement.at(i + 1);
+        if (next.isDigit()) {
+            int group = next.digitValue();
+            ++i;
+            if (i + 1 < replacement.size() && replacement.at(i + 1).isDigit()) {
+                const int twoDigits = group * 10 + replacement.at(i + 1).digitValue();
+                if (twoDigits <= m_regex.captureCount()) {
+                    group = twoDigits;
+                    ++i;
+                }
+            }
+            result += match.captured(group);
+        } else if (next == QLatin1Char('\\')) {
+            result += next;
+            ++i;
+        } else {
+            result += c;
+        }
+    }
+    return result;
+}
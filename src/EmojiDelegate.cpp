@@ -0,0 +1,47 @@
+#include "EmojiDelegate.h"
+#include "EmojiGlyphAtlas.h"
+#include "EmojiModel.h"
+#include <QGuiApplication>
+#include <QPainter>
+#include <QWidget>
+
+namespace {
+
+constexpr int kCellSize = 45;
+constexpr int kGlyphPixelSize = 24;
+
+// 字形使用视图字体，像素大小固定，与缩放无关
+QFont glyphFont(const QFont &base)
+{
+    QFont font = base;
+    font.setPixelSize(kGlyphPixelSize);
+    return font;
+}
+
+} // namespace
+
+void EmojiDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    const QRectF cell = QRectF(option.rect).adjusted(0.5, 0.5, -0.5, -0.5);
+    const bool hovered = option.state & QStyle::State_MouseOver;
+    const bool selected = option.state & QStyle::State_Selected;
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setPen(QPen(hovered ? option.palette.color(QPalette::Highlight) : option.palette.color(QPalette::Light),
+                         hovered ? 2 : 1));
+    painter->setBrush(selected ? option.palette.color(QPalette::Highlight)
+                               : option.palette.color(hovered ? QPalette::Light : QPalette::Button));
+    painter->drawRoundedRect(cell, 4, 4);
+    painter->restore();
+
+    const QScreen *screen = option.widget ? option.widget->screen() : QGuiApplication::primaryScreen();
+    EmojiGlyphAtlas &atlas = EmojiGlyphAtlas::forFont(glyphFont(option.font), screen,
+                                                      painter->device()->devicePixelRatioF());
+    atlas.draw(painter, option.rect, index.data(EmojiModel::TableIndexRole).toInt(), index.data().toString());
+}
+
+QSize EmojiDelegate::sizeHint(const QStyleOptionViewItem &, const QModelIndex &) const
+{
+    return QSize(kCellSize, kCellSize);
+}
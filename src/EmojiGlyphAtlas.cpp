@@ -0,0 +1,103 @@
+#include "EmojiGlyphAtlas.h"
+#include <QFontMetrics>
+#include <QGuiApplication>
+#include <QHash>
+#include <QPainter>
+#include <QPointer>
+#include <QRect>
+#include <QScreen>
+#include <QtMath>
+
+namespace {
+
+constexpr int kPageColumns = 8;
+constexpr int kCellsPerPage = kPageColumns * kPageColumns;
+
+// 图集缓存以 qApp 为父对象：QPixmap 必须在 QGuiApplication 析构之前释放，
+// 不能留给 main() 返回后的静态析构。退出事件循环时先清空，屏幕断开时丢弃其图集
+class AtlasCache : public QObject
+{
+public:
+    explicit AtlasCache(QGuiApplication *app)
+        : QObject(app)
+    {
+        connect(app, &QCoreApplication::aboutToQuit, this, [this]() { atlases.clear(); });
+        connect(app, &QGuiApplication::screenRemoved, this, [this](QScreen *screen) { atlases.remove(screen); });
+    }
+
+    // 屏幕 -> ("字体键|DPR" -> 图集)
+    QHash<const QScreen *, QHash<QString, std::shared_ptr<EmojiGlyphAtlas>>> atlases;
+};
+
+} // namespace
+
+EmojiGlyphAtlas &EmojiGlyphAtlas::forFont(const QFont &font, const QScreen *screen, qreal devicePixelRatio)
+{
+    // 图集数量等于用过的 (屏幕, 字体, DPR) 组合数
+    static QPointer<AtlasCache> cache;
+    if (!cache) {
+        cache = new AtlasCache(qGuiApp);
+    }
+
+    QHash<QString, std::shared_ptr<EmojiGlyphAtlas>> &atlases = cache->atlases[screen];
+    const QString key = font.key() + '|' + QString::number(devicePixelRatio);
+    auto it = atlases.constFind(key);
+    if (it == atlases.constEnd()) {
+        it = atlases.insert(key, std::shared_ptr<EmojiGlyphAtlas>(new EmojiGlyphAtlas(font, devicePixelRatio)));
+    }
+    return **it;
+}
+
+EmojiGlyphAtlas::EmojiGlyphAtlas(const QFont &font, qreal devicePixelRatio)
+    : m_font(font)
+    , m_devicePixelRatio(devicePixelRatio)
+    , m_cellSize(QFontMetrics(font).height() + 4)
+{
+}
+
+QSize EmojiGlyphAtlas::cellSize() const
+{
+    return QSize(m_cellSize, m_cellSize);
+}
+
+void EmojiGlyphAtlas::draw(QPainter *painter, const QRect &target, int index, const QString &glyph)
+{
+    if (index < 0) {
+        return;
+    }
+
+    const int pageIndex = index / kCellsPerPage;
+    const int slot = index % kCellsPerPage;
+    if (pageIndex >= m_pages.size()) {
+        m_pages.resize(pageIndex + 1);
+    }
+
+    std::shared_ptr<Page> &page = m_pages[pageIndex];
+    if (!page) {
+        const int side = qCeil(kPageColumns * m_cellSize * m_devicePixelRatio);
+        page = std::make_shared<Page>();
+        page->pixmap = QPixmap(side, side);
+        page->pixmap.setDevicePixelRatio(m_devicePixelRatio);
+        page->pixmap.fill(Qt::transparent);
+        page->rendered.resize(kCellsPerPage);
+    }
+    if (!page->rendered.testBit(slot)) {
+        render(page.get(), slot, glyph);
+    }
+
+    const qreal cellPixels = m_cellSize * m_devicePixelRatio;
+    const QRectF source((slot % kPageColumns) * cellPixels, (slot / kPageColumns) * cellPixels, cellPixels, cellPixels);
+    QRect cell(QPoint(0, 0), cellSize());
+    cell.moveCenter(target.center());
+    painter->drawPixmap(QRectF(cell), page->pixmap, source);
+}
+
+void EmojiGlyphAtlas::render(Page *page, int slot, const QString &glyph)
+{
+    QPainter painter(&page->pixmap);
+    painter.setRenderHint(QPainter::TextAntialiasing);
+    painter.setFont(m_font);
+    const QRect cell((slot % kPageColumns) * m_cellSize, (slot / kPageColumns) * m_cellSize, m_cellSize, m_cellSize);
+    painter.drawText(cell, Qt::AlignCenter, glyph);
+    page->rendered.setBit(slot);
+}
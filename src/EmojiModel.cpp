@@ -0,0 +1,67 @@
+#include "EmojiModel.h"
+#include "EmojiTable.h"
+
+const QStringList &EmojiModel::emojis()
+{
+    static const QStringList emojis = []() {
+        QStringList list;
+        list.reserve(EmojiTable::kCount);
+        for (const EmojiTable::Entry &entry : EmojiTable::kEntries) {
+            list.append(QString::fromUtf8(entry.glyph));
+        }
+        return list;
+    }();
+    return emojis;
+}
+
+void EmojiModel::setTableIndices(const QVector<int> &indices)
+{
+    if (m_filtered && indices == m_indices) {
+        return;
+    }
+    beginResetModel();
+    m_filtered = true;
+    m_indices = indices;
+    endResetModel();
+}
+
+void EmojiModel::showAll()
+{
+    if (!m_filtered) {
+        return;
+    }
+    beginResetModel();
+    m_filtered = false;
+    m_indices.clear();
+    endResetModel();
+}
+
+int EmojiModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_filtered ? m_indices.size() : emojis().size();
+}
+
+QVariant EmojiModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= rowCount()) {
+        return QVariant();
+    }
+    switch (role) {
+    case Qt::DisplayRole:
+        return emojis().at(tableIndex(index.row()));
+    case Qt::ToolTipRole:
+        return QString::fromUtf8(EmojiTable::kEntries[tableIndex(index.row())].name);
+    case TableIndexRole:
+        return tableIndex(index.row());
+    default:
+        return QVariant();
+    }
+}
+
+int EmojiModel::tableIndex(int row) const
+{
+    return m_filtered ? m_indices.at(row) : row;
+}
@@ -0,0 +1,134 @@
+#include "EmojiSearchIndex.h"
+#include "EmojiModel.h"
+#include "EmojiTable.h"
+#include <algorithm>
+
+namespace {
+
+constexpr int kNameTier = 0;
+constexpr int kKeywordTier = 1;
+constexpr quint8 kNoMatch = 0xff;
+
+// 名称、关键词与查询使用同一种切分：字母和数字以外的字符都是分隔符
+QStringList tokenize(const QString &text)
+{
+    QStringList tokens;
+    QString current;
+    for (QChar ch : text) {
+        if (ch.isLetterOrNumber()) {
+            current.append(ch.toLower());
+        } else if (!current.isEmpty()) {
+            tokens.append(current);
+            current.clear();
+        }
+    }
+    if (!current.isEmpty()) {
+        tokens.append(current);
+    }
+    return tokens;
+}
+
+} // namespace
+
+const EmojiSearchIndex &EmojiSearchIndex::instance()
+{
+    static const EmojiSearchIndex index;
+    return index;
+}
+
+EmojiSearchIndex::EmojiSearchIndex()
+{
+    for (int i = 0; i < EmojiTable::kCount; ++i) {
+        // 重复出现的表情（同时属于两个分类）合并到第一次出现的位置
+        const QString &glyph = EmojiModel::emojis().at(i);
+        if (!m_glyphIndex.contains(glyph)) {
+            m_glyphIndex.insert(glyph, i);
+        }
+        const int index = m_glyphIndex.value(glyph);
+
+        const EmojiTable::Entry &entry = EmojiTable::kEntries[i];
+        addTerms(entry.name, index, kNameTier, false);
+        addTerms(entry.keywords, index, kKeywordTier, false);
+        addTerms(entry.nameZh, index, kNameTier, true);
+        addTerms(entry.keywordsZh, index, kKeywordTier, true);
+    }
+
+    // 同一表情的同一词条只保留优先级最高的一条
+    std::sort(m_keys.begin(), m_keys.end(), [](const Key &a, const Key &b) {
+        if (a.text != b.text) {
+            return a.text < b.text;
+        }
+        return a.tableIndex != b.tableIndex ? a.tableIndex < b.tableIndex : a.tier < b.tier;
+    });
+    m_keys.erase(std::unique(m_keys.begin(), m_keys.end(),
+                             [](const Key &a, const Key &b) {
+                                 return a.text == b.text && a.tableIndex == b.tableIndex;
+                             }),
+                 m_keys.end());
+    m_keys.shrink_to_fit();
+}
+
+void EmojiSearchIndex::addTerms(const char *utf8, int tableIndex, int tier, bool withSuffixes)
+{
+    for (const QString &token : tokenize(QString::fromUtf8(utf8))) {
+        m_keys.push_back({token, tableIndex, tier});
+        if (!withSuffixes) {
+            continue;
+        }
+        // 从每个非 ASCII 字符开始的后缀：中文没有词边界，按子串匹配
+        for (int pos = 1; pos < token.size(); ++pos) {
+            if (token.at(pos).unicode() >= 0x80) {
+                m_keys.push_back({token.mid(pos), tableIndex, tier});
+            }
+        }
+    }
+}
+
+QVector<int> EmojiSearchIndex::search(const QString &query, const QVector<float> &usageScores) const
+{
+    const QStringList terms = tokenize(query);
+    if (terms.isEmpty()) {
+        return {};
+    }
+
+    // matchedTerms[i]：表情 i 连续匹配了前几个查询词；rank[i]：最好的匹配等级
+    std::vector<quint8> matchedTerms(EmojiTable::kCount, 0);
+    std::vector<quint8> rank(EmojiTable::kCount, kNoMatch);
+
+    for (int t = 0; t < terms.size(); ++t) {
+        const QString &term = terms.at(t);
+        auto it = std::lower_bound(m_keys.begin(), m_keys.end(), term,
+                                   [](const Key &key, const QString &value) { return key.text < value; });
+        for (; it != m_keys.end() && it->text.startsWith(term); ++it) {
+            const int index = it->tableIndex;
+            if (matchedTerms[index] < t) {
+                continue;  // 之前的查询词没有匹配
+            }
+            matchedTerms[index] = quint8(t + 1);
+            // 完整匹配优先于前缀匹配，名称优先于关键词
+            const int keyRank = it->tier * 2 + (it->text.size() == term.size() ? 0 : 1);
+            rank[index] = quint8(qMin<int>(rank[index], keyRank));
+        }
+    }
+
+    QVector<int> results;
+    for (int i = 0; i < EmojiTable::kCount; ++i) {
+        if (matchedTerms[i] == terms.size()) {
+            results.append(i);
+        }
+    }
+
+    auto score = [&](int index) { return index < usageScores.size() ? usageScores.at(index) : 0.0f; };
+    std::stable_sort(results.begin(), results.end(), [&](int a, int b) {
+        if (score(a) != score(b)) {
+            return score(a) > score(b);
+        }
+        return rank[a] < rank[b];
+    });
+    return results;
+}
+
+int EmojiSearchIndex::tableIndexOf(const QString &glyph) const
+{
+    return m_glyphIndex.value(glyph, -1);
+}
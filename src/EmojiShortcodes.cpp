@@ -0,0 +1,304 @@
+#include "EmojiShortcodes.h"
+#include "EmojiShortcodeHash.h"
+#include "EmojiTable.h"
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+namespace {
+
+struct Alias
+{
+    const char *code;
+    const char *glyph;
+};
+
+// 常用别名（与 GitHub/Slack 的短代码一致）；与名称派生的短代码重复的不再列出
+constexpr Alias kAliases[] = {
+    {"smile", "😄"}, {"smiley", "😃"}, {"grinning", "😀"}, {"grin", "😁"},
+    {"laughing", "😆"}, {"satisfied", "😆"}, {"sweat_smile", "😅"}, {"joy", "😂"},
+    {"rofl", "🤣"}, {"slightly_smiling", "🙂"}, {"wink", "😉"}, {"blush", "😊"},
+    {"innocent", "😇"}, {"heart_eyes", "😍"}, {"kissing_heart", "😘"}, {"yum", "😋"},
+    {"stuck_out_tongue", "😛"}, {"stuck_out_tongue_winking_eye", "😜"}, {"money_mouth", "🤑"}, {"hugs", "🤗"},
+    {"shush", "🤫"}, {"thinking", "🤔"}, {"zipper_mouth", "🤐"}, {"raised_eyebrow", "🤨"},
+    {"expressionless", "😑"}, {"no_mouth", "😶"}, {"smirk", "😏"}, {"unamused", "😒"},
+    {"roll_eyes", "🙄"}, {"grimacing", "😬"}, {"lying", "🤥"}, {"relieved", "😌"},
+    {"pensive", "😔"}, {"sleepy", "😪"}, {"drooling", "🤤"}, {"sleeping", "😴"},
+    {"mask", "😷"}, {"nauseated", "🤢"}, {"vomiting", "🤮"}, {"sneezing", "🤧"},
+    {"hot", "🥵"}, {"cold", "🥶"}, {"woozy", "🥴"}, {"dizzy_face", "😵"},
+    {"mind_blown", "🤯"}, {"cowboy", "🤠"}, {"partying", "🥳"}, {"sunglasses", "😎"},
+    {"nerd", "🤓"}, {"monocle", "🧐"}, {"confused", "😕"}, {"worried", "😟"},
+    {"frowning", "😦"}, {"open_mouth", "😮"}, {"hushed", "😯"}, {"astonished", "😲"},
+    {"flushed", "😳"}, {"pleading", "🥺"}, {"fearful", "😨"}, {"cold_sweat", "😰"},
+    {"cry", "😢"}, {"sob", "😭"}, {"scream", "😱"}, {"confounded", "😖"},
+    {"persevere", "😣"}, {"disappointed", "😞"}, {"sweat", "😓"}, {"weary", "😩"},
+    {"tired", "😫"}, {"yawning", "🥱"}, {"triumph", "😤"}, {"rage", "😡"},
+    {"angry", "😠"}, {"cursing", "🤬"}, {"smiling_imp", "😈"}, {"imp", "👿"},
+    {"skull_crossbones", "☠️"}, {"poop", "💩"}, {"hankey", "💩"}, {"shit", "💩"},
+    {"clown", "🤡"}, {"wave", "👋"}, {"hand", "✋"}, {"vulcan", "🖖"},
+    {"ok", "👌"}, {"v", "✌️"}, {"love_you", "🤟"}, {"metal", "🤘"},
+    {"call_me", "🤙"}, {"point_left", "👈"}, {"point_right", "👉"}, {"point_up_2", "👆"},
+    {"point_up", "☝️"}, {"point_down", "👇"}, {"fu", "🖕"}, {"+1", "👍"},
+    {"thumbsup", "👍"}, {"-1", "👎"}, {"thumbsdown", "👎"}, {"fist", "✊"},
+    {"punch", "👊"}, {"facepunch", "👊"}, {"clap", "👏"}, {"raised_hands", "🙌"},
+    {"pray", "🙏"}, {"muscle", "💪"}, {"see_no_evil", "🙈"}, {"hear_no_evil", "🙉"},
+    {"speak_no_evil", "🙊"}, {"mouse", "🐭"}, {"rabbit", "🐰"}, {"bee", "🐝"},
+    {"ladybug", "🐞"}, {"beetle", "🐞"}, {"apple", "🍎"}, {"orange", "🍊"},
+    {"corn", "🌽"}, {"fries", "🍟"}, {"ramen", "🍜"}, {"curry", "🍛"},
+    {"dumplings", "🥟"}, {"cake", "🍰"}, {"coffee", "☕"}, {"tea", "🍵"},
+    {"beer", "🍺"}, {"beers", "🍻"}, {"champagne", "🍾"}, {"soccer", "⚽"},
+    {"football", "🏈"}, {"8ball", "🎱"}, {"dart", "🎯"}, {"art", "🎨"},
+    {"car", "🚗"}, {"red_car", "🚗"}, {"bike", "🚲"}, {"bulb", "💡"},
+    {"computer", "💻"}, {"iphone", "📱"}, {"phone", "☎️"}, {"moneybag", "💰"},
+    {"gem", "💎"}, {"hocho", "🔪"}, {"knife", "🔪"}, {"heart", "❤️"},
+    {"cupid", "💘"}, {"100", "💯"}, {"anger", "💢"}, {"x", "❌"},
+    {"o", "⭕"}, {"heavy_check_mark", "✅"}, {"white_check_mark", "✅"}, {"exclamation", "❗"},
+    {"question", "❓"}, {"no_entry_sign", "🚫"}, {"recycle", "♻️"}, {"sos", "🆘"},
+    {"checkered_flag", "🏁"}, {"cn", "🇨🇳"}, {"us", "🇺🇸"}, {"uk", "🇬🇧"},
+    {"gb", "🇬🇧"}, {"jp", "🇯🇵"}, {"kr", "🇰🇷"}, {"fr", "🇫🇷"},
+    {"de", "🇩🇪"}, {"it", "🇮🇹"}, {"es", "🇪🇸"}, {"ru", "🇷🇺"},
+};
+
+constexpr int kMaxCodeLength = 40;
+constexpr int kSourceCount = EmojiTable::kCount + int(std::size(kAliases));
+// 平均每个桶约 4 个键：位移表小，生成时大桶仍容易放下；须与生成脚本一致
+constexpr int kBucketCount = kSourceCount / 4 + 1;
+
+struct Source
+{
+    char code[kMaxCodeLength + 1];
+    int length;
+    const char *glyph;
+    std::uint64_t hash;
+};
+
+constexpr bool isCodeChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '+' || c == '-';
+}
+
+// FNV-1a：编译期与运行期逐字符使用同一个函数
+constexpr std::uint64_t hashStep(std::uint64_t hash, char c)
+{
+    return (hash ^ std::uint8_t(c)) * 0x100000001b3ull;
+}
+
+constexpr std::uint64_t kHashSeed = 0xcbf29ce484222325ull;
+
+// 第二个独立的哈希值，用作探测步长
+constexpr std::uint64_t mix(std::uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+constexpr int bucketOf(std::uint64_t hash)
+{
+    return int((hash >> 32) % kBucketCount);
+}
+
+constexpr int slotOf(std::uint64_t hash, std::uint32_t displacement, int tableSize)
+{
+    const std::uint64_t d0 = displacement >> 16;
+    const std::uint64_t d1 = displacement & 0xffff;
+    return int((std::uint32_t(hash) + d0 * (mix(hash) | 1) + d1) % std::uint64_t(tableSize));
+}
+
+// 名称派生的短代码："flag: china" -> flag_china，"t-rex" -> t_rex
+constexpr Source makeSource(const char *text, const char *glyph, bool fromName)
+{
+    Source source{};
+    source.glyph = glyph;
+    bool pendingSeparator = false;
+    for (const char *p = text; *p; ++p) {
+        const char c = *p;
+        if (fromName && !((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))) {
+            pendingSeparator = source.length > 0;
+            continue;
+        }
+        if (!isCodeChar(c) || source.length + (pendingSeparator ? 2 : 1) > kMaxCodeLength) {
+            throw "invalid emoji shortcode";
+        }
+        if (pendingSeparator) {
+            source.code[source.length++] = '_';
+            pendingSeparator = false;
+        }
+        source.code[source.length++] = c;
+    }
+
+    source.hash = kHashSeed;
+    for (int i = 0; i < source.length; ++i) {
+        source.hash = hashStep(source.hash, source.code[i]);
+    }
+    return source;
+}
+
+constexpr std::array<Source, kSourceCount> makeSources()
+{
+    std::array<Source, kSourceCount> sources{};
+    for (int i = 0; i < EmojiTable::kCount; ++i) {
+        sources[i] = makeSource(EmojiTable::kEntries[i].name, EmojiTable::kEntries[i].glyph, true);
+    }
+    for (int i = 0; i < int(std::size(kAliases)); ++i) {
+        sources[EmojiTable::kCount + i] = makeSource(kAliases[i].code, kAliases[i].glyph, false);
+    }
+    return sources;
+}
+
+constexpr auto kSources = makeSources();
+
+constexpr bool sameCode(const Source &a, const Source &b)
+{
+    if (a.length != b.length) {
+        return false;
+    }
+    for (int i = 0; i < a.length; ++i) {
+        if (a.code[i] != b.code[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool sameGlyph(const char *a, const char *b)
+{
+    for (; *a && *a == *b; ++a, ++b) {
+    }
+    return *a == *b;
+}
+
+constexpr int kTableSize = EmojiShortcodeHash::kTableSize;
+
+static_assert(int(std::size(EmojiShortcodeHash::kDisplacements)) == kBucketCount,
+              "EmojiShortcodeHash.h is out of date: run scripts/generate_emoji_shortcode_hash.py");
+static_assert(kTableSize <= 0xffff, "slot indices are stored as 16-bit values");
+
+struct PerfectHash
+{
+    std::array<std::uint16_t, kTableSize> slots{};  // 槽位 -> kSources 下标
+};
+
+/**
+ * 位移由 scripts/generate_emoji_shortcode_hash.py 预先算好，这里只按位移把每个键
+ * 放进它的槽位并检查：同一个短代码只保留第一次出现（例如同时列在两个分类下的表情），
+ * 不同的短代码落在同一个槽位或槽位没有填满，说明表格改过而位移没有重新生成。
+ */
+constexpr PerfectHash makePerfectHash()
+{
+    PerfectHash table;
+    std::array<bool, kTableSize> occupied{};
+    int filled = 0;
+
+    for (int i = 0; i < kSourceCount; ++i) {
+        const std::uint64_t hash = kSources[i].hash;
+        const int slot = slotOf(hash, EmojiShortcodeHash::kDisplacements[bucketOf(hash)], kTableSize);
+        if (occupied[slot]) {
+            if (!sameCode(kSources[table.slots[slot]], kSources[i])) {
+                throw "EmojiShortcodeHash.h is out of date: run scripts/generate_emoji_shortcode_hash.py";
+            }
+            if (!sameGlyph(kSources[table.slots[slot]].glyph, kSources[i].glyph)) {
+                throw "emoji shortcode maps to two different glyphs";
+            }
+            continue;
+        }
+        occupied[slot] = true;
+        table.slots[slot] = std::uint16_t(i);
+        ++filled;
+    }
+
+    if (filled != kTableSize) {
+        throw "EmojiShortcodeHash.h is out of date: run scripts/generate_emoji_shortcode_hash.py";
+    }
+    return table;
+}
+
+constexpr auto kPerfectHash = makePerfectHash();
+
+} // namespace
+
+namespace EmojiShortcodes {
+
+const char *lookup(QStringView code)
+{
+    if (code.isEmpty() || code.size() > kMaxCodeLength) {
+        return nullptr;
+    }
+
+    std::uint64_t hash = kHashSeed;
+    for (QChar ch : code) {
+        if (ch.unicode() > 0x7f) {
+            return nullptr;
+        }
+        hash = hashStep(hash, char(ch.unicode()));
+    }
+
+    const Source &source = kSources[kPerfectHash.slots[slotOf(hash, EmojiShortcodeHash::kDisplacements[bucketOf(hash)], kTableSize)]];
+    if (source.length != code.size()) {
+        return nullptr;
+    }
+    for (int i = 0; i < source.length; ++i) {
+        if (source.code[i] != code.at(i).unicode()) {
+            return nullptr;
+        }
+    }
+    return source.glyph;
+}
+
+void expand(QString &text)
+{
+    // 大多数行没有冒号，直接返回
+    int colon = text.indexOf(QLatin1Char(':'));
+    if (colon < 0) {
+        return;
+    }
+
+    QString result;
+    int copied = 0;
+    while (colon >= 0) {
+        // 找到下一个冒号之前只允许短代码字符
+        int end = colon + 1;
+        while (end < text.size() && end - colon - 1 <= kMaxCodeLength && text.at(end).unicode() < 0x80
+               && isCodeChar(char(text.at(end).unicode()))) {
+            ++end;
+        }
+        if (end >= text.size() || text.at(end) != QLatin1Char(':')) {
+            colon = text.indexOf(QLatin1Char(':'), end);
+            continue;
+        }
+
+        const char *glyph = lookup(QStringView(text).mid(colon + 1, end - colon - 1));
+        if (!glyph) {
+            // 右侧的冒号可能是下一个短代码的开头
+            colon = end;
+            continue;
+        }
+
+        if (result.isEmpty()) {
+            result.reserve(text.size());
+        }
+        result.append(QStringView(text).mid(copied, colon - copied));
+        result.append(QString::fromUtf8(glyph));
+        copied = end + 1;
+        colon = text.indexOf(QLatin1Char(':'), copied);
+    }
+
+    if (copied > 0) {
+        result.append(QStringView(text).mid(copied));
+        text = result;
+    }
+}
+
+QStringList codes()
+{
+    QStringList list;
+    list.reserve(kTableSize);
+    for (std::uint16_t index : kPerfectHash.slots) {
+        list.append(QString::fromLatin1(kSources[index].code, kSources[index].length));
+    }
+    list.sort();
+    return list;
+}
+
+} // namespace EmojiShortcodes
@@ -0,0 +1,109 @@
+#include "EmojiUsageStore.h"
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QTimer>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr double kHalfLifeHours = 7 * 24;
+
+} // namespace
+
+EmojiUsageStore::EmojiUsageStore(const QString &filePath, QObject *parent)
+    : QObject(parent)
+    , m_filePath(filePath)
+    , m_saveTimer(new QTimer(this))
+{
+    // 连续插入多个表情时合并为一次磁盘写入
+    m_saveTimer->setSingleShot(true);
+    m_saveTimer->setInterval(2000);
+    connect(m_saveTimer, &QTimer::timeout, this, &EmojiUsageStore::flush);
+
+    load();
+}
+
+EmojiUsageStore::~EmojiUsageStore()
+{
+    if (m_saveTimer->isActive()) {
+        flush();
+    }
+}
+
+void EmojiUsageStore::record(const QString &glyph)
+{
+    Usage &usage = m_usage[glyph];
+    usage.count += 1;
+    usage.lastUsed = QDateTime::currentDateTimeUtc();
+    m_saveTimer->start();
+}
+
+float EmojiUsageStore::score(const QString &glyph, const QDateTime &now) const
+{
+    auto it = m_usage.constFind(glyph);
+    if (it == m_usage.constEnd()) {
+        return 0;
+    }
+    const double ageHours = qMax<qint64>(0, it->lastUsed.secsTo(now)) / 3600.0;
+    return float(it->count * std::exp2(-ageHours / kHalfLifeHours));
+}
+
+QStringList EmojiUsageStore::mostUsed(int limit) const
+{
+    const QDateTime now = QDateTime::currentDateTimeUtc();
+    QStringList glyphs = m_usage.keys();
+    std::sort(glyphs.begin(), glyphs.end(), [&](const QString &a, const QString &b) {
+        return score(a, now) > score(b, now);
+    });
+    return glyphs.mid(0, limit);
+}
+
+void EmojiUsageStore::flush()
+{
+    m_saveTimer->stop();
+
+    QJsonObject root;
+    for (auto it = m_usage.constBegin(); it != m_usage.constEnd(); ++it) {
+        QJsonObject item;
+        item["count"] = it->count;
+        item["lastUsed"] = it->lastUsed.toString(Qt::ISODate);
+        root[it.key()] = item;
+    }
+
+    if (!QDir().mkpath(QFileInfo(m_filePath).absolutePath())) {
+        qWarning() << "Cannot create emoji usage directory for" << m_filePath;
+        return;
+    }
+
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) == -1
+        || !file.commit()) {
+        qWarning() << "Cannot write emoji usage:" << file.errorString();
+    }
+}
+
+void EmojiUsageStore::load()
+{
+    QFile file(m_filePath);
+    if (!file.open(QFile::ReadOnly)) {
+        return;
+    }
+
+    // 文件损坏时从空记录开始，下次写入会覆盖
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    for (auto it = root.constBegin(); it != root.constEnd(); ++it) {
+        const QJsonObject item = it.value().toObject();
+        const int count = item.value("count").toInt();
+        const QDateTime lastUsed = QDateTime::fromString(item.value("lastUsed").toString(), Qt::ISODate);
+        if (count > 0 && lastUsed.isValid()) {
+            m_usage.insert(it.key(), {count, lastUsed});
+        }
+    }
+}
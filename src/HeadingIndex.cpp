@@ -0,0 +1,233 @@
+#include "HeadingIndex.h"
+#include <algorithm>
+
+namespace {
+
+// QTextBlock::userState() 取值：文本块末尾是否处于 ``` 围栏内
+constexpr int kStateNormal = 0;
+constexpr int kStateInFence = 1;
+
+bool blockBefore(const HeadingIndex::Heading &heading, int blockNumber)
+{
+    return heading.blockNumber < blockNumber;
+}
+
+bool blockAfter(int blockNumber, const HeadingIndex::Heading &heading)
+{
+    return blockNumber < heading.blockNumber;
+}
+
+} // namespace
+
+HeadingIndex::HeadingIndex(QObject *parent)
+    : QAbstractListModel(parent)
+    , m_document(nullptr)
+    , m_blockCount(0)
+{
+}
+
+HeadingIndex::~HeadingIndex()
+{
+    // Qt handles cleanup
+}
+
+void HeadingIndex::setDocument(QTextDocument *document)
+{
+    if (m_document == document) {
+        return;
+    }
+
+    if (m_document) {
+        disconnect(m_document, nullptr, this, nullptr);
+    }
+
+    m_document = document;
+    if (m_document) {
+        connect(m_document, &QTextDocument::contentsChange,
+                this, &HeadingIndex::onContentsChange);
+    }
+
+    rebuild();
+}
+
+const std::vector<HeadingIndex::Heading> &HeadingIndex::headings() const
+{
+    return m_headings;
+}
+
+int HeadingIndex::headingIndexForBlock(int blockNumber) const
+{
+    auto it = std::upper_bound(m_headings.begin(), m_headings.end(), blockNumber, blockAfter);
+    return int(it - m_headings.begin()) - 1;
+}
+
+int HeadingIndex::headingLevel(const QString &line, QString *title)
+{
+    int level = 0;
+    if (line.startsWith(QLatin1String("# "))) {
+        level = 1;
+    } else if (line.startsWith(QLatin1String("## "))) {
+        level = 2;
+    } else if (line.startsWith(QLatin1String("### "))) {
+        level = 3;
+    }
+
+    if (level > 0 && title) {
+        *title = line.mid(level + 1).trimmed();
+    }
+    return level;
+}
+
+int HeadingIndex::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : int(m_headings.size());
+}
+
+QVariant HeadingIndex::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= int(m_headings.size())) {
+        return QVariant();
+    }
+
+    const Heading &heading = m_headings[index.row()];
+    switch (role) {
+    case Qt::DisplayRole: {
+        // 按级别缩进
+        const QString title = heading.title.isEmpty() ? QStringLiteral("(untitled)") : heading.title;
+        return QString(2 * (heading.level - 1), QLatin1Char(' ')) + title;
+    }
+    case Qt::ToolTipRole:
+        return heading.title;
+    case LevelRole:
+        return heading.level;
+    case BlockNumberRole:
+        return heading.blockNumber;
+    default:
+        return QVariant();
+    }
+}
+
+void HeadingIndex::onContentsChange(int position, int charsRemoved, int charsAdded)
+{
+    Q_UNUSED(charsRemoved);
+
+    if (!m_document) {
+        return;
+    }
+
+    const int blockCount = m_document->blockCount();
+    const int delta = blockCount - m_blockCount;
+    m_blockCount = blockCount;
+
+    QTextBlock first = m_document->findBlock(position);
+    if (!first.isValid()) {
+        first = m_document->lastBlock();
+    }
+    QTextBlock last = m_document->findBlock(position + charsAdded);
+    if (!last.isValid()) {
+        last = m_document->lastBlock();
+    }
+
+    const int firstNumber = first.blockNumber();
+    const int lastNumber = last.blockNumber();
+    const int oldLastNumber = lastNumber - delta;
+
+    // 旧范围之后的条目只需平移行号
+    auto lower = std::lower_bound(m_headings.begin(), m_headings.end(), firstNumber, blockBefore);
+    auto upper = std::upper_bound(lower, m_headings.end(), oldLastNumber, blockAfter);
+    if (delta != 0) {
+        for (auto it = upper; it != m_headings.end(); ++it) {
+            it->blockNumber += delta;
+        }
+    }
+
+    std::vector<Heading> fresh;
+    const QTextBlock parsedEnd = parseBlocks(first, last, fresh);
+
+    // 围栏状态翻转时解析会越过 last，这些文本块的旧条目也需要替换
+    const int stopNumber = qMax(lastNumber, parsedEnd.blockNumber());
+    upper = std::upper_bound(upper, m_headings.end(), stopNumber, blockAfter);
+
+    replaceRange(int(lower - m_headings.begin()), int(upper - m_headings.begin()), fresh);
+}
+
+void HeadingIndex::rebuild()
+{
+    beginResetModel();
+    m_headings.clear();
+    m_blockCount = 0;
+
+    if (m_document) {
+        m_blockCount = m_document->blockCount();
+        // 首次解析：清空状态，确保所有文本块都被遍历
+        for (QTextBlock block = m_document->begin(); block.isValid(); block = block.next()) {
+            block.setUserState(-1);
+        }
+        parseBlocks(m_document->begin(), m_document->lastBlock(), m_headings);
+    }
+
+    endResetModel();
+}
+
+QTextBlock HeadingIndex::parseBlocks(const QTextBlock &first, const QTextBlock &last, std::vector<Heading> &out)
+{
+    const QTextBlock previous = first.previous();
+    bool inFence = previous.isValid() && previous.userState() == kStateInFence;
+
+    const int lastNumber = last.blockNumber();
+    int number = first.blockNumber();
+    QTextBlock parsed = first;
+
+    for (QTextBlock block = first; block.isValid(); block = block.next(), ++number) {
+        const QString text = block.text();
+        if (text.startsWith(QLatin1String("```"))) {
+            inFence = !inFence;
+        } else if (!inFence) {
+            QString title;
+            const int level = headingLevel(text, &title);
+            if (level > 0) {
+                out.push_back({number, level, title});
+            }
+        }
+
+        const int oldState = block.userState();
+        const int newState = inFence ? kStateInFence : kStateNormal;
+        block.setUserState(newState);
+        parsed = block;
+
+        // 已越过变更范围且状态未变：后续文本块的解析结果不受影响
+        if (number >= lastNumber && oldState == newState) {
+            break;
+        }
+    }
+
+    return parsed;
+}
+
+void HeadingIndex::replaceRange(int from, int to, std::vector<Heading> &fresh)
+{
+    const int oldCount = to - from;
+    const int newCount = int(fresh.size());
+    const int common = qMin(oldCount, newCount);
+
+    for (int i = 0; i < common; ++i) {
+        Heading &current = m_headings[from + i];
+        const bool visibleChange = current.level != fresh[i].level || current.title != fresh[i].title;
+        current = std::move(fresh[i]);
+        if (visibleChange) {
+            emit dataChanged(index(from + i), index(from + i));
+        }
+    }
+
+    if (newCount > oldCount) {
+        beginInsertRows(QModelIndex(), from + common, from + newCount - 1);
+        m_headings.insert(m_headings.begin() + from + common,
+                          std::make_move_iterator(fresh.begin() + common),
+                          std::make_move_iterator(fresh.end()));
+        endInsertRows();
+    } else if (oldCount > newCount) {
+        beginRemoveRows(QModelIndex(), from + common, from + oldCount - 1);
+        m_headings.erase(m_headings.begin() + from + common, m_headings.begin() + to);
+        endRemoveRows();
+    }
+}
@@ -0,0 +1,109 @@
+#include "LatencyHistogram.h"
+#include <cmath>
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+void LatencyHistogram::record(qint64 micros)
+{
+    micros = qMax<qint64>(0, micros);
+    ++m_counts[bucketIndex(micros)];
+    m_min = m_total == 0 ? micros : qMin(m_min, micros);
+    m_max = qMax(m_max, micros);
+    m_sum += double(micros);
+    ++m_total;
+}
+
+void LatencyHistogram::reset()
+{
+    m_counts.fill(0);
+    m_total = 0;
+    m_min = 0;
+    m_max = 0;
+    m_sum = 0;
+}
+
+qint64 LatencyHistogram::count() const
+{
+    return m_total;
+}
+
+qint64 LatencyHistogram::min() const
+{
+    return m_min;
+}
+
+qint64 LatencyHistogram::max() const
+{
+    return m_max;
+}
+
+double LatencyHistogram::mean() const
+{
+    return m_total > 0 ? m_sum / double(m_total) : 0.0;
+}
+
+qint64 LatencyHistogram::valueAtPercentile(double percentile) const
+{
+    if (m_total == 0) {
+        return 0;
+    }
+
+    // 第 rank 个样本（从 1 开始）所在的桶
+    const qint64 rank = qMax<qint64>(1, qint64(std::ceil(qBound(0.0, percentile, 100.0) / 100.0 * double(m_total))));
+    qint64 seen = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+        seen += m_counts[i];
+        if (seen >= rank) {
+            // 桶中间值，但不超出实际观测到的范围
+            const qint64 middle = (bucketLowerBound(i) + bucketUpperBound(i)) / 2;
+            return qBound(m_min, middle, m_max);
+        }
+    }
+    return m_max;
+}
+
+qint64 LatencyHistogram::bucketCount(int index) const
+{
+    return m_counts[index];
+}
+
+qint64 LatencyHistogram::bucketLowerBound(int index)
+{
+    if (index < kSubBucketCount) {
+        return index;
+    }
+    const int shift = (index - kSubBucketCount) / kHalfSubBucketCount + 1;
+    const qint64 sub = (index - kSubBucketCount) % kHalfSubBucketCount + kHalfSubBucketCount;
+    return sub << shift;
+}
+
+qint64 LatencyHistogram::bucketUpperBound(int index)
+{
+    if (index < kSubBucketCount) {
+        return index;
+    }
+    const int shift = (index - kSubBucketCount) / kHalfSubBucketCount + 1;
+    return bucketLowerBound(index) + (qint64(1) << shift) - 1;
+}
+
+int LatencyHistogram::bucketIndex(qint64 micros)
+{
+    if (micros < kSubBucketCount) {
+        return int(micros);
+    }
+
+    // 最高位决定段，其后 6 位决定段内的子桶
+    int msb = 0;
+    for (qint64 v = micros; v > 1; v >>= 1) {
+        ++msb;
+    }
+    const int shift = msb - (kSubBucketBits - 1);
+    if (shift > kMaxShift) {
+        return kBucketCount - 1;
+    }
+    const int sub = int(micros >> shift);  // [64, 127]
+    return kSubBucketCount + (shift - 1) * kHalfSubBucketCount + (sub - kHalfSubBucketCount);
+}
@@ -0,0 +1,127 @@
+#include "LatencyHud.h"
+#include "LatencyMonitor.h"
+#include <QAbstractScrollArea>
+#include <QContextMenuEvent>
+#include <QDir>
+#include <QEvent>
+#include <QFileDialog>
+#include <QMenu>
+#include <QMessageBox>
+#include <QScrollBar>
+#include <QTimer>
+
+namespace {
+
+constexpr int kRefreshIntervalMs = 500;
+constexpr int kMargin = 8;
+
+QString formatMs(qint64 micros)
+{
+    return QString::number(micros / 1000.0, 'f', 1);
+}
+
+QString percentileLine(const QString &label, const LatencyHistogram &histogram)
+{
+    return QString("%1  p50 %2  p95 %3  p99 %4 ms  (n=%5)")
+        .arg(label,
+             formatMs(histogram.valueAtPercentile(50)),
+             formatMs(histogram.valueAtPercentile(95)),
+             formatMs(histogram.valueAtPercentile(99)))
+        .arg(histogram.count());
+}
+
+} // namespace
+
+LatencyHud::LatencyHud(QWidget *editor)
+    : QLabel(editor)
+    , m_refreshTimer(new QTimer(this))
+{
+    setObjectName("latencyHud");
+    setTextFormat(Qt::PlainText);
+    setToolTip(tr("Right-click to export the latency histograms (CSV/JSON) or reset them"));
+    editor->installEventFilter(this);
+
+    m_refreshTimer->setInterval(kRefreshIntervalMs);
+    connect(m_refreshTimer, &QTimer::timeout, this, &LatencyHud::refresh);
+}
+
+bool LatencyHud::eventFilter(QObject *watched, QEvent *event)
+{
+    if (watched == parentWidget() && event->type() == QEvent::Resize) {
+        reposition();
+    }
+    return QLabel::eventFilter(watched, event);
+}
+
+void LatencyHud::showEvent(QShowEvent *event)
+{
+    QLabel::showEvent(event);
+    LatencyMonitor::instance().setEnabled(true);
+    m_refreshTimer->start();
+    refresh();
+}
+
+void LatencyHud::hideEvent(QHideEvent *event)
+{
+    QLabel::hideEvent(event);
+    m_refreshTimer->stop();
+    LatencyMonitor::instance().setEnabled(false);
+}
+
+void LatencyHud::contextMenuEvent(QContextMenuEvent *event)
+{
+    QMenu menu(this);
+    menu.addAction(tr("Export CSV..."), this, [this]() { exportTo(false); });
+    menu.addAction(tr("Export JSON..."), this, [this]() { exportTo(true); });
+    menu.addSeparator();
+    menu.addAction(tr("Reset"), this, [this]() {
+        LatencyMonitor::instance().reset();
+        refresh();
+    });
+    menu.exec(event->globalPos());
+}
+
+void LatencyHud::refresh()
+{
+    const LatencyMonitor &monitor = LatencyMonitor::instance();
+    const LatencyHistogram &lag = monitor.histogram(LatencyMonitor::EventLoopLag);
+
+    setText(QStringList{
+        percentileLine(tr("Key to paint"), monitor.histogram(LatencyMonitor::KeyToPaint)),
+        percentileLine(tr("Preview render"), monitor.histogram(LatencyMonitor::PreviewRender)),
+        tr("Event loop  p99 %1  max %2 ms").arg(formatMs(lag.valueAtPercentile(99)), formatMs(lag.max())),
+        percentileLine(tr("Theme switch"), monitor.histogram(LatencyMonitor::ThemeSwitch)),
+    }.join('\n'));
+    adjustSize();
+    reposition();
+}
+
+void LatencyHud::reposition()
+{
+    QWidget *editor = parentWidget();
+    int right = editor->width() - kMargin;
+    if (QAbstractScrollArea *area = qobject_cast<QAbstractScrollArea *>(editor)) {
+        if (area->verticalScrollBar()->isVisible()) {
+            right -= area->verticalScrollBar()->width();
+        }
+    }
+    move(right - width(), kMargin);
+    raise();
+}
+
+void LatencyHud::exportTo(bool json)
+{
+    const QString filter = json ? tr("JSON files (*.json)") : tr("CSV files (*.csv)");
+    const QString defaultName = QDir::home().filePath(json ? "latency.json" : "latency.csv");
+    const QString filePath = QFileDialog::getSaveFileName(this, tr("Export Latency Histograms"), defaultName, filter);
+    if (filePath.isEmpty()) {
+        return;
+    }
+
+    const LatencyMonitor &monitor = LatencyMonitor::instance();
+    QString error;
+    const bool ok = json ? monitor.exportJson(filePath, &error) : monitor.exportCsv(filePath, &error);
+    if (!ok) {
+        QMessageBox::warning(this, tr("Export Failed"), tr("Could not write %1: %2").arg(filePath, error));
+    }
+}
@@ -0,0 +1,204 @@
+#include "LatencyMonitor.h"
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPointer>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QTimer>
+
+namespace {
+
+constexpr int kLagIntervalMs = 50;
+// 超过该值的"输入到绘制"多半跨越了模态对话框或窗口切换，不计入
+constexpr qint64 kMaxInputLatencyNs = 1000LL * 1000 * 1000;
+// 连续输入但迟迟没有绘制时最多保留的时间戳
+constexpr int kMaxPendingInputs = 256;
+
+const double kPercentiles[] = {50, 95, 99, 99.9};
+
+} // namespace
+
+LatencyMonitor &LatencyMonitor::instance()
+{
+    // 以 qApp 为父对象：定时器必须在 QCoreApplication 析构之前释放，
+    // 不能留给 main() 返回后的静态析构
+    static QPointer<LatencyMonitor> monitor;
+    if (!monitor) {
+        monitor = new LatencyMonitor(QCoreApplication::instance());
+    }
+    return *monitor;
+}
+
+LatencyMonitor::LatencyMonitor(QObject *parent)
+    : QObject(parent)
+    , m_enabled(false)
+    , m_lagTimer(new QTimer(this))
+    , m_lastTickNs(0)
+{
+    m_clock.start();
+    m_lagTimer->setTimerType(Qt::PreciseTimer);
+    m_lagTimer->setInterval(kLagIntervalMs);
+    connect(m_lagTimer, &QTimer::timeout, this, &LatencyMonitor::onLagTick);
+
+    // 退出事件循环时停止卡顿检测，不再唤醒
+    if (QCoreApplication *app = QCoreApplication::instance()) {
+        connect(app, &QCoreApplication::aboutToQuit, this, [this]() { setEnabled(false); });
+    }
+}
+
+void LatencyMonitor::setEnabled(bool enabled)
+{
+    if (enabled == m_enabled) {
+        return;
+    }
+    m_enabled = enabled;
+    m_pendingInputs.clear();
+
+    // 卡顿检测每 50 ms 唤醒一次，只在启用时运行
+    if (m_enabled) {
+        m_lastTickNs = m_clock.nsecsElapsed();
+        m_lagTimer->start();
+    } else {
+        m_lagTimer->stop();
+    }
+}
+
+bool LatencyMonitor::isEnabled() const
+{
+    return m_enabled;
+}
+
+void LatencyMonitor::inputReceived()
+{
+    if (!m_enabled || m_pendingInputs.size() >= kMaxPendingInputs) {
+        return;
+    }
+    m_pendingInputs.append(m_clock.nsecsElapsed());
+}
+
+void LatencyMonitor::inputPainted()
+{
+    if (!m_enabled || m_pendingInputs.isEmpty()) {
+        return;
+    }
+
+    const qint64 now = m_clock.nsecsElapsed();
+    for (qint64 received : std::as_const(m_pendingInputs)) {
+        const qint64 latency = now - received;
+        if (latency <= kMaxInputLatencyNs) {
+            m_histograms[KeyToPaint].record(latency / 1000);
+        }
+    }
+    m_pendingInputs.clear();
+}
+
+void LatencyMonitor::record(Metric metric, qint64 micros)
+{
+    if (m_enabled) {
+        m_histograms[metric].record(micros);
+    }
+}
+
+const LatencyHistogram &LatencyMonitor::histogram(Metric metric) const
+{
+    return m_histograms[metric];
+}
+
+QString LatencyMonitor::metricName(Metric metric)
+{
+    switch (metric) {
+    case KeyToPaint:
+        return QStringLiteral("key_to_paint");
+    case PreviewRender:
+        return QStringLiteral("preview_render");
+    case EventLoopLag:
+        return QStringLiteral("event_loop_lag");
+    case ThemeSwitch:
+        return QStringLiteral("theme_switch");
+    case MetricCount:
+        break;
+    }
+    return QString();
+}
+
+void LatencyMonitor::reset()
+{
+    for (LatencyHistogram &histogram : m_histograms) {
+        histogram.reset();
+    }
+    m_pendingInputs.clear();
+}
+
+bool LatencyMonitor::exportCsv(const QString &filePath, QString *error) const
+{
+    QByteArray data;
+    QTextStream out(&data);
+    out << "metric,count,min_us,p50_us,p95_us,p99_us,p999_us,max_us,mean_us\n";
+    for (int i = 0; i < MetricCount; ++i) {
+        const LatencyHistogram &histogram = m_histograms[i];
+        out << metricName(Metric(i)) << ',' << histogram.count() << ',' << histogram.min();
+        for (double percentile : kPercentiles) {
+            out << ',' << histogram.valueAtPercentile(percentile);
+        }
+        out << ',' << histogram.max() << ',' << qRound64(histogram.mean()) << '\n';
+    }
+    out.flush();
+    return writeFile(filePath, data, error);
+}
+
+bool LatencyMonitor::exportJson(const QString &filePath, QString *error) const
+{
+    QJsonObject metrics;
+    for (int i = 0; i < MetricCount; ++i) {
+        const LatencyHistogram &histogram = m_histograms[i];
+
+        // 只导出非空桶：[下界, 上界, 计数]，单位微秒
+        QJsonArray buckets;
+        for (int b = 0; b < LatencyHistogram::kBucketCount; ++b) {
+            if (histogram.bucketCount(b) > 0) {
+                buckets.append(QJsonArray{LatencyHistogram::bucketLowerBound(b),
+                                          LatencyHistogram::bucketUpperBound(b),
+                                          histogram.bucketCount(b)});
+            }
+        }
+
+        QJsonObject metric;
+        metric["count"] = histogram.count();
+        metric["min_us"] = histogram.min();
+        metric["p50_us"] = histogram.valueAtPercentile(50);
+        metric["p95_us"] = histogram.valueAtPercentile(95);
+        metric["p99_us"] = histogram.valueAtPercentile(99);
+        metric["p999_us"] = histogram.valueAtPercentile(99.9);
+        metric["max_us"] = histogram.max();
+        metric["mean_us"] = histogram.mean();
+        metric["buckets"] = buckets;
+        metrics[metricName(Metric(i))] = metric;
+    }
+
+    QJsonObject root;
+    root["generated"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    root["lag_interval_ms"] = kLagIntervalMs;
+    root["metrics"] = metrics;
+    return writeFile(filePath, QJsonDocument(root).toJson(QJsonDocument::Indented), error);
+}
+
+void LatencyMonitor::onLagTick()
+{
+    const qint64 now = m_clock.nsecsElapsed();
+    const qint64 lateNs = now - m_lastTickNs - qint64(kLagIntervalMs) * 1000 * 1000;
+    m_lastTickNs = now;
+    m_histograms[EventLoopLag].record(qMax<qint64>(0, lateNs / 1000));
+}
+
+bool LatencyMonitor::writeFile(const QString &filePath, const QByteArray &data, QString *error) const
+{
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        *error = file.errorString();
+        return false;
+    }
+    return true;
+}
@@ -9,6 +9,20 @@
 #include <QTimer>
 #include <QRegularExpression>
 #include "MarkdownEditor.h"
+#include "MarkdownRenderer.h"
+#include "PreviewTheme.h"
+#include "ThemeManager.h"
+#include "StartupTracer.h"
+#include "LatencyMonitor.h"
+#include "PreviewSnapshotCache.h"
+#include "DocumentIO.h"
+#include "WeatherWorker.h"
+#include "NativeWeatherBackend.h"
+#include "WeatherCache.h"
+#include "WeatherDashboardModel.h"
+#include <QHeaderView>
+#include <QJsonArray>
+#include <QTableView>
 #include <QCoreApplication>
 #include <QDir>
 #include <QFileInfo>
@@ -21,7 +35,13 @@
 #include <QShortcut>
 #include <QWheelEvent>
 #include <QStringConverter>
-#include <QSaveFile>
+#include <QScrollBar>
+#include <QTextBlock>
+#include <QHash>
+#include <QFontInfo>
+#include <QElapsedTimer>
+
+using Settings::Key;
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -33,6 +53,7 @@ MainWindow::MainWindow(QWidget *parent)
     , m_weatherTempLabel(nullptr)
     , m_weatherConditionLabel(nullptr)
     , m_weatherDetailsLabel(nullptr)
+    , m_weatherSparkline(nullptr)
     , m_defaultCityCombo(nullptr)
     , m_refreshButton(nullptr)
     , m_contentArea(nullptr)
@@ -42,83 +63,134 @@ MainWindow::MainWindow(QWidget *parent)
     , m_markdownEditor(nullptr)
     , m_markdownPreview(nullptr)
     , m_zoomResetButton(nullptr)
-    , m_process(new QProcess(this))
-    , m_processTimeout(new QTimer(this))
-    , m_pythonRestartAttempts(0)
-    , m_maxRestartAttempts(3)
-    , m_restartTimer(new QTimer(this))
+    , m_previewZoomOverlay(nullptr)
+    , m_latencyHud(nullptr)
+    , m_outlineDock(nullptr)
+    , m_outlineView(nullptr)
+    , m_headingIndex(nullptr)
+    , m_pdfExporter(new PdfExporter(this))
+    , m_pdfProgress(nullptr)
+    , m_previewSnapshots(QDir(QCoreApplication::applicationDirPath()).filePath("cache/preview"))
+    , m_weatherBackend(nullptr)
+    , m_weatherRequests(nullptr)
+    , m_weatherSupervisor(nullptr)
+    , m_refreshScheduler(nullptr)
+    , m_weatherCache(nullptr)
+    , m_weatherHistory(QDir(QCoreApplication::applicationDirPath()).filePath("cache/history"))
+    , m_dashboardModel(nullptr)
+    , m_dashboardView(nullptr)
+    , m_dashboardRequestId(0)
     , m_currentFilePath("")
     , m_isModified(false)
     , m_currentEncoding(QStringConverter::Utf8)
     , m_currentZoom(DEFAULT_ZOOM)
-    , m_previewBaseZoom(1.0)
+    , m_previewZoom(DEFAULT_ZOOM)
+    , m_previewBasePointSize(0)
+    , m_zoomController(nullptr)
     , m_previewUpdateTimer(new QTimer(this))
-    , m_zoomSettingsSaveTimer(new QTimer(this))
 {
-    // 使用应用程序目录下的 config.ini 初始化设置
-    QString settingsPath = QDir(QCoreApplication::applicationDirPath()).filePath("config.ini");
-    m_settings = new QSettings(settingsPath, QSettings::IniFormat, this);
-
-    // 配置进程超时（30 秒）
-    m_processTimeout->setSingleShot(true);
-    m_processTimeout->setInterval(30000);
-    connect(m_processTimeout, &QTimer::timeout, this, &MainWindow::onProcessTimeout);
-    
-    // 配置重启定时器
-    m_restartTimer->setSingleShot(true);
-    connect(m_restartTimer, &QTimer::timeout, this, &MainWindow::attemptPythonRestart);
+    // 所有设置通过 SettingsManager 访问（内存缓存，后台合并写入 config.ini）
+    m_settings = &SettingsManager::instance();
+    StartupTracer::mark("settings");
+
+    // 每个城市最近一次的天气：先显示缓存值，过期时在后台刷新
+    m_weatherCache = new WeatherCache(QDir(QCoreApplication::applicationDirPath()).filePath("cache/weather.json"),
+                                      m_settings->get<Key::WeatherCacheTtl>(), this);
+
+    // 天气后端：默认为常驻 Python 工作进程，"native" 时直接在进程内发起 HTTP 请求
+    // 两者的响应都按请求 id 返回，格式相同
+    if (m_settings->get<Key::WeatherBackend>() == "native") {
+        m_weatherBackend = new NativeWeatherBackend(NativeWeatherBackend::defaultGeocodeTablePath(), this);
+    } else {
+        WeatherWorker *worker = new WeatherWorker(this);
+        connect(worker, &WeatherWorker::failedToStart, this, [this]() {
+            m_pythonExecutable.clear();  // 下次请求时重新查找
+        });
+        m_weatherBackend = worker;
+    }
+    connect(m_weatherBackend, &WeatherBackend::weatherReady, this, [this](int requestId, const QJsonObject &response) {
+        if (requestId == m_dashboardRequestId) {
+            onDashboardReady(response);
+        }
+    });
+    connect(m_weatherBackend, &WeatherBackend::requestFailed, this, [this](int requestId, const QString &error) {
+        if (requestId == m_dashboardRequestId) {
+            onDashboardFailed(error);
+        }
+    });
+
+    // 侧边栏只关心最新选择的城市：快速切换时只发出最后一个请求
+    m_weatherRequests = new WeatherRequestCoordinator(m_weatherBackend, this);
+    connect(m_weatherRequests, &WeatherRequestCoordinator::weatherReady, this, &MainWindow::onWeatherReady);
+    connect(m_weatherRequests, &WeatherRequestCoordinator::requestFailed, this, &MainWindow::onWeatherFailed);
+
+    // 监督者：超时与卡死检测、退避重启、连续失败后熔断（全部基于定时器，不阻塞界面）
+    WeatherSupervisor::Policy supervisorPolicy;
+    supervisorPolicy.restartDelayMs = m_settings->get<Key::PythonRestartDelay>();
+    supervisorPolicy.maxFailures = m_settings->get<Key::PythonRestartAttempts>();
+    m_weatherSupervisor = new WeatherSupervisor(m_weatherBackend, supervisorPolicy, this);
+    connect(m_weatherSupervisor, &WeatherSupervisor::circuitOpened, this, [this](int retryAfterMs) {
+        handleWeatherError(QString("Weather service failed repeatedly. Retrying in %1 s.").arg((retryAfterMs + 999) / 1000));
+    });
+    connect(m_weatherSupervisor, &WeatherSupervisor::circuitClosed, this, &MainWindow::loadWeatherForDefaultCity);
+    connect(m_weatherSupervisor, &WeatherSupervisor::statsChanged, this, &MainWindow::updateWeatherStatsToolTip);
+
+    // 后台刷新：所有城市一次批量请求，间隔随天气变化快慢调整，窗口不可见时暂停
+    WeatherRefreshScheduler::Policy refreshPolicy;
+    refreshPolicy.initialIntervalSecs = m_settings->get<Key::WeatherRefreshInterval>();
+    m_refreshScheduler = new WeatherRefreshScheduler(refreshPolicy, this);
+    connect(m_refreshScheduler, &WeatherRefreshScheduler::refreshDue, this, [this]() {
+        refreshDashboard(true);
+        if (m_dashboardRequestId == 0) {
+            m_refreshScheduler->refreshFinished();  // 没有发出请求（熔断中等），按原间隔重新安排
+        }
+    });
     
     // Configure preview update timer for debouncing (200ms delay)
     m_previewUpdateTimer->setSingleShot(true);
     m_previewUpdateTimer->setInterval(200);
-    connect(m_previewUpdateTimer, &QTimer::timeout, this, [this]() {
-        QString markdownText = m_markdownEditor->toPlainText();
-        QString enhancedHtml = enhanceMarkdownPreview(markdownText);
-        m_markdownPreview->setHtml(enhancedHtml);
-    });
-    
-    // Configure zoom settings save timer for debouncing (500ms delay)
-    m_zoomSettingsSaveTimer->setSingleShot(true);
-    m_zoomSettingsSaveTimer->setInterval(500);
-    connect(m_zoomSettingsSaveTimer, &QTimer::timeout, this, [this]() {
-        m_settings->setValue("zoomLevel", m_currentZoom);
-    });
+    connect(m_previewUpdateTimer, &QTimer::timeout, this, &MainWindow::refreshPreview);
 
     setupUI();
+    StartupTracer::watchFirstPaint(m_markdownEditor->viewport());
     setWindowTitle("mdCoder");
     setWindowIcon(QIcon(":/icon/md_coder.ico"));
 
     // Restore window geometry and state
-    if (m_settings->contains("geometry")) {
-        restoreGeometry(m_settings->value("geometry").toByteArray());
+    const QByteArray geometry = m_settings->get<Key::WindowGeometry>();
+    if (!geometry.isEmpty()) {
+        restoreGeometry(geometry);
     } else {
         resize(1200, 700);
     }
-    if (m_settings->contains("windowState")) {
-        restoreState(m_settings->value("windowState").toByteArray());
+    const QByteArray state = m_settings->get<Key::WindowState>();
+    if (!state.isEmpty()) {
+        restoreState(state);
     }
 
-    // Restore zoom level
-    if (m_settings->contains("zoomLevel")) {
-        double savedZoom = m_settings->value("zoomLevel").toDouble();
-        setZoom(savedZoom);
+    // Restore zoom level（首帧之前直接应用，不经过逐帧合并）
+    setZoom(m_settings->get<Key::Zoom>());
+    m_zoomController->flush();
+    StartupTracer::mark("restore geometry");
+
+    // 恢复上次打开的文件、光标与滚动位置
+    restoreSession();
+    StartupTracer::mark("restore session");
+
+    if (m_settings->get<Key::LatencyHud>()) {
+        setLatencyHudVisible(true);
     }
 
-    // Load weather for default city on startup
+    // 缓存的天气立即显示；启动 Python 放到首帧之后
+    m_currentCity = m_defaultCityCombo->currentText();
+    showCachedWeather(m_currentCity);
+    updateSparkline(m_currentCity);
     QTimer::singleShot(500, this, &MainWindow::loadWeatherForDefaultCity);
 }
 
 MainWindow::~MainWindow()
 {
-    // 确保进程已终止
-    if (m_process && m_process->state() != QProcess::NotRunning) {
-        m_process->terminate();
-        if (!m_process->waitForFinished(3000)) {
-            m_process->kill();
-            m_process->waitForFinished(1000);
-        }
-    }
-    // Qt 通过父子关系自动处理清理工作
+    // Qt 通过父子关系自动处理清理工作（天气后端析构时关闭 Python 进程或中止网络请求）
 }
 
 void MainWindow::closeEvent(QCloseEvent *event)
@@ -130,22 +202,18 @@ void MainWindow::closeEvent(QCloseEvent *event)
     }
 
     // 保存窗口几何形状和状态
-    m_settings->setValue("geometry", saveGeometry());
-    m_settings->setValue("windowState", saveState());
-
-    // 确保在关闭前进程已终止
-    if (m_process && m_process->state() != QProcess::NotRunning) {
-        m_process->terminate();
-        if (!m_process->waitForFinished(3000)) {
-            m_process->kill();
-            m_process->waitForFinished(1000);
-        }
-    }
+    m_settings->set<Key::WindowGeometry>(saveGeometry());
+    m_settings->set<Key::WindowState>(saveState());
+    saveSession();
+
     QMainWindow::closeEvent(event);
 }
 
 void MainWindow::setupUI()
 {
+    // 窗口级样式表与主题无关，只设置一次；颜色来自调色板与 ThemeManager 注册的部件
+    setStyleSheet(ThemeManager::instance().baseStyleSheet());
+
     // Create central widget
     m_centralWidget = new QWidget(this);
     m_centralWidget->setObjectName("centralWidget");
@@ -160,6 +228,8 @@ void MainWindow::setupUI()
     m_sidebar = new QWidget(this);
     m_sidebar->setObjectName("sidebar");
     m_sidebar->setFixedWidth(240);
+    m_sidebar->setAutoFillBackground(true);
+    m_sidebar->setBackgroundRole(QPalette::Base);
     
     m_sidebarLayout = new QVBoxLayout(m_sidebar);
     m_sidebarLayout->setContentsMargins(15, 15, 15, 15);
@@ -168,11 +238,13 @@ void MainWindow::setupUI()
     // Sidebar title
     QLabel *sidebarTitle = new QLabel("🌤️ Weather", this);
     sidebarTitle->setObjectName("sidebarTitle");
+    sidebarTitle->setForegroundRole(QPalette::Link);
     m_sidebarLayout->addWidget(sidebarTitle);
     
     // Default city selector
     QLabel *defaultCityLabel = new QLabel("Default City:", this);
     defaultCityLabel->setProperty("class", "secondaryLabel");
+    defaultCityLabel->setForegroundRole(QPalette::PlaceholderText);
     m_sidebarLayout->addWidget(defaultCityLabel);
     
     m_defaultCityCombo = new QComboBox(this);
@@ -186,7 +258,7 @@ void MainWindow::setupUI()
     });
     
     // Load saved default city
-    QString savedCity = m_settings->value("defaultCity", "Beijing").toString();
+    QString savedCity = m_settings->get<Key::DefaultCity>();
     int index = m_defaultCityCombo->findText(savedCity);
     if (index >= 0) {
         m_defaultCityCombo->setCurrentIndex(index);
@@ -199,7 +271,7 @@ void MainWindow::setupUI()
     m_sidebarLayout->addWidget(m_refreshButton);
 
     // Theme toggle button
-    QString currentTheme = m_settings->value("theme", "dark").toString();
+    const QString currentTheme = m_settings->get<Key::Theme>();
     m_themeButton = new QPushButton(currentTheme == "dark" ? "☀️ Light Mode" : "🌙 Dark Mode", this);
     m_sidebarLayout->addWidget(m_themeButton);
     
@@ -212,15 +284,18 @@ void MainWindow::setupUI()
     // Weather display area
     m_weatherCityLabel = new QLabel("Loading...", this);
     m_weatherCityLabel->setObjectName("weatherCityLabel");
+    m_weatherCityLabel->setForegroundRole(QPalette::Link);
     m_weatherCityLabel->setWordWrap(true);
     m_sidebarLayout->addWidget(m_weatherCityLabel);
     
     m_weatherTempLabel = new QLabel("--°C", this);
     m_weatherTempLabel->setObjectName("weatherTempLabel");
+    m_weatherTempLabel->setForegroundRole(QPalette::Link);
     m_sidebarLayout->addWidget(m_weatherTempLabel);
     
     m_weatherConditionLabel = new QLabel("--", this);
     m_weatherConditionLabel->setObjectName("weatherConditionLabel");
+    m_weatherConditionLabel->setForegroundRole(QPalette::LinkVisited);
     m_weatherConditionLabel->setWordWrap(true);
     m_sidebarLayout->addWidget(m_weatherConditionLabel);
     
@@ -229,6 +304,14 @@ void MainWindow::setupUI()
     m_weatherDetailsLabel->setWordWrap(true);
     m_weatherDetailsLabel->setTextFormat(Qt::RichText);
     m_sidebarLayout->addWidget(m_weatherDetailsLabel);
+
+    // 最近 24 小时的温度走势（没有历史数据时隐藏）
+    m_weatherSparkline = new SparklineWidget(this);
+    m_weatherSparkline->setObjectName("weatherSparkline");
+    m_weatherSparkline->setForegroundRole(QPalette::Highlight);
+    m_weatherSparkline->setToolTip("Temperature, last 24 hours");
+    m_weatherSparkline->hide();
+    m_sidebarLayout->addWidget(m_weatherSparkline);
     
     // Add stretch to push everything to the top
     m_sidebarLayout->addStretch();
@@ -279,6 +362,12 @@ void MainWindow::setupUI()
     connect(saveAsButton, &QPushButton::clicked, this, &MainWindow::saveFileAs);
     toolbarLayout->addWidget(saveAsButton);
 
+    QPushButton *exportPdfButton = new QPushButton("📄", this);
+    exportPdfButton->setToolTip("Export PDF (Ctrl+P)");
+    exportPdfButton->setFixedSize(35, 35);
+    connect(exportPdfButton, &QPushButton::clicked, this, &MainWindow::exportPdf);
+    toolbarLayout->addWidget(exportPdfButton);
+
     toolbarLayout->addSpacing(15);
 
     // Zoom control buttons - compact design
@@ -316,6 +405,21 @@ void MainWindow::setupUI()
     m_markdownPreview = new QTextBrowser(this);
     m_markdownPreview->setObjectName("markdownPreview");
     m_markdownPreview->setOpenExternalLinks(true);
+    m_markdownPreview->setUndoRedoEnabled(false);  // 主题切换就地修改格式，不需要撤销记录
+    m_previewBasePointSize = QFontInfo(m_markdownPreview->font()).pointSizeF();
+
+    // 缩放手势期间覆盖在预览视口上，显示上一次布局的截图
+    m_previewZoomOverlay = new QLabel(m_markdownPreview);
+    m_previewZoomOverlay->setObjectName("previewZoomOverlay");
+    m_previewZoomOverlay->setAutoFillBackground(true);
+    m_previewZoomOverlay->setBackgroundRole(QPalette::Base);
+    m_previewZoomOverlay->setAlignment(Qt::AlignLeft | Qt::AlignTop);
+    m_previewZoomOverlay->hide();
+
+    // 连续的缩放请求每帧最多应用一次，预览只在输入停止后重新布局
+    m_zoomController = new ZoomController(m_currentZoom, this);
+    connect(m_zoomController, &ZoomController::frame, this, &MainWindow::applyZoomFrame);
+    connect(m_zoomController, &ZoomController::settled, this, &MainWindow::applyPreviewZoom);
 
     // Use QSplitter to allow resizing between editor and preview
     QSplitter *splitter = new QSplitter(Qt::Horizontal, this);
@@ -329,16 +433,8 @@ void MainWindow::setupUI()
     splitter->setStretchFactor(0, 1);
     splitter->setStretchFactor(1, 1);
 
-    // Style the splitter handle
+    // Style the splitter handle (colors from the palette)
     splitter->setHandleWidth(3);
-    splitter->setStyleSheet(
-        "QSplitter::handle {"
-        "    background-color: #3d3d3d;"
-        "}"
-        "QSplitter::handle:hover {"
-        "    background-color: #00d4ff;"
-        "}"
-    );
 
     QWidget *notesWidget = new QWidget(this);
     QVBoxLayout *notesLayout = new QVBoxLayout(notesWidget);
@@ -346,17 +442,85 @@ void MainWindow::setupUI()
     notesLayout->setSpacing(0);
     notesLayout->addWidget(splitter);
 
+    // ========== DASHBOARD TAB ==========
+    // 所有城市一次批量请求，结果同时写入天气缓存
+    QStringList dashboardCities;
+    for (int i = 0; i < m_defaultCityCombo->count(); ++i) {
+        dashboardCities << m_defaultCityCombo->itemText(i);
+    }
+    m_dashboardModel = new WeatherDashboardModel(this);
+    m_dashboardModel->setCities(dashboardCities);
+
+    m_dashboardView = new QTableView(this);
+    m_dashboardView->setObjectName("dashboardView");
+    m_dashboardView->setModel(m_dashboardModel);
+    m_dashboardView->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_dashboardView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_dashboardView->verticalHeader()->hide();
+    m_dashboardView->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_dashboardView->horizontalHeader()->setSectionResizeMode(WeatherDashboardModel::ConditionColumn, QHeaderView::Stretch);
+
+    QPushButton *refreshAllButton = new QPushButton("🔄 Refresh All", this);
+    connect(refreshAllButton, &QPushButton::clicked, this, [this]() {
+        refreshDashboard(true);
+    });
+
+    QWidget *dashboardWidget = new QWidget(this);
+    QVBoxLayout *dashboardLayout = new QVBoxLayout(dashboardWidget);
+    dashboardLayout->setContentsMargins(0, 10, 0, 0);
+    QHBoxLayout *dashboardToolbar = new QHBoxLayout();
+    dashboardToolbar->addStretch();
+    dashboardToolbar->addWidget(refreshAllButton);
+    dashboardLayout->addLayout(dashboardToolbar);
+    dashboardLayout->addWidget(m_dashboardView);
+
     // Add tabs
     m_tabWidget->addTab(notesWidget, "📝 Notes");
+    m_tabWidget->addTab(dashboardWidget, "🌍 Dashboard");
     
     m_contentLayout->addWidget(m_tabWidget);
     m_mainLayout->addWidget(m_contentArea);
+
+    // ========== OUTLINE DOCK ==========
+    // 标题索引随编辑器文档增量更新，并直接作为大纲视图的模型
+    m_headingIndex = new HeadingIndex(this);
+    m_headingIndex->setDocument(m_markdownEditor->document());
+
+    m_outlineView = new QListView(this);
+    m_outlineView->setObjectName("outlineView");
+    m_outlineView->setModel(m_headingIndex);
+    m_outlineView->setUniformItemSizes(true);
+    m_outlineView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+
+    m_outlineDock = new QDockWidget("📑 Outline", this);
+    m_outlineDock->setObjectName("outlineDock");  // saveState/restoreState 需要对象名
+    m_outlineDock->setWidget(m_outlineView);
+    addDockWidget(Qt::RightDockWidgetArea, m_outlineDock);
+
+    QAction *outlineToggleAction = m_outlineDock->toggleViewAction();
+    outlineToggleAction->setShortcut(QKeySequence("Ctrl+Shift+O"));
+    addAction(outlineToggleAction);
     
+    // 只有这些部件使用依赖主题令牌的样式表（theme.qss 中同名的一节）
+    ThemeManager &themeManager = ThemeManager::instance();
+    themeManager.addStyleTarget(m_markdownEditor);
+    themeManager.addStyleTarget(m_markdownEditorWidget->toolbar());
+    themeManager.addStyleTarget(m_markdownEditorWidget->findBar());
+    connect(m_markdownEditorWidget, &MarkdownEditorWidget::emojiPickerCreated,
+            &themeManager, &ThemeManager::addStyleTarget);
+
+    StartupTracer::mark("setupUI");
+
     // Apply saved theme
     applyTheme(currentTheme);
+    StartupTracer::mark("applyTheme");
 
     // Connect signals
-    connect(m_refreshButton, &QPushButton::clicked, this, &MainWindow::loadWeatherForDefaultCity);
+    connect(m_refreshButton, &QPushButton::clicked, this, [this]() {
+        // 手动刷新总是重新获取，已有的缓存值保持显示
+        m_currentCity = m_defaultCityCombo->currentText();
+        fetchWeather(m_currentCity, !showCachedWeather(m_currentCity), true);
+    });
     connect(m_themeButton, &QPushButton::clicked, this, &MainWindow::toggleTheme);
     connect(m_defaultCityCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
             this, &MainWindow::onDefaultCityChanged);
@@ -364,6 +528,21 @@ void MainWindow::setupUI()
     connect(m_markdownEditor, &QPlainTextEdit::textChanged, this, [this]() {
         m_previewUpdateTimer->start();  // Restart timer on each change (debouncing)
     });
+    // 首次切换到仪表盘时加载（缓存值立即显示，过期的城市批量刷新）
+    connect(m_tabWidget, &QTabWidget::currentChanged, this, [this, dashboardWidget](int index) {
+        if (m_tabWidget->widget(index) == dashboardWidget) {
+            refreshDashboard(false);
+        }
+    });
+    // 双击仪表盘中的城市将其设为默认城市
+    connect(m_dashboardView, &QTableView::doubleClicked, this, [this](const QModelIndex &index) {
+        m_defaultCityCombo->setCurrentIndex(index.row());
+    });
+    // Outline navigation and current-section tracking
+    connect(m_outlineView, &QListView::clicked, this, &MainWindow::onOutlineActivated);
+    connect(m_outlineView, &QListView::activated, this, &MainWindow::onOutlineActivated);
+    connect(m_markdownEditor, &QPlainTextEdit::cursorPositionChanged,
+            this, &MainWindow::syncOutlineWithCursor);
 
     // Setup keyboard shortcuts for file operations
     QShortcut *newShortcut = new QShortcut(QKeySequence("Ctrl+N"), this);
@@ -387,6 +566,9 @@ void MainWindow::setupUI()
     QShortcut *saveAsShortcut = new QShortcut(QKeySequence("Ctrl+Shift+S"), this);
     connect(saveAsShortcut, &QShortcut::activated, this, &MainWindow::saveFileAs);
 
+    QShortcut *exportPdfShortcut = new QShortcut(QKeySequence("Ctrl+P"), this);
+    connect(exportPdfShortcut, &QShortcut::activated, this, &MainWindow::exportPdf);
+
     // Setup keyboard shortcuts for zoom operations
     QShortcut *zoomInShortcut1 = new QShortcut(QKeySequence("Ctrl+="), this);
     connect(zoomInShortcut1, &QShortcut::activated, this, &MainWindow::zoomIn);
@@ -400,6 +582,12 @@ void MainWindow::setupUI()
     QShortcut *zoomResetShortcut = new QShortcut(QKeySequence("Ctrl+0"), this);
     connect(zoomResetShortcut, &QShortcut::activated, this, &MainWindow::zoomReset);
 
+    // 键入延迟面板
+    QShortcut *latencyHudShortcut = new QShortcut(QKeySequence("Ctrl+Shift+L"), this);
+    connect(latencyHudShortcut, &QShortcut::activated, this, [this]() {
+        setLatencyHudVisible(!(m_latencyHud && m_latencyHud->isVisible()));
+    });
+
     // Track text changes for modified flag
     connect(m_markdownEditor, &QPlainTextEdit::textChanged, this, [this]() {
         if (!m_isModified) {
@@ -415,41 +603,64 @@ void MainWindow::setupUI()
 void MainWindow::applyTheme(const QString &themeName)
 {
     // Whitelist validation: only allow known themes
-    static const QStringList allowedThemes = {"dark", "light"};
     QString validatedTheme = themeName;
-
-    if (!allowedThemes.contains(themeName)) {
+    if (!ThemeManager::themeNames().contains(themeName)) {
         qWarning() << "Invalid theme name:" << themeName << "- falling back to 'dark'";
         validatedTheme = "dark";
     }
 
-    QString qssPath = QString(":/resources/styles/%1.qss").arg(validatedTheme);
-    QFile file(qssPath);
-    if (file.open(QFile::ReadOnly)) {
-        QString styleSheet = QLatin1String(file.readAll());
-        this->setStyleSheet(styleSheet);
-        file.close();
-        
-        m_settings->setValue("theme", validatedTheme);
-        if (m_themeButton) {
-            m_themeButton->setText(validatedTheme == "dark" ? "☀️ Light Mode" : "🌙 Dark Mode");
-        }
-        
-        // Refresh weather display to update HTML colors if needed
-        // (Though the HTML currently has some hardcoded colors, 
-        // we might want to refactor that later)
-        if (!m_currentCity.isEmpty()) {
-            // Update the preview if it exists
-            onMarkdownTextChanged();
-        }
-    } else {
-        qWarning() << "Could not load theme:" << qssPath;
+    const QString previousTheme = m_settings->get<Key::Theme>();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // 调色板与注册部件的预展开样式表；颜色全部来自主题令牌
+    const double applyMs = ThemeManager::instance().apply(validatedTheme);
+
+    // 主题未变时（例如启动）不会产生写入
+    m_settings->set<Key::Theme>(validatedTheme);
+    if (m_themeButton) {
+        m_themeButton->setText(validatedTheme == "dark" ? "☀️ Light Mode" : "🌙 Dark Mode");
+    }
+
+    if (previousTheme == validatedTheme) {
+        return;
+    }
+
+    const qint64 recolorStartNs = timer.nsecsElapsed();
+    const int changed = swapPreviewTheme(previousTheme == "dark", validatedTheme == "dark");
+    const double recolorMs = (timer.nsecsElapsed() - recolorStartNs) / 1e6;
+
+    // 重绘在事件循环中进行：下一轮事件循环时记录总耗时，近似包含重绘
+    QTimer::singleShot(0, this, [validatedTheme, applyMs, recolorMs, changed, timer]() {
+        const qint64 totalNs = timer.nsecsElapsed();
+        LatencyMonitor::instance().record(LatencyMonitor::ThemeSwitch, totalNs / 1000);
+        qDebug().nospace() << "Theme switched to " << validatedTheme << " in " << totalNs / 1e6
+                           << " ms (palette and style sheets " << applyMs << " ms, preview recolor "
+                           << recolorMs << " ms for " << changed << " formats, the rest is repaint)";
+    });
+}
+
+int MainWindow::swapPreviewTheme(bool wasDark, bool isDark)
+{
+    // 配色全部在 <style> 前导中：替换前导即可，不重新渲染 Markdown
+    const QString &oldPrelude = MarkdownRenderer::stylePrelude(wasDark);
+    if (m_previewHtml.isEmpty() || !m_previewHtml.startsWith(oldPrelude)) {
+        return 0;
     }
+    m_previewHtml = MarkdownRenderer::stylePrelude(isDark) + m_previewHtml.mid(oldPrelude.size());
+
+    // 已显示的文档就地换色，不重新解析 HTML；颜色存放在文本格式中，
+    // 修改后文档仍要重新布局一次（见 PreviewTheme）
+    const int scroll = m_markdownPreview->verticalScrollBar()->value();
+    const int changed = PreviewTheme::recolor(m_markdownPreview->document(), wasDark, isDark);
+    m_markdownPreview->verticalScrollBar()->setValue(scroll);
+    return changed;
 }
 
 void MainWindow::toggleTheme()
 {
-    QString currentTheme = m_settings->value("theme", "dark").toString();
+    const QString currentTheme = m_settings->get<Key::Theme>();
     applyTheme(currentTheme == "dark" ? "light" : "dark");
 }
 
@@ -475,7 +686,33 @@ QString MainWindow::getPythonScriptPath() const
     return scriptPath;
 }
 
+bool MainWindow::prepareWeatherBackend()
+{
+    // 原生后端不需要准备；Python 后端每次请求前确认脚本与解释器路径
+    WeatherWorker *worker = qobject_cast<WeatherWorker *>(m_weatherBackend);
+    if (!worker) {
+        return true;
+    }
+
+    QString scriptPath = getPythonScriptPath();
+    if (scriptPath.isEmpty()) {
+        return false;
+    }
+    // Find Python executable dynamically (embedded runtime or system Python)
+    worker->setProgram(findPythonExecutable(), scriptPath);
+    return true;
+}
+
 QString MainWindow::findPythonExecutable() const
+{
+    // 发现结果在首次天气请求时计算并缓存，启动时不扫描 PATH
+    if (m_pythonExecutable.isEmpty()) {
+        m_pythonExecutable = discoverPythonExecutable();
+    }
+    return m_pythonExecutable;
+}
+
+QString MainWindow::discoverPythonExecutable() const
 {
     QString appDir = QCoreApplication::applicationDirPath();
     
@@ -518,232 +755,190 @@ QString MainWindow::findPythonExecutable() const
 #endif
 }
 
-QString MainWindow::formatWeatherHTML(const QString &output, const QString &city) const
+void MainWindow::onWeatherReady(const QString &city, const QJsonObject &obj)
 {
-    qDebug() << "Parsing JSON weather data for:" << city;
-    
-    QString theme = m_settings->value("theme", "dark").toString();
-    bool isDark = (theme == "dark");
-    
-    QString accentColor = isDark ? "#00d4ff" : "#0071e3";
-    QString secondaryTextColor = isDark ? "#aaaaaa" : "#86868b";
-    QString textColor = isDark ? "#cccccc" : "#1d1d1f";
-    QString conditionColor = isDark ? "#5dade2" : "#0071e3";
-    
-    // Parse JSON output from Python
-    QJsonDocument doc = QJsonDocument::fromJson(output.toUtf8());
-    if (doc.isNull() || !doc.isObject()) {
-        qWarning() << "Failed to parse JSON output";
-        return QString(
-            "<div style='font-family: \"SF Pro Display\", \"Segoe UI\", \"Microsoft YaHei\", sans-serif;'>"
-            "<div style='font-size: 24px; font-weight: bold; color: #ff4757; margin-bottom: 20px;'>"
-            "❌ Parse Error"
-            "</div>"
-            "<pre style='font-size: 14px; color: %1; white-space: pre-wrap;'>%2</pre>"
-            "</div>"
-        ).arg(secondaryTextColor).arg(output.toHtmlEscaped());
-    }
-    
-    QJsonObject obj = doc.object();
-    
-    // Check for error status
     QString status = obj["status"].toString();
-    if (status == "error") {
+    
+    if (status == "success") {
+        QJsonObject data = obj;
+        data.remove("id");
+        recordWeather(city, data);
+        displayWeather(data);
+
+        if (m_refreshButton) {
+            m_refreshButton->setEnabled(true);
+            m_refreshButton->setText("🔄 Refresh Weather");
+        }
+    } else {
+        // Error status from Python
         QString errorMsg = obj["error_message"].toString();
-        return QString(
-            "<div style='font-family: \"SF Pro Display\", \"Segoe UI\", \"Microsoft YaHei\", sans-serif;'>"
-            "<div style='font-size: 28px; font-weight: bold; color: #ff4757; margin-bottom: 15px;'>"
-            "❌ Error"
-            "</div>"
-            "<div style='font-size: 16px; color: %1;'>"
-            "%2"
-            "</div>"
-            "</div>"
-        ).arg(secondaryTextColor).arg(errorMsg.toHtmlEscaped());
+
+        // Check for missing dependencies
+        if (errorMsg.contains("No module named")) {
+            handleWeatherError("Missing Python dependencies. Please install required packages:\n"
+                             "pip install -r python/requirements.txt");
+        } else {
+            handleWeatherError(errorMsg);
+        }
     }
-    
-    // Extract weather data from JSON
-    QString cityName = obj["city"].toString();
-    double temperature = obj["temperature"].toDouble();
-    double feelsLike = obj["feels_like"].toDouble();
-    int humidity = obj["humidity"].toInt();
-    QString description = obj["description"].toString();
-    double windSpeed = obj["wind_speed"].toDouble();
-    double pressure = obj["pressure"].toDouble();
-    
-    // Build HTML with styled formatting
-    QString html = QString(
-        "<div style='font-family: \"SF Pro Display\", \"Segoe UI\", \"Microsoft YaHei\", sans-serif;'>"
-        
-        // City name
-        "<div style='font-size: 36px; font-weight: bold; color: %1; margin-bottom: 25px;'>"
-        "📍 %2"
-        "</div>"
-        
-        // Temperature
-        "<div style='font-size: 64px; font-weight: bold; color: %1; margin-bottom: 15px;'>"
-        "%3°C"
-        "</div>"
-        
-        // Conditions
-        "<div style='font-size: 28px; font-weight: 600; color: %4; margin-bottom: 25px;'>"
-        "%5"
-        "</div>"
-        
-        // Feels like
-        "<div style='font-size: 20px; color: %6; margin-bottom: 20px;'>"
-        "🌡️ Feels Like: <span style='font-weight: bold; color: #ffa502;'>%7°C</span>"
-        "</div>"
-        
-        // Details section
-        "<div style='font-size: 18px; color: %8; line-height: 2.2;'>"
-        "<div>💧 Humidity: <span style='font-weight: 600; color: #48dbfb;'>%9%</span></div>"
-        "<div>💨 Wind Speed: <span style='font-weight: 600; color: #1dd1a1;'>%10 km/h</span></div>"
-        "<div>🔽 Pressure: <span style='font-weight: 600; color: #ee5a6f;'>%11 mb</span></div>"
-        "</div>"
-        
-        "</div>"
-    ).arg(accentColor)
-     .arg(cityName)
-     .arg(temperature, 0, 'f', 1)
-     .arg(conditionColor)
-     .arg(description)
-     .arg(secondaryTextColor)
-     .arg(feelsLike, 0, 'f', 1)
-     .arg(textColor)
-     .arg(humidity)
-     .arg(windSpeed, 0, 'f', 1)
-     .arg(pressure, 0, 'f', 1);
-    
-    return html;
 }
 
-QString MainWindow::getSkeletonHTML(const QString &city) const
+void MainWindow::refreshDashboard(bool force)
 {
-    QString theme = m_settings->value("theme", "dark").toString();
-    bool isDark = (theme == "dark");
-    
-    QString accentColor = isDark ? "#00d4ff" : "#0071e3";
-    QString secondaryTextColor = isDark ? "#888888" : "#86868b";
-    QString placeholderColor = isDark ? "#666666" : "#aaaaaa";
+    if (m_dashboardRequestId != 0) {
+        return;  // 上一次批量请求尚未返回
+    }
 
-    // Skeleton screen with loading animation
-    QString html = QString(
-        "<div style='font-family: \"SF Pro Display\", \"Segoe UI\", \"Microsoft YaHei\", sans-serif;'>"
-        
-        // City name
-        "<div style='font-size: 36px; font-weight: bold; color: %1; margin-bottom: 25px;'>"
-        "📍 %2"
-        "</div>"
-        
-        // Temperature placeholder
-        "<div style='font-size: 56px; font-weight: bold; color: %3; margin-bottom: 15px;'>"
-        "⏳ Loading..."
-        "</div>"
-        
-        // Conditions placeholder
-        "<div style='font-size: 26px; font-weight: 600; color: %4; margin-bottom: 25px;'>"
-        "Fetching weather data..."
-        "</div>"
-        
-        // Details placeholders
-        "<div style='font-size: 18px; color: %3; line-height: 2.2;'>"
-        "<div>🌡️ Feels Like: <span style='color: %4;'>--°C</span></div>"
-        "<div>💧 Humidity: <span style='color: %4;'>--%</span></div>"
-        "<div>💨 Wind Speed: <span style='color: %4;'>-- km/h</span></div>"
-        "<div>🔽 Pressure: <span style='color: %4;'>-- mb</span></div>"
-        "</div>"
-        
-        "</div>"
-    ).arg(accentColor).arg(city).arg(placeholderColor).arg(secondaryTextColor);
-    
-    return html;
+    // 先用缓存填充，只请求没有缓存或已过期的城市
+    QStringList staleCities;
+    for (const QString &city : m_dashboardModel->cities()) {
+        WeatherCache::Entry cached;
+        if (m_weatherCache->lookup(city, &cached)) {
+            m_dashboardModel->updateCity(city, cached.data, cached.fetchedAt);
+            if (!force && m_weatherCache->isFresh(cached)) {
+                continue;
+            }
+        }
+        staleCities << city;
+    }
+    if (staleCities.isEmpty()) {
+        return;
+    }
+
+    if (!m_weatherSupervisor->allowRequest() || !prepareWeatherBackend()) {
+        return;
+    }
+    m_dashboardRequestId = m_weatherBackend->requestWeatherBatch(staleCities);
 }
 
+void MainWindow::onDashboardReady(const QJsonObject &response)
+{
+    m_dashboardRequestId = 0;
+
+    const QJsonArray results = response["results"].toArray();
+    for (const QJsonValue &value : results) {
+        QJsonObject data = value.toObject();
+        const QString city = data.take("query").toString();
+
+        if (data["status"].toString() != "success") {
+            // 失败时保留已有的缓存值
+            WeatherCache::Entry cached;
+            if (!m_weatherCache->lookup(city, &cached)) {
+                m_dashboardModel->updateCity(city, data, QDateTime());
+            }
+            continue;
+        }
 
+        recordWeather(city, data);
+        m_dashboardModel->updateCity(city, data, QDateTime::currentDateTimeUtc());
+        if (city == m_currentCity) {
+            displayWeather(data);
+        }
+    }
+    m_refreshScheduler->refreshFinished();
+}
 
-void MainWindow::onProcessFinished(int exitCode, QProcess::ExitStatus exitStatus)
+void MainWindow::onDashboardFailed(const QString &error)
 {
-    qDebug() << "Process finished with exit code:" << exitCode;
+    m_dashboardRequestId = 0;
+    qWarning() << "Dashboard refresh failed:" << error;
+
+    // 已有数据的行保持不变，只把还没有数据的行标记为失败
+    QJsonObject failure;
+    failure["status"] = "error";
+    failure["error_message"] = error;
+    for (const QString &city : m_dashboardModel->cities()) {
+        WeatherCache::Entry cached;
+        if (!m_weatherCache->lookup(city, &cached)) {
+            m_dashboardModel->updateCity(city, failure, QDateTime());
+        }
+    }
+    m_refreshScheduler->refreshFinished();
+}
 
-    // Stop timeout timer
-    m_processTimeout->stop();
+void MainWindow::recordWeather(const QString &city, const QJsonObject &data)
+{
+    m_weatherCache->store(city, data);
+    m_refreshScheduler->recordReading(city, data);
 
-    // Read any remaining output
-    m_processOutput += QString::fromUtf8(m_process->readAllStandardOutput());
-    QString errors = QString::fromUtf8(m_process->readAllStandardError());
+    // 同一分钟内的重复读数不会写入历史
+    if (m_weatherHistory.append(city, QDateTime::currentDateTimeUtc(), data["temperature"].toDouble())
+        && city == m_currentCity) {
+        updateSparkline(city);
+    }
+}
 
-    // Parse JSON from buffered output
-    QJsonDocument doc = QJsonDocument::fromJson(m_processOutput.toUtf8());
+void MainWindow::updateSparkline(const QString &city)
+{
+    // 每 30 分钟一个桶，桶内取最低/最高温度
+    const QDateTime now = QDateTime::currentDateTimeUtc();
+    m_weatherSparkline->setBuckets(m_weatherHistory.downsample(city, now.addSecs(-24 * 3600), now, 48));
+}
 
-    if (exitStatus == QProcess::NormalExit && exitCode == 0 && !m_processOutput.isEmpty() && !doc.isNull()) {
-        QJsonObject obj = doc.object();
-        QString status = obj["status"].toString();
-        
-        if (status == "success") {
-            // Extract weather data
-            QString cityName = obj["city"].toString();
-            double temperature = obj["temperature"].toDouble();
-            double feelsLike = obj["feels_like"].toDouble();
-            int humidity = obj["humidity"].toInt();
-            QString description = obj["description"].toString();
-            double windSpeed = obj["wind_speed"].toDouble();
-            double pressure = obj["pressure"].toDouble();
-            
-            // Update sidebar if this is the default city
-            QString defaultCity = m_defaultCityCombo->currentText();
-            if (cityName == defaultCity || m_currentCity == defaultCity) {
-                m_weatherCityLabel->setText("📍 " + cityName);
-                m_weatherTempLabel->setText(QString::number(temperature, 'f', 1) + "°C");
-                m_weatherConditionLabel->setText(description);
-                
-                QString theme = m_settings->value("theme", "dark").toString();
-                bool isDark = (theme == "dark");
-                QString secondaryTextColor = isDark ? "#aaaaaa" : "#86868b";
-
-                QString details = QString(
-                    "<div style='line-height: 1.8;'>"
-                    "<div>🌡️ Feels Like: <span style='color: #ffa502;'>%1°C</span></div>"
-                    "<div>💧 Humidity: <span style='color: #48dbfb;'>%2%</span></div>"
-                    "<div>💨 Wind: <span style='color: #1dd1a1;'>%3 km/h</span></div>"
-                    "<div>🔽 Pressure: <span style='color: #ee5a6f;'>%4 mb</span></div>"
-                    "</div>"
-                ).arg(feelsLike, 0, 'f', 1)
-                 .arg(humidity)
-                 .arg(windSpeed, 0, 'f', 1)
-                 .arg(pressure, 0, 'f', 1);
-                
-                m_weatherDetailsLabel->setText(details);
-            }
-            
+bool MainWindow::showCachedWeather(const QString &city)
+{
+    WeatherCache::Entry entry;
+    if (!m_weatherCache->lookup(city, &entry)) {
+        return false;
+    }
+    displayWeather(entry.data);
+    return true;
+}
 
-            
-            if (m_refreshButton) {
-                m_refreshButton->setEnabled(true);
-                m_refreshButton->setText("🔄 Refresh Weather");
-            }
-        } else {
-            // Error status from Python
-            QString errorMsg = obj["error_message"].toString();
-            handleWeatherError(errorMsg);
-        }
-    } else if (!errors.isEmpty()) {
-        qWarning() << "Python stderr:" << errors;
+void MainWindow::displayWeather(const QJsonObject &obj)
+{
+    // 与当前显示的值相同时不触碰标签，避免无谓的重新布局与闪烁
+    if (obj == m_displayedWeather) {
+        return;
+    }
 
-        // Check for missing dependencies
-        if (errors.contains("ModuleNotFoundError") || errors.contains("No module named")) {
-            handleWeatherError("Missing Python dependencies. Please install required packages:\n"
-                             "pip install -r python/requirements.txt");
-        } else {
-            handleWeatherError(errors);
-        }
-    } else {
-        handleWeatherError("Unable to retrieve weather data. Please try again.");
+    // Extract weather data
+    QString cityName = obj["city"].toString();
+    double temperature = obj["temperature"].toDouble();
+    double feelsLike = obj["feels_like"].toDouble();
+    int humidity = obj["humidity"].toInt();
+    QString description = obj["description"].toString();
+    double windSpeed = obj["wind_speed"].toDouble();
+    double pressure = obj["pressure"].toDouble();
+    
+    // Update sidebar if this is the default city
+    QString defaultCity = m_defaultCityCombo->currentText();
+    if (cityName == defaultCity || m_currentCity == defaultCity) {
+        m_weatherCityLabel->setText("📍 " + cityName);
+        m_weatherTempLabel->setText(QString::number(temperature, 'f', 1) + "°C");
+        m_weatherConditionLabel->setText(description);
+
+        QString details = QString(
+            "<div style='line-height: 1.8;'>"
+            "<div>🌡️ Feels Like: <span style='color: #ffa502;'>%1°C</span></div>"
+            "<div>💧 Humidity: <span style='color: #48dbfb;'>%2%</span></div>"
+            "<div>💨 Wind: <span style='color: #1dd1a1;'>%3 km/h</span></div>"
+            "<div>🔽 Pressure: <span style='color: #ee5a6f;'>%4 mb</span></div>"
+            "</div>"
+        ).arg(feelsLike, 0, 'f', 1)
+         .arg(humidity)
+         .arg(windSpeed, 0, 'f', 1)
+         .arg(pressure, 0, 'f', 1);
+        
+        m_weatherDetailsLabel->setText(details);
+        m_displayedWeather = obj;
+        m_displayedCity = m_currentCity;
     }
 }
 
 void MainWindow::handleWeatherError(const QString &errorMsg)
 {
+    // 正在显示当前城市的缓存值时，后台刷新失败不覆盖它；
+    // 显示的是其他城市（切换城市后请求未能发出）时必须显示错误
+    if (!m_displayedWeather.isEmpty() && m_displayedCity == m_currentCity) {
+        qWarning() << "Weather refresh failed, keeping cached value:" << errorMsg;
+        if (m_refreshButton) {
+            m_refreshButton->setEnabled(true);
+            m_refreshButton->setText("🔄 Refresh Weather");
+        }
+        return;
+    }
+
     // Update sidebar
     m_weatherCityLabel->setText("❌ Error");
     m_weatherTempLabel->setText("--°C");
@@ -758,210 +953,96 @@ void MainWindow::handleWeatherError(const QString &errorMsg)
     }
 }
 
-void MainWindow::onProcessError(QProcess::ProcessError error)
+void MainWindow::onWeatherFailed(const QString &city, const QString &error)
 {
-    qWarning() << "Process error:" << error;
-
-    // Stop timeout timer
-    m_processTimeout->stop();
+    qWarning() << "Weather request for" << city << "failed:" << error;
+    handleWeatherError(error);
+}
 
-    QString errorMsg;
-    switch (error) {
-        case QProcess::FailedToStart:
-            errorMsg = "Failed to start Python. Please check your Python installation.";
-            break;
-        case QProcess::Timedout:
-            errorMsg = "Request timed out. Please check your internet connection.";
-            break;
-        default:
-            errorMsg = "An error occurred while fetching weather data.";
-            break;
+void MainWindow::onMarkdownTextChanged()
+{
+    // Trigger debounced preview update
+    if (m_previewUpdateTimer) {
+        m_previewUpdateTimer->start();
     }
-
-    handleWeatherError(errorMsg);
 }
 
-void MainWindow::onProcessReadyRead()
+void MainWindow::refreshPreview()
 {
-    // Stream output as it becomes available to prevent buffer blocking
-    m_processOutput += QString::fromUtf8(m_process->readAllStandardOutput());
+    QElapsedTimer timer;
+    timer.start();
+
+    QString markdownText = m_markdownEditor->toPlainText();
+    m_previewHtml = enhanceMarkdownPreview(markdownText);
+    m_markdownPreview->setHtml(m_previewHtml);
+
+    LatencyMonitor::instance().record(LatencyMonitor::PreviewRender, timer.nsecsElapsed() / 1000);
 }
 
-void MainWindow::onProcessTimeout()
+void MainWindow::setLatencyHudVisible(bool visible)
 {
-    qWarning() << "Process timeout - terminating Python process";
-
-    // Terminate the process
-    if (m_process->state() != QProcess::NotRunning) {
-        m_process->terminate();
-        QTimer::singleShot(2000, this, [this]() {
-            if (m_process->state() != QProcess::NotRunning) {
-                m_process->kill();
-            }
-        });
+    if (!m_latencyHud) {
+        if (!visible) {
+            return;
+        }
+        m_latencyHud = new LatencyHud(m_markdownEditor);
+        ThemeManager::instance().addStyleTarget(m_latencyHud);
     }
+    // 面板显示时才启用监视器
+    m_latencyHud->setVisible(visible);
+    m_settings->set<Key::LatencyHud>(visible);
+}
 
-    handleWeatherError("Request timed out after 30 seconds. Please check your internet connection.");
+void MainWindow::onOutlineActivated(const QModelIndex &index)
+{
+    if (index.isValid()) {
+        jumpToHeading(index.row());
+    }
 }
 
-void MainWindow::onMarkdownTextChanged()
+void MainWindow::jumpToHeading(int row)
 {
-    // Trigger debounced preview update
-    if (m_previewUpdateTimer) {
-        m_previewUpdateTimer->start();
+    const std::vector<HeadingIndex::Heading> &headings = m_headingIndex->headings();
+    if (row < 0 || row >= int(headings.size())) {
+        return;
+    }
+
+    // 编辑器：findBlockByNumber 在文档的文本块树上二分查找
+    const QTextBlock block = m_markdownEditor->document()->findBlockByNumber(headings[row].blockNumber);
+    if (block.isValid()) {
+        m_markdownEditor->setTextCursor(QTextCursor(block));
+        m_markdownEditor->centerCursor();
+        m_markdownEditor->setFocus();
     }
+
+    // 预览：标题带有按源文本行号命名的锚点（编辑器的文本块号即行号），
+    // 与标题序号无关。防抖刷新尚未执行时先刷新，保证预览与编辑器一致
+    if (m_previewUpdateTimer->isActive()) {
+        m_previewUpdateTimer->stop();
+        refreshPreview();
+    }
+    m_markdownPreview->scrollToAnchor(MarkdownRenderer::headingAnchor(headings[row].blockNumber));
 }
 
-QString MainWindow::enhanceMarkdownPreview(const QString &markdown)
+void MainWindow::syncOutlineWithCursor()
 {
-    QString theme = m_settings->value("theme", "dark").toString();
-    bool isDark = (theme == "dark");
-    
-    QString bgColor = isDark ? "#1a1a1a" : "#ffffff";
-    QString textColor = isDark ? "#ffffff" : "#1d1d1f";
-    QString accentColor = isDark ? "#00d4ff" : "#0071e3";
-    QString secondaryTextColor = isDark ? "#aaaaaa" : "#86868b";
-    QString borderColor = isDark ? "#2d2d2d" : "#d2d2d7";
-    QString codeBgColor = isDark ? "#0a0a0a" : "#f5f5f7";
-    QString inlineCodeBg = isDark ? "#2d2d2d" : "#e8e8ed";
-    QString tableEvenRow = isDark ? "#0f0f0f" : "#f9f9fb";
-
-    QString html = QString("<style>"
-        "body { font-family: 'SF Pro Display', 'Segoe UI', 'Microsoft YaHei', sans-serif; color: %2; background-color: %1; padding: 20px; line-height: 1.6; }"
-        "h1, h2, h3, h4, h5, h6 { color: %3; margin-top: 24px; margin-bottom: 16px; font-weight: 600; }"
-        "h1 { font-size: 2em; border-bottom: 2px solid %5; padding-bottom: 8px; }"
-        "h2 { font-size: 1.5em; border-bottom: 1px solid %5; padding-bottom: 6px; }"
-        "h3 { font-size: 1.25em; }"
-        "p { margin-bottom: 16px; }"
-        "code { background-color: %7; color: %3; padding: 2px 6px; border-radius: 4px; font-family: 'Consolas', 'Monaco', monospace; font-size: 0.9em; }"
-        "pre { background-color: %6; border: 1px solid %5; border-radius: 8px; padding: 16px; overflow-x: auto; margin: 16px 0; tab-size: 2; -moz-tab-size: 2; }"
-        "pre code { background-color: transparent; padding: 0; color: %2; display: block; }"
-        ".code-block-header { background-color: %5; color: %3; padding: 6px 12px; border-radius: 8px 8px 0 0; font-size: 0.85em; font-weight: 600; font-family: 'Consolas', 'Monaco', monospace; margin-bottom: -1px; }"
-        ".code-block-container { margin: 16px 0; }"
-        "blockquote { border-left: 4px solid %3; padding-left: 16px; margin-left: 0; color: %4; font-style: italic; }"
-        "a { color: %3; text-decoration: none; }"
-        "a:hover { text-decoration: underline; }"
-        "ul, ol { padding-left: 24px; margin-bottom: 16px; }"
-        "li { margin-bottom: 8px; }"
-        "table { border-collapse: collapse; width: 100%; margin: 16px 0; }"
-        "th, td { border: 1px solid %5; padding: 8px 12px; text-align: left; }"
-        "th { background-color: %5; color: %3; font-weight: 600; }"
-        "tr:nth-child(even) { background-color: %8; }"
-        "hr { border: none; border-top: 2px solid %5; margin: 24px 0; }"
-        "img { max-width: 100%; height: auto; border-radius: 8px; margin: 16px 0; }"
-        "strong { color: %3; font-weight: 600; }"
-        "em { color: %3; font-style: italic; opacity: 0.9; }"
-        "del { color: %4; text-decoration: line-through; }"
-        "</style><body>")
-        .arg(bgColor, textColor, accentColor, secondaryTextColor, borderColor)
-        .arg(codeBgColor, inlineCodeBg, tableEvenRow);
-    
-    // Process markdown line by line
-    QStringList lines = markdown.split('\n');
-    bool inCodeBlock = false;
-    QString codeLanguage;
-    QString codeContent;
-    
-    for (int i = 0; i < lines.size(); ++i) {
-        QString line = lines[i];
-        
-        // Check for code block start/end
-        if (line.startsWith("```")) {
-            if (!inCodeBlock) {
-                // Start of code block
-                inCodeBlock = true;
-                codeLanguage = line.mid(3).trimmed();
-                if (codeLanguage.isEmpty()) {
-                    codeLanguage = "plaintext";
-                }
-                codeContent.clear();
-                
-                // Add language header
-                html += QString("<div class='code-block-container'>"
-                               "<div class='code-block-header'>%1</div>"
-                               "<pre><code>").arg(codeLanguage.toHtmlEscaped());
-            } else {
-                // End of code block
-                html += codeContent.toHtmlEscaped();
-                html += "</code></pre></div>";
-                inCodeBlock = false;
-                codeLanguage.clear();
-                codeContent.clear();
-            }
-        } else if (inCodeBlock) {
-            // Inside code block
-            codeContent += line + "\n";
-        } else {
-            // Regular markdown line - use simple conversion
-            QString processedLine = line;
-            
-            // Headers
-            if (processedLine.startsWith("# ")) {
-                html += "<h1>" + processedLine.mid(2).toHtmlEscaped() + "</h1>";
-            } else if (processedLine.startsWith("## ")) {
-                html += "<h2>" + processedLine.mid(3).toHtmlEscaped() + "</h2>";
-            } else if (processedLine.startsWith("### ")) {
-                html += "<h3>" + processedLine.mid(4).toHtmlEscaped() + "</h3>";
-            }
-            // Horizontal rule
-            else if (processedLine.trimmed() == "---" || processedLine.trimmed() == "***") {
-                html += "<hr>";
-            }
-            // Unordered list
-            else if (processedLine.trimmed().startsWith("- ") || processedLine.trimmed().startsWith("* ")) {
-                QString content = processedLine.trimmed().mid(2);
-                html += "<ul><li>" + processInlineMarkdown(content) + "</li></ul>";
-            }
-            // Ordered list
-            else if (processedLine.trimmed().contains(QRegularExpression("^\\d+\\. "))) {
-                QString content = processedLine.trimmed();
-                content = content.mid(content.indexOf(". ") + 2);
-                html += "<ol><li>" + processInlineMarkdown(content) + "</li></ol>";
-            }
-            // Blockquote
-            else if (processedLine.startsWith("> ")) {
-                html += "<blockquote>" + processInlineMarkdown(processedLine.mid(2)) + "</blockquote>";
-            }
-            // Empty line
-            else if (processedLine.trimmed().isEmpty()) {
-                html += "<br>";
-            }
-            // Regular paragraph
-            else {
-                html += "<p>" + processInlineMarkdown(processedLine) + "</p>";
-            }
-        }
+    if (!m_outlineDock || !m_outlineDock->isVisible()) {
+        return;
+    }
+
+    // 二分查找光标所在章节并高亮对应的大纲条目
+    const int row = m_headingIndex->headingIndexForBlock(m_markdownEditor->textCursor().blockNumber());
+    if (row >= 0) {
+        m_outlineView->setCurrentIndex(m_headingIndex->index(row));
+    } else {
+        m_outlineView->clearSelection();
     }
-    
-    html += "</body>";
-    return html;
 }
 
-QString MainWindow::processInlineMarkdown(const QString &text)
+QString MainWindow::enhanceMarkdownPreview(const QString &markdown)
 {
-    QString result = text.toHtmlEscaped();
-    
-    // Bold: **text** or __text__
-    result.replace(QRegularExpression("\\*\\*(.+?)\\*\\*"), "<strong>\\1</strong>");
-    result.replace(QRegularExpression("__(.+?)__"), "<strong>\\1</strong>");
-    
-    // Italic: *text* or _text_
-    result.replace(QRegularExpression("\\*(.+?)\\*"), "<em>\\1</em>");
-    result.replace(QRegularExpression("_(.+?)_"), "<em>\\1</em>");
-    
-    // Strikethrough: ~~text~~
-    result.replace(QRegularExpression("~~(.+?)~~"), "<del>\\1</del>");
-    
-    // Inline code: `code`
-    result.replace(QRegularExpression("`(.+?)`"), "<code>\\1</code>");
-    
-    // Links: [text](url)
-    result.replace(QRegularExpression("\\[(.+?)\\]\\((.+?)\\)"), "<a href='\\2'>\\1</a>");
-    
-    // Images: ![alt](url)
-    result.replace(QRegularExpression("!\\[(.+?)\\]\\((.+?)\\)"), "<img src='\\2' alt='\\1'>");
-    
-    return result;
+    const QString theme = m_settings->get<Key::Theme>();
+    return MarkdownRenderer::renderDocument(markdown, theme == "dark");
 }
 
 void MainWindow::onDefaultCityChanged(int index)
@@ -972,7 +1053,7 @@ void MainWindow::onDefaultCityChanged(int index)
     qDebug() << "Default city changed to:" << city;
     
     // Save to settings
-    m_settings->setValue("defaultCity", city);
+    m_settings->set<Key::DefaultCity>(city);
     
     // Load weather for new default city
     loadWeatherForDefaultCity();
@@ -984,18 +1065,51 @@ void MainWindow::loadWeatherForDefaultCity()
     qDebug() << "Loading weather for default city:" << city;
     
     m_currentCity = city;
-    
-    QString scriptPath = getPythonScriptPath();
-    if (scriptPath.isEmpty()) {
+    updateSparkline(city);
+
+    // stale-while-revalidate：有缓存就立即显示，仅在过期时后台刷新
+    WeatherCache::Entry cached;
+    if (m_weatherCache->lookup(city, &cached)) {
+        displayWeather(cached.data);
+        if (m_weatherCache->isFresh(cached)) {
+            // 之前选择的城市还在请求中：它的结果不再需要
+            m_weatherRequests->cancel();
+            if (m_refreshButton) {
+                m_refreshButton->setEnabled(true);
+                m_refreshButton->setText("🔄 Refresh Weather");
+            }
+            return;
+        }
+        fetchWeather(city, false);
+    } else {
+        fetchWeather(city, true);
+    }
+}
+
+void MainWindow::fetchWeather(const QString &city, bool showLoading, bool immediate)
+{
+    // 熔断期间不再请求，恢复后由 circuitClosed 重新加载
+    if (!m_weatherSupervisor->allowRequest()) {
+        m_weatherRequests->cancel();
+        handleWeatherError(QString("Weather service unavailable. Retrying in %1 s.")
+                           .arg((m_weatherSupervisor->retryAfterMs() + 999) / 1000));
+        return;
+    }
+
+    if (!prepareWeatherBackend()) {
         handleWeatherError("Python script not found");
         return;
     }
     
     // Show loading state in sidebar
-    m_weatherCityLabel->setText("📍 " + city);
-    m_weatherTempLabel->setText("⏳");
-    m_weatherConditionLabel->setText("Loading...");
-    m_weatherDetailsLabel->setText("<span style='color: #888888;'>Fetching weather data...</span>");
+    if (showLoading) {
+        m_displayedWeather = QJsonObject();
+        m_displayedCity.clear();
+        m_weatherCityLabel->setText("📍 " + city);
+        m_weatherTempLabel->setText("⏳");
+        m_weatherConditionLabel->setText("Loading...");
+        m_weatherDetailsLabel->setText("<span style='color: #888888;'>Fetching weather data...</span>");
+    }
     
     // Disable refresh button
     if (m_refreshButton) {
@@ -1003,97 +1117,22 @@ void MainWindow::loadWeatherForDefaultCity()
         m_refreshButton->setText("🔄 Loading...");
     }
     
-    // Kill any existing process and stop timeout timer
-    m_processTimeout->stop();
-    if (m_process->state() != QProcess::NotRunning) {
-        m_process->terminate();
-        // Don't block UI - let the process terminate asynchronously
-        QTimer::singleShot(1000, this, [this]() {
-            if (m_process->state() != QProcess::NotRunning) {
-                m_process->kill();
-            }
-        });
-        // Wait briefly for termination without blocking
-        QCoreApplication::processEvents();
-        return; // Restart the request after cleanup
-    }
-
-    // Clear previous output buffer
-    m_processOutput.clear();
-
-    // Disconnect old connections to avoid duplicates
-    disconnect(m_process, nullptr, this, nullptr);
-
-    // Connect signals for async processing
-    connect(m_process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
-            this, &MainWindow::onProcessFinished);
-    connect(m_process, &QProcess::errorOccurred,
-            this, &MainWindow::onProcessError);
-    connect(m_process, &QProcess::readyReadStandardOutput,
-            this, &MainWindow::onProcessReadyRead);
-    connect(m_process, &QProcess::readyReadStandardError,
-            this, &MainWindow::onProcessReadyRead);
-    
-    // Find Python executable dynamically (embedded runtime or system Python)
-    QString pythonExecutable = findPythonExecutable();
-    
-    QStringList arguments;
-    arguments << scriptPath << city;
-    
-    qDebug() << "Executing:" << pythonExecutable << arguments;
-
-    // Start the process asynchronously
-    m_process->start(pythonExecutable, arguments);
-
-    // Start timeout timer
-    m_processTimeout->start();
-}
-
-void MainWindow::restartPythonProcess()
-{
-    qDebug() << "Attempting to restart Python process...";
-    
-    if (m_pythonRestartAttempts >= m_maxRestartAttempts) {
-        qWarning() << "Max restart attempts reached. Giving up.";
-        handleWeatherError(QString("Python process failed after %1 restart attempts. Please check your Python installation.").arg(m_maxRestartAttempts));
-        m_pythonRestartAttempts = 0;
-        return;
-    }
-    
-    m_pythonRestartAttempts++;
-    m_pendingCity = m_currentCity;
-    
-    // Show restart attempt in UI
-    m_weatherDetailsLabel->setText(QString("<span style='color: #ffa502;'>⚠️ Restarting Python process (attempt %1/%2)...</span>")
-                                   .arg(m_pythonRestartAttempts)
-                                   .arg(m_maxRestartAttempts));
-    
-    // Wait before restarting (exponential backoff)
-    int delayMs = m_settings->value("pythonRestartDelay", 2000).toInt() * m_pythonRestartAttempts;
-    m_restartTimer->setInterval(delayMs);
-    m_restartTimer->start();
+    // 取代之前未完成的请求
+    m_weatherRequests->request(city, immediate);
 }
 
-void MainWindow::attemptPythonRestart()
+void MainWindow::updateWeatherStatsToolTip()
 {
-    qDebug() << "Executing Python restart attempt" << m_pythonRestartAttempts;
-    
-    // Ensure previous process is terminated
-    if (m_process->state() != QProcess::NotRunning) {
-        m_process->kill();
-        m_process->waitForFinished(1000);
-    }
-    
-    // Try to reload weather for the pending city
-    if (!m_pendingCity.isEmpty()) {
-        m_currentCity = m_pendingCity;
-        loadWeatherForDefaultCity();
-    }
-}
-
-bool MainWindow::isPythonProcessHealthy() const
-{
-    return m_process && m_process->state() == QProcess::Running;
+    const WeatherSupervisor::Stats stats = m_weatherSupervisor->stats();
+    m_refreshButton->setToolTip(QString("Requests: %1  Failures: %2  Timeouts: %3  Restarts: %4\n"
+                                        "Latency p50/p95/p99: %5 / %6 / %7 ms")
+                                .arg(stats.completed)
+                                .arg(stats.failures)
+                                .arg(stats.timeouts)
+                                .arg(stats.restarts)
+                                .arg(stats.p50Ms)
+                                .arg(stats.p95Ms)
+                                .arg(stats.p99Ms));
 }
 
 // ========== File Operations ==========
@@ -1162,133 +1201,133 @@ void MainWindow::openFile()
         }
     }
 
-    QFile file(fileName);
-    if (!file.open(QFile::ReadOnly | QFile::Text)) {
+    loadFile(fileName);
+}
+
+bool MainWindow::loadFile(const QString &fileName, QByteArray *fileData)
+{
+    QByteArray rawData;
+    QString error;
+    if (!DocumentIO::readFile(fileName, &rawData, &error)) {
         QMessageBox::warning(this, tr("Error"),
                            tr("Cannot read file %1:\n%2.")
                            .arg(QDir::toNativeSeparators(fileName))
-                           .arg(file.errorString()));
-        return;
+                           .arg(error));
+        return false;
     }
 
-    // Read raw bytes to detect encoding
-    QByteArray rawData = file.readAll();
-    file.close();
-    
-    // Detect BOM and encoding
-    m_currentEncoding = QStringConverter::Utf8;  // Default
-    m_fileBOM.clear();  // Clear previous BOM
-    int bomSize = 0;
-    
-    if (rawData.size() >= 3 && 
-        (unsigned char)rawData[0] == 0xEF && 
-        (unsigned char)rawData[1] == 0xBB && 
-        (unsigned char)rawData[2] == 0xBF) {
-        // UTF-8 BOM
-        m_currentEncoding = QStringConverter::Utf8;
-        m_fileBOM = rawData.left(3);
-        bomSize = 3;
-    } else if (rawData.size() >= 2) {
-        if ((unsigned char)rawData[0] == 0xFF && (unsigned char)rawData[1] == 0xFE) {
-            // UTF-16 LE BOM
-            m_currentEncoding = QStringConverter::Utf16LE;
-            m_fileBOM = rawData.left(2);
-            bomSize = 2;
-        } else if ((unsigned char)rawData[0] == 0xFE && (unsigned char)rawData[1] == 0xFF) {
-            // UTF-16 BE BOM
-            m_currentEncoding = QStringConverter::Utf16BE;
-            m_fileBOM = rawData.left(2);
-            bomSize = 2;
-        }
+    DocumentIO::Document document;
+    const DocumentIO::DecodeResult result = DocumentIO::decode(rawData, &document);
+    if (result == DocumentIO::DecodeFailed) {
+        QMessageBox::critical(this, tr("Error"),
+                           tr("Cannot decode file %1.\nFile may be corrupted or use an unsupported encoding.")
+                           .arg(QDir::toNativeSeparators(fileName)));
+        return false;
     }
-    
-    // Decode content
-    QStringDecoder decoder(m_currentEncoding);
-    QString content = decoder(rawData.mid(bomSize));
-    
-    // Check for decoding errors
-    if (decoder.hasError()) {
+    if (result == DocumentIO::DecodedAsUtf8) {
         QMessageBox::warning(this, tr("Encoding Error"),
-                           tr("Failed to decode file %1 with detected encoding.\nTrying UTF-8...")
+                           tr("Failed to decode file %1 with detected encoding.\nFell back to UTF-8.")
                            .arg(QDir::toNativeSeparators(fileName)));
-        
-        // Fallback to UTF-8
-        m_currentEncoding = QStringConverter::Utf8;
-        QStringDecoder utf8Decoder(QStringConverter::Utf8);
-        content = utf8Decoder(rawData);
-        
-        if (utf8Decoder.hasError()) {
-            QMessageBox::critical(this, tr("Error"),
-                               tr("Cannot decode file %1.\nFile may be corrupted or use an unsupported encoding.")
-                               .arg(QDir::toNativeSeparators(fileName)));
-            return;
-        }
     }
 
-    m_markdownEditor->setPlainText(content);
+    m_currentEncoding = document.encoding;
+    m_fileBOM = document.bom;
+    m_markdownEditor->setPlainText(document.text);
     m_currentFilePath = fileName;
     m_isModified = false;
     updateWindowTitle();
+
+    if (fileData) {
+        *fileData = rawData;
+    }
+    return true;
 }
 
-void MainWindow::saveFile()
+void MainWindow::restoreSession()
 {
-    if (m_currentFilePath.isEmpty()) {
-        saveFileAs();
+    const QString filePath = m_settings->get<Key::SessionFile>();
+    if (filePath.isEmpty() || !QFileInfo(filePath).isFile()) {
         return;
     }
 
-    // Use QSaveFile for atomic writes
-    QSaveFile file(m_currentFilePath);
-    if (!file.open(QFile::WriteOnly | QFile::Text)) {
-        QMessageBox::warning(this, tr("Error"),
-                           tr("Cannot write file %1:\n%2.")
-                           .arg(QDir::toNativeSeparators(m_currentFilePath))
-                           .arg(file.errorString()));
+    QByteArray fileData;
+    if (!loadFile(filePath, &fileData)) {
         return;
     }
 
-    // Encode content using original encoding
-    QString content = m_markdownEditor->toPlainText();
-    QStringEncoder encoder(m_currentEncoding);
-    QByteArray encodedData = encoder(content);
-    
-    if (encoder.hasError()) {
-        QMessageBox::warning(this, tr("Encoding Error"),
-                           tr("Failed to encode file with original encoding.\nFalling back to UTF-8."));
-        m_currentEncoding = QStringConverter::Utf8;
-        QStringEncoder utf8Encoder(QStringConverter::Utf8);
-        encodedData = utf8Encoder(content);
+    // 磁盘文件未变化时直接显示上次的预览快照，跳过这次渲染
+    const QString theme = m_settings->get<Key::Theme>();
+    const QString snapshot = m_previewSnapshots.load(PreviewSnapshotCache::keyFor(fileData, theme));
+    if (!snapshot.isEmpty()) {
+        m_previewUpdateTimer->stop();
+        m_previewHtml = snapshot;
+        m_markdownPreview->setHtml(snapshot);
     }
-    
-    // Write BOM if present
-    if (!m_fileBOM.isEmpty()) {
-        if (file.write(m_fileBOM) == -1) {
-            QMessageBox::warning(this, tr("Error"),
-                               tr("Cannot write file %1:\n%2.")
-                               .arg(QDir::toNativeSeparators(m_currentFilePath))
-                               .arg(file.errorString()));
-            file.cancelWriting();
-            return;
-        }
+
+    QTextCursor cursor = m_markdownEditor->textCursor();
+    const int maxPosition = m_markdownEditor->document()->characterCount() - 1;
+    cursor.setPosition(qBound(0, m_settings->get<Key::SessionCursor>(), maxPosition));
+    m_markdownEditor->setTextCursor(cursor);
+
+    // 滚动范围在首次布局后才确定，放到事件循环中恢复
+    const int editorScroll = m_settings->get<Key::SessionEditorScroll>();
+    const int previewScroll = m_settings->get<Key::SessionPreviewScroll>();
+    QTimer::singleShot(0, this, [this, editorScroll, previewScroll]() {
+        m_markdownEditor->verticalScrollBar()->setValue(editorScroll);
+        m_markdownPreview->verticalScrollBar()->setValue(previewScroll);
+    });
+}
+
+void MainWindow::saveSession()
+{
+    m_settings->set<Key::SessionFile>(m_currentFilePath);
+    m_settings->set<Key::SessionCursor>(m_markdownEditor->textCursor().position());
+    m_settings->set<Key::SessionEditorScroll>(m_markdownEditor->verticalScrollBar()->value());
+    m_settings->set<Key::SessionPreviewScroll>(m_markdownPreview->verticalScrollBar()->value());
+
+    // 只为与磁盘内容一致的文档保存快照
+    if (m_currentFilePath.isEmpty() || m_isModified) {
+        return;
     }
-    
-    // Write data
-    if (file.write(encodedData) == -1) {
-        QMessageBox::warning(this, tr("Error"),
-                           tr("Cannot write file %1:\n%2.")
-                           .arg(QDir::toNativeSeparators(m_currentFilePath))
-                           .arg(file.errorString()));
-        file.cancelWriting();
+    if (m_previewUpdateTimer->isActive()) {
+        m_previewUpdateTimer->stop();
+        refreshPreview();
+    }
+    if (m_previewHtml.isEmpty()) {
         return;
     }
-    
-    // Commit the file (atomic operation)
-    if (!file.commit()) {
+
+    QFile file(m_currentFilePath);
+    if (file.open(QFile::ReadOnly)) {
+        const QString theme = m_settings->get<Key::Theme>();
+        m_previewSnapshots.store(PreviewSnapshotCache::keyFor(file.readAll(), theme), m_previewHtml);
+    }
+}
+
+void MainWindow::saveFile()
+{
+    if (m_currentFilePath.isEmpty()) {
+        saveFileAs();
+        return;
+    }
+
+    // Encode content using original encoding
+    DocumentIO::Document document;
+    document.text = m_markdownEditor->toPlainText();
+    document.encoding = m_currentEncoding;
+    QByteArray encodedData;
+    if (!DocumentIO::encode(&document, &encodedData)) {
+        QMessageBox::warning(this, tr("Encoding Error"),
+                           tr("Failed to encode file with original encoding.\nFalling back to UTF-8."));
+        m_currentEncoding = document.encoding;
+    }
+
+    QString error;
+    if (!DocumentIO::writeFile(m_currentFilePath, m_fileBOM, encodedData, &error)) {
         QMessageBox::warning(this, tr("Error"),
                            tr("Cannot save file %1:\n%2.")
                            .arg(QDir::toNativeSeparators(m_currentFilePath))
-                           .arg(file.errorString()));
+                           .arg(error));
         return;
     }
 
@@ -1332,67 +1371,24 @@ void MainWindow::saveFileAs()
     // 暂时为 saveFile 设置新路径
     m_currentFilePath = fileName;
     
-    // 使用 QSaveFile 进行原子写入
-    QSaveFile file(m_currentFilePath);
-    if (!file.open(QFile::WriteOnly | QFile::Text)) {
-        QMessageBox::warning(this, tr("Error"),
-                           tr("Cannot write file %1:\n%2.")
-                           .arg(QDir::toNativeSeparators(m_currentFilePath))
-                           .arg(file.errorString()));
-        // 失败时恢复旧路径
-        m_currentFilePath = oldPath;
-        m_isModified = oldModified;
-        return;
-    }
-
     // 使用原始编码对内容进行编码
-    QString content = m_markdownEditor->toPlainText();
-    QStringEncoder encoder(m_currentEncoding);
-    QByteArray encodedData = encoder(content);
-    
-    if (encoder.hasError()) {
+    DocumentIO::Document document;
+    document.text = m_markdownEditor->toPlainText();
+    document.encoding = m_currentEncoding;
+    QByteArray encodedData;
+    if (!DocumentIO::encode(&document, &encodedData)) {
         QMessageBox::warning(this, tr("Encoding Error"),
                            tr("Failed to encode file with original encoding.\nFalling back to UTF-8."));
-        m_currentEncoding = QStringConverter::Utf8;
-        QStringEncoder utf8Encoder(QStringConverter::Utf8);
-        encodedData = utf8Encoder(content);
-    }
-    
-    // 如果存在 BOM，则写入
-    if (!m_fileBOM.isEmpty()) {
-        if (file.write(m_fileBOM) == -1) {
-            QMessageBox::warning(this, tr("Error"),
-                               tr("Cannot write file %1:\n%2.")
-                               .arg(QDir::toNativeSeparators(m_currentFilePath))
-                               .arg(file.errorString()));
-            file.cancelWriting();
-            // 失败时恢复旧路径
-            m_currentFilePath = oldPath;
-            m_isModified = oldModified;
-            return;
-        }
-    }
-    
-    // 写入数据
-    if (file.write(encodedData) == -1) {
-        QMessageBox::warning(this, tr("Error"),
-                           tr("Cannot write file %1:\n%2.")
-                           .arg(QDir::toNativeSeparators(m_currentFilePath))
-                           .arg(file.errorString()));
-        file.cancelWriting();
-        // 失败时恢复旧路径
-        m_currentFilePath = oldPath;
-        m_isModified = oldModified;
-        return;
+        m_currentEncoding = document.encoding;
     }
-    
-    // 提交文件（原子操作）
-    if (!file.commit()) {
+
+    // 原子写入，失败时恢复旧路径
+    QString error;
+    if (!DocumentIO::writeFile(m_currentFilePath, m_fileBOM, encodedData, &error)) {
         QMessageBox::warning(this, tr("Error"),
                            tr("Cannot save file %1:\n%2.")
                            .arg(QDir::toNativeSeparators(m_currentFilePath))
-                           .arg(file.errorString()));
-        // 失败时恢复旧路径
+                           .arg(error));
         m_currentFilePath = oldPath;
         m_isModified = oldModified;
         return;
@@ -1403,6 +1399,77 @@ void MainWindow::saveFileAs()
     updateWindowTitle();
 }
 
+void MainWindow::exportPdf()
+{
+    if (m_pdfExporter->isRunning()) {
+        m_pdfProgress->show();
+        m_pdfProgress->raise();
+        return;
+    }
+
+    QString defaultPath = "untitled.pdf";
+    if (!m_currentFilePath.isEmpty()) {
+        QFileInfo sourceInfo(m_currentFilePath);
+        defaultPath = sourceInfo.dir().filePath(sourceInfo.completeBaseName() + ".pdf");
+    }
+
+    QString fileName = QFileDialog::getSaveFileName(
+        this,
+        tr("Export PDF"),
+        defaultPath,
+        tr("PDF Files (*.pdf)")
+    );
+
+    if (fileName.isEmpty()) {
+        return;
+    }
+
+    // 防抖定时器尚未触发时先刷新预览，保证导出的是最新内容
+    if (m_previewUpdateTimer->isActive()) {
+        m_previewUpdateTimer->stop();
+        refreshPreview();
+    }
+
+    if (!m_pdfProgress) {
+        // 非模态进度对话框：导出期间编辑器保持可用
+        m_pdfProgress = new QProgressDialog(this);
+        m_pdfProgress->setWindowTitle(tr("Export PDF"));
+        m_pdfProgress->setWindowModality(Qt::NonModal);
+        m_pdfProgress->setAutoClose(false);
+        m_pdfProgress->setAutoReset(false);
+        m_pdfProgress->setMinimumDuration(300);
+        connect(m_pdfProgress, &QProgressDialog::canceled, m_pdfExporter, &PdfExporter::cancel);
+        connect(m_pdfExporter, &PdfExporter::progress, this, [this](int page, int pageCount) {
+            m_pdfProgress->setMaximum(pageCount);
+            m_pdfProgress->setValue(page);
+            m_pdfProgress->setLabelText(tr("Rendering page %1 of %2...").arg(page).arg(pageCount));
+        });
+        connect(m_pdfExporter, &PdfExporter::finished, this, &MainWindow::onPdfExportFinished);
+    }
+
+    m_pdfProgress->reset();
+    m_pdfProgress->setMaximum(0);  // 页数未知前显示忙碌状态
+    m_pdfProgress->setLabelText(tr("Laying out pages..."));
+    // reset() 停止了显示计时器；setValue(0) 重新开始计时，排版超过 minimumDuration 时显示并可取消
+    m_pdfProgress->setValue(0);
+
+    m_pdfExporter->start(m_markdownPreview->document(), fileName);
+}
+
+void MainWindow::onPdfExportFinished(bool ok, const QString &filePath, const QString &error)
+{
+    const bool canceled = m_pdfProgress->wasCanceled();
+    m_pdfProgress->reset();
+    m_pdfProgress->hide();
+
+    if (!ok && !canceled) {
+        QMessageBox::warning(this, tr("Error"),
+                           tr("Cannot export PDF %1:\n%2.")
+                           .arg(QDir::toNativeSeparators(filePath))
+                           .arg(error));
+    }
+}
+
 bool MainWindow::maybeSave()
 {
     if (!m_isModified) {
@@ -1458,14 +1525,11 @@ void MainWindow::setZoom(double level)
         return;
     }
 
-    // 计算缩放变化比例
-    double zoomChange = newZoom / m_currentZoom;
-
     // 更新当前缩放
     m_currentZoom = newZoom;
 
-    // 将缩放级别保存到设置（防抖）
-    m_zoomSettingsSaveTimer->start();
+    // 将缩放级别保存到设置（SettingsManager 合并连续的写入）
+    m_settings->set<Key::Zoom>(m_currentZoom);
 
     // 更新缩放按钮文本以显示当前百分比
     if (m_zoomResetButton) {
@@ -1473,34 +1537,61 @@ void MainWindow::setZoom(double level)
         m_zoomResetButton->setText(QString("%1%").arg(percentage));
     }
 
-    // 通过缩放字体将缩放应用于编辑器
+    // 字体在 applyZoomFrame / applyPreviewZoom 中按绝对值设置
+    m_zoomController->setTarget(m_currentZoom);
+}
+
+void MainWindow::applyZoomFrame(double zoom)
+{
+    // 编辑器：一次绝对字号设置（样式表中不再指定 font-size）
     QFont editorFont = m_markdownEditor->font();
-    int baseFontSize = 14;  // 来自样式表的基准字体大小
-    editorFont.setPointSizeF(baseFontSize * m_currentZoom);
+    editorFont.setPointSizeF(EDITOR_BASE_POINT_SIZE * zoom);
     m_markdownEditor->setFont(editorFont);
 
-    // 使用 QTextBrowser 内置的 zoomIn/zoomOut 将缩放应用于预览
-    // QTextBrowser 的缩放是乘法运算，因此我们应用比例
-    if (zoomChange > 1.0) {
-        // 放大 - 计算步骤
-        double factor = zoomChange;
-        while (factor > 1.01) {  // 小阈值以避免浮点问题
-            m_markdownPreview->zoomIn(1);
-            factor /= 1.1;  // 每个 zoomIn 步长约为 1.1x
-        }
-    } else if (zoomChange < 1.0) {
-        // 缩小 - 计算步骤
-        double factor = zoomChange;
-        while (factor < 0.99) {  // 小阈值以避免浮点问题
-            m_markdownPreview->zoomOut(1);
-            factor *= 1.1;  // 每个 zoomOut 步长约为 0.9x (1/1.1)
-        }
+    // 预览：重新布局放到手势结束，期间按比例缩放上一次布局的截图
+    if (qFuzzyCompare(zoom, m_previewZoom) || !m_markdownPreview->isVisible()) {
+        // 手势中途回到当前布局的缩放：直接显示预览本身，不留下旧的截图
+        hidePreviewZoomOverlay();
+        return;
+    }
+    QWidget *viewport = m_markdownPreview->viewport();
+    if (!m_previewZoomOverlay->isVisible()) {
+        m_previewZoomSnapshot = viewport->grab();
+        m_previewZoomOverlay->setGeometry(viewport->geometry());
+        m_previewZoomOverlay->show();
+        m_previewZoomOverlay->raise();
     }
+    QPixmap scaled = m_previewZoomSnapshot.scaled(m_previewZoomSnapshot.size() * (zoom / m_previewZoom),
+                                                  Qt::KeepAspectRatio, Qt::FastTransformation);
+    scaled.setDevicePixelRatio(m_previewZoomSnapshot.devicePixelRatio());
+    m_previewZoomOverlay->setPixmap(scaled);
+}
 
-    // 注意：预览缩放已通过上述 zoomIn/zoomOut 调用应用
-    // 缩放操作期间无需重新生成 HTML
+void MainWindow::applyPreviewZoom(double zoom)
+{
+    if (!qFuzzyCompare(zoom, m_previewZoom)) {
+        // 一次绝对字号设置，整个手势只重新布局一次；按比例保持滚动位置
+        QScrollBar *scrollBar = m_markdownPreview->verticalScrollBar();
+        const double fraction = scrollBar->maximum() > 0 ? double(scrollBar->value()) / scrollBar->maximum() : 0;
 
-    qDebug() << "Zoom level set to:" << m_currentZoom << "(" << qRound(m_currentZoom * 100) << "%)";
+        QFont previewFont = m_markdownPreview->font();
+        previewFont.setPointSizeF(m_previewBasePointSize * zoom);
+        m_markdownPreview->setFont(previewFont);
+        m_previewZoom = zoom;
+
+        scrollBar->setValue(qRound(fraction * scrollBar->maximum()));
+
+        qDebug() << "Zoom level set to:" << zoom << "(" << qRound(zoom * 100) << "%)";
+    }
+
+    hidePreviewZoomOverlay();
+}
+
+void MainWindow::hidePreviewZoomOverlay()
+{
+    m_previewZoomOverlay->hide();
+    m_previewZoomOverlay->clear();
+    m_previewZoomSnapshot = QPixmap();
 }
 
 void MainWindow::zoomIn()
@@ -1518,17 +1609,42 @@ void MainWindow::zoomReset()
     setZoom(DEFAULT_ZOOM);
 }
 
+void MainWindow::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::WindowStateChange) {
+        updateRefreshActivity();
+    }
+    QMainWindow::changeEvent(event);
+}
+
+void MainWindow::showEvent(QShowEvent *event)
+{
+    QMainWindow::showEvent(event);
+    updateRefreshActivity();
+}
+
+void MainWindow::hideEvent(QHideEvent *event)
+{
+    QMainWindow::hideEvent(event);
+    updateRefreshActivity();
+}
+
+void MainWindow::updateRefreshActivity()
+{
+    // 最小化或隐藏时暂停后台刷新
+    if (m_refreshScheduler) {
+        m_refreshScheduler->setActive(isVisible() && !isMinimized());
+    }
+}
+
 void MainWindow::wheelEvent(QWheelEvent *event)
 {
     // 检查 Ctrl 键是否按下
     if (event->modifiers() & Qt::ControlModifier) {
-        // 获取滚动增量
-        int delta = event->angleDelta().y();
-
-        if (delta > 0) {
-            zoomIn();
-        } else if (delta < 0) {
-            zoomOut();
+        // 每个滚轮刻度（120）一个缩放步长；高精度滚轮与触控板按比例缩放
+        const int delta = event->angleDelta().y();
+        if (delta != 0) {
+            setZoom(m_currentZoom + ZOOM_STEP * delta / 120.0);
         }
 
         event->accept();
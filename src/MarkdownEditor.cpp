@@ -11,15 +11,43 @@
 #include <QIcon>
 #include <QFontMetrics>
 #include <QSaveFile>
+#include <QScrollBar>
+#include <QTextBlock>
+#include <QHBoxLayout>
+#include <QGuiApplication>
+#include <QAbstractItemView>
+#include <QCompleter>
+#include <QStandardItemModel>
+#include "DocumentSearch.h"
+#include "EmojiDelegate.h"
+#include "EmojiModel.h"
+#include "EmojiSearchIndex.h"
+#include "EmojiShortcodes.h"
+#include "EmojiUsageStore.h"
+#include "LatencyMonitor.h"
 
 // ========== EmojiPickerDialog Implementation ==========
 
+namespace {
+
+constexpr int kRecentCount = 10;
+constexpr int kRecentRowHeight = 53;  // 一行单元（45）加上间距与边框
+constexpr int kShortcodeMinPrefix = 2;  // 输入两个字符后才弹出补全，与 GitHub 一致
+
+} // namespace
+
 EmojiPickerDialog::EmojiPickerDialog(QWidget *parent)
     : QDialog(parent)
     , m_selectedEmoji("")
-    , m_gridLayout(nullptr)
-    , m_scrollArea(nullptr)
+    , m_searchEdit(nullptr)
+    , m_recentLabel(nullptr)
+    , m_recentView(nullptr)
+    , m_view(nullptr)
+    , m_recentModel(nullptr)
+    , m_model(nullptr)
+    , m_usage(nullptr)
 {
+    m_usage = new EmojiUsageStore(QDir(QCoreApplication::applicationDirPath()).filePath("cache/emoji_usage.json"), this);
     setupUI();
 }
 
@@ -33,136 +61,89 @@ QString EmojiPickerDialog::selectedEmoji() const
     return m_selectedEmoji;
 }
 
-void EmojiPickerDialog::onEmojiClicked()
+int EmojiPickerDialog::exec()
 {
-    QPushButton *button = qobject_cast<QPushButton*>(sender());
-    if (button) {
-        m_selectedEmoji = button->text();
+    m_selectedEmoji.clear();
+    m_searchEdit->clear();
+    m_view->clearSelection();
+    m_recentView->clearSelection();
+    refreshUsage();
+    m_searchEdit->setFocus();
+    return QDialog::exec();
+}
+
+void EmojiPickerDialog::onEmojiActivated(const QModelIndex &index)
+{
+    if (index.isValid()) {
+        m_selectedEmoji = index.data().toString();
+        m_usage->record(m_selectedEmoji);
         accept();
     }
 }
 
-QStringList EmojiPickerDialog::getEmojiList() const
-{
-    QStringList emojis;
-    
-    // Smileys & Emotion
-    emojis << "😀" << "😃" << "😄" << "😁" << "😆" << "😅" << "🤣" << "😂"
-           << "🙂" << "🙃" << "😉" << "😊" << "😇" << "🥰" << "😍" << "🤩"
-           << "😘" << "😗" << "😚" << "😙" << "😋" << "😛" << "😜" << "🤪"
-           << "😝" << "🤑" << "🤗" << "🤭" << "🤫" << "🤔" << "🤐" << "🤨"
-           << "😐" << "😑" << "😶" << "😏" << "😒" << "🙄" << "😬" << "🤥"
-           << "😌" << "😔" << "😪" << "🤤" << "😴" << "😷" << "🤒" << "🤕"
-           << "🤢" << "🤮" << "🤧" << "🥵" << "🥶" << "😶‍🌫️" << "🥴" << "😵"
-           << "🤯" << "🤠" << "🥳" << "😎" << "🤓" << "🧐" << "😕" << "😟"
-           << "🙁" << "☹️" << "😮" << "😯" << "😲" << "😳" << "🥺" << "😦"
-           << "😧" << "😨" << "😰" << "😥" << "😢" << "😭" << "😱" << "😖"
-           << "😣" << "😞" << "😓" << "😩" << "😫" << "🥱" << "😤" << "😡"
-           << "😠" << "🤬" << "😈" << "👿" << "💀" << "☠️" << "💩" << "🤡";
-    
-    // Gestures & Body Parts
-    emojis << "👋" << "🤚" << "🖐️" << "✋" << "🖖" << "👌" << "🤏" << "✌️"
-           << "🤞" << "🤟" << "🤘" << "🤙" << "👈" << "👉" << "👆" << "🖕"
-           << "👇" << "☝️" << "👍" << "👎" << "✊" << "👊" << "🤛" << "🤜"
-           << "👏" << "🙌" << "👐" << "🤲" << "🤝" << "🙏" << "✍️" << "💅"
-           << "🤳" << "💪" << "🦾" << "🦿" << "🦵" << "🦶" << "👂" << "🦻"
-           << "👃" << "🧠" << "🦷" << "🦴" << "👀" << "👁️" << "👅" << "👄";
-    
-    // Animals & Nature
-    emojis << "🐶" << "🐱" << "🐭" << "🐹" << "🐰" << "🦊" << "🐻" << "🐼"
-           << "🐨" << "🐯" << "🦁" << "🐮" << "🐷" << "🐽" << "🐸" << "🐵"
-           << "🙈" << "🙉" << "🙊" << "🐒" << "🐔" << "🐧" << "🐦" << "🐤"
-           << "🐣" << "🐥" << "🦆" << "🦅" << "🦉" << "🦇" << "🐺" << "🐗"
-           << "🐴" << "🦄" << "🐝" << "🐛" << "🦋" << "🐌" << "🐞" << "🐜"
-           << "🦟" << "🦗" << "🕷️" << "🕸️" << "🦂" << "🐢" << "🐍" << "🦎"
-           << "🦖" << "🦕" << "🐙" << "🦑" << "🦐" << "🦞" << "🦀" << "🐡"
-           << "🐠" << "🐟" << "🐬" << "🐳" << "🐋" << "🦈" << "🐊" << "🐅"
-           << "🐆" << "🦓" << "🦍" << "🦧" << "🐘" << "🦛" << "🦏" << "🐪"
-           << "🐫" << "🦒" << "🦘" << "🐃" << "🐂" << "🐄" << "🐎" << "🐖"
-           << "🐏" << "🐑" << "🦙" << "🐐" << "🦌" << "🐕" << "🐩" << "🦮"
-           << "🐕‍🦺" << "🐈" << "🐈‍⬛" << "🐓" << "🦃" << "🦚" << "🦜" << "🦢";
-    
-    // Food & Drink
-    emojis << "🍏" << "🍎" << "🍐" << "🍊" << "🍋" << "🍌" << "🍉" << "🍇"
-           << "🍓" << "🍈" << "🍒" << "🍑" << "🥭" << "🍍" << "🥥" << "🥝"
-           << "🍅" << "🍆" << "🥑" << "🥦" << "🥬" << "🥒" << "🌶️" << "🌽"
-           << "🥕" << "🧄" << "🧅" << "🥔" << "🍠" << "🥐" << "🥯" << "🍞"
-           << "🥖" << "🥨" << "🧀" << "🥚" << "🍳" << "🧈" << "🥞" << "🧇"
-           << "🥓" << "🥩" << "🍗" << "🍖" << "🦴" << "🌭" << "🍔" << "🍟"
-           << "🍕" << "🥪" << "🥙" << "🧆" << "🌮" << "🌯" << "🥗" << "🥘"
-           << "🍝" << "🍜" << "🍲" << "🍛" << "🍣" << "🍱" << "🥟" << "🦪"
-           << "🍤" << "🍙" << "🍚" << "🍘" << "🍥" << "🥠" << "🥮" << "🍢"
-           << "🍡" << "🍧" << "🍨" << "🍦" << "🥧" << "🧁" << "🍰" << "🎂"
-           << "🍮" << "🍭" << "🍬" << "🍫" << "🍿" << "🍩" << "🍪" << "🌰"
-           << "🥜" << "🍯" << "🥛" << "🍼" << "☕" << "🍵" << "🧃" << "🥤"
-           << "🍶" << "🍺" << "🍻" << "🥂" << "🍷" << "🥃" << "🍸" << "🍹"
-           << "🧉" << "🍾" << "🧊" << "🥄" << "🍴" << "🍽️" << "🥣" << "🥡";
-    
-    // Sports & Activities
-    emojis << "⚽" << "🏀" << "🏈" << "⚾" << "🥎" << "🎾" << "🏐" << "🏉"
-           << "🥏" << "🎱" << "🪀" << "🏓" << "🏸" << "🏒" << "🏑" << "🥍"
-           << "🏏" << "🥅" << "⛳" << "🪁" << "🏹" << "🎣" << "🤿" << "🥊"
-           << "🥋" << "🎽" << "🛹" << "🛷" << "⛸️" << "🥌" << "🎿" << "⛷️"
-           << "🏂" << "🪂" << "🏋️" << "🤼" << "🤸" << "🤺" << "⛹️" << "🤾"
-           << "🏌️" << "🏇" << "🧘" << "🏊" << "🤽" << "🚣" << "🧗" << "🚴"
-           << "🚵" << "🤹" << "🎪" << "🎭" << "🎨" << "🎬" << "🎤" << "🎧"
-           << "🎼" << "🎹" << "🥁" << "🎷" << "🎺" << "🎸" << "🪕" << "🎻"
-           << "🎲" << "♟️" << "🎯" << "🎳" << "🎮" << "🎰" << "🧩";
-    
-    // Travel & Places
-    emojis << "🚗" << "🚕" << "🚙" << "🚌" << "🚎" << "🏎️" << "🚓" << "🚑"
-           << "🚒" << "🚐" << "🚚" << "🚛" << "🚜" << "🦯" << "🦽" << "🦼"
-           << "🛴" << "🚲" << "🛵" << "🏍️" << "🛺" << "🚨" << "🚔" << "🚍"
-           << "🚘" << "🚖" << "🚡" << "🚠" << "🚟" << "🚃" << "🚋" << "🚞"
-           << "🚝" << "🚄" << "🚅" << "🚈" << "🚂" << "🚆" << "🚇" << "🚊"
-           << "🚉" << "✈️" << "🛫" << "🛬" << "🛩️" << "💺" << "🛰️" << "🚀"
-           << "🛸" << "🚁" << "🛶" << "⛵" << "🚤" << "🛥️" << "🛳️" << "⛴️"
-           << "🚢" << "⚓" << "⛽" << "🚧" << "🚦" << "🚥" << "🚏" << "🗺️"
-           << "🗿" << "🗽" << "🗼" << "🏰" << "🏯" << "🏟️" << "🎡" << "🎢"
-           << "🎠" << "⛲" << "⛱️" << "🏖️" << "🏝️" << "🏜️" << "🌋" << "⛰️"
-           << "🏔️" << "🗻" << "🏕️" << "⛺" << "🏠" << "🏡" << "🏘️" << "🏚️"
-           << "🏗️" << "🏭" << "🏢" << "🏬" << "🏣" << "🏤" << "🏥" << "🏦";
-    
-    // Objects
-    emojis << "⌚" << "📱" << "📲" << "💻" << "⌨️" << "🖥️" << "🖨️" << "🖱️"
-           << "🖲️" << "🕹️" << "🗜️" << "💽" << "💾" << "💿" << "📀" << "📼"
-           << "📷" << "📸" << "📹" << "🎥" << "📽️" << "🎞️" << "📞" << "☎️"
-           << "📟" << "📠" << "📺" << "📻" << "🎙️" << "🎚️" << "🎛️" << "🧭"
-           << "⏱️" << "⏲️" << "⏰" << "🕰️" << "⌛" << "⏳" << "📡" << "🔋"
-           << "🔌" << "💡" << "🔦" << "🕯️" << "🪔" << "🧯" << "🛢️" << "💸"
-           << "💵" << "💴" << "💶" << "💷" << "💰" << "💳" << "💎" << "⚖️"
-           << "🧰" << "🔧" << "🔨" << "⚒️" << "🛠️" << "⛏️" << "🔩" << "⚙️"
-           << "🧱" << "⛓️" << "🧲" << "🔫" << "💣" << "🧨" << "🪓" << "🔪"
-           << "🗡️" << "⚔️" << "🛡️" << "🚬" << "⚰️" << "⚱️" << "🏺" << "🔮"
-           << "📿" << "🧿" << "💈" << "⚗️" << "🔭" << "🔬" << "🕳️" << "🩹"
-           << "🩺" << "💊" << "💉" << "🩸" << "🧬" << "🦠" << "🧫" << "🧪";
-    
-    // Symbols & Hearts
-    emojis << "❤️" << "🧡" << "💛" << "💚" << "💙" << "💜" << "🖤" << "🤍"
-           << "🤎" << "💔" << "❣️" << "💕" << "💞" << "💓" << "💗" << "💖"
-           << "💘" << "💝" << "💟" << "☮️" << "✝️" << "☪️" << "🕉️" << "☸️"
-           << "✡️" << "🔯" << "🕎" << "☯️" << "☦️" << "🛐" << "⛎" << "♈"
-           << "♉" << "♊" << "♋" << "♌" << "♍" << "♎" << "♏" << "♐"
-           << "♑" << "♒" << "♓" << "🆔" << "⚛️" << "🉑" << "☢️" << "☣️"
-           << "📴" << "📳" << "🈶" << "🈚" << "🈸" << "🈺" << "🈷️" << "✴️"
-           << "🆚" << "💮" << "🉐" << "㊙️" << "㊗️" << "🈴" << "🈵" << "🈹"
-           << "🈲" << "🅰️" << "🅱️" << "🆎" << "🆑" << "🅾️" << "🆘" << "❌"
-           << "⭕" << "🛑" << "⛔" << "📛" << "🚫" << "💯" << "💢" << "♨️"
-           << "🚷" << "🚯" << "🚳" << "🚱" << "🔞" << "📵" << "🚭" << "❗"
-           << "❕" << "❓" << "❔" << "‼️" << "⁉️" << "🔅" << "🔆" << "〽️"
-           << "⚠️" << "🚸" << "🔱" << "⚜️" << "🔰" << "♻️" << "✅" << "🈯"
-           << "💹" << "❇️" << "✳️" << "❎" << "🌐" << "💠" << "Ⓜ️" << "🌀";
-    
-    // Flags (selection)
-    emojis << "🏁" << "🚩" << "🎌" << "🏴" << "🏳️" << "🏳️‍🌈" << "🏳️‍⚧️" << "🏴‍☠️"
-           << "🇨🇳" << "🇺🇸" << "🇬🇧" << "🇯🇵" << "🇰🇷" << "🇫🇷" << "🇩🇪" << "🇮🇹"
-           << "🇪🇸" << "🇷🇺" << "🇨🇦" << "🇦🇺" << "🇧🇷" << "🇮🇳" << "🇲🇽" << "🇸🇬";
-    
-    return emojis;
+void EmojiPickerDialog::onSearchTextChanged(const QString &text)
+{
+    if (text.trimmed().isEmpty()) {
+        m_model->showAll();
+    } else {
+        m_model->setTableIndices(EmojiSearchIndex::instance().search(text, m_usageScores));
+    }
+    m_view->scrollToTop();
+}
+
+void EmojiPickerDialog::onSearchReturnPressed()
+{
+    // 回车插入排在第一位的结果
+    if (!m_searchEdit->text().trimmed().isEmpty() && m_model->rowCount() > 0) {
+        onEmojiActivated(m_model->index(0));
+    }
+}
+
+void EmojiPickerDialog::refreshUsage()
+{
+    const QDateTime now = QDateTime::currentDateTimeUtc();
+    const QStringList &emojis = EmojiModel::emojis();
+    m_usageScores.resize(emojis.size());
+    for (int i = 0; i < emojis.size(); ++i) {
+        m_usageScores[i] = m_usage->score(emojis.at(i), now);
+    }
+
+    QVector<int> recent;
+    for (const QString &glyph : m_usage->mostUsed(kRecentCount)) {
+        const int index = EmojiSearchIndex::instance().tableIndexOf(glyph);
+        if (index >= 0) {
+            recent.append(index);
+        }
+    }
+    m_recentModel->setTableIndices(recent);
+    m_recentLabel->setVisible(!recent.isEmpty());
+    m_recentView->setVisible(!recent.isEmpty());
+}
+
+QListView *EmojiPickerDialog::createEmojiView(EmojiModel *model, const QString &objectName)
+{
+    // 虚拟化的网格：只绘制可见单元，字形从共享的图集中拷贝
+    QListView *view = new QListView(this);
+    view->setObjectName(objectName);
+    view->setModel(model);
+    view->setItemDelegate(new EmojiDelegate(view));
+    view->setFlow(QListView::LeftToRight);
+    view->setWrapping(true);
+    view->setResizeMode(QListView::Adjust);
+    view->setMovement(QListView::Static);
+    view->setUniformItemSizes(true);
+    view->setSpacing(2);
+    view->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    view->setMouseTracking(true);
+    view->viewport()->setAttribute(Qt::WA_Hover);
+    connect(view, &QListView::clicked, this, &EmojiPickerDialog::onEmojiActivated);
+    connect(view, &QListView::activated, this, &EmojiPickerDialog::onEmojiActivated);
+    return view;
 }
 
 void EmojiPickerDialog::setupUI()
 {
+    setObjectName("emojiPicker");  // 样式见 theme.qss
     setWindowTitle("Select Emoji 😀");
     setMinimumSize(500, 400);
     
@@ -172,67 +153,33 @@ void EmojiPickerDialog::setupUI()
     QLabel *titleLabel = new QLabel("Click an emoji to insert:", this);
     titleLabel->setStyleSheet("font-size: 14px; font-weight: bold; padding: 10px;");
     mainLayout->addWidget(titleLabel);
-    
-    // Create scroll area
-    m_scrollArea = new QScrollArea(this);
-    m_scrollArea->setWidgetResizable(true);
-    m_scrollArea->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    
-    // Create container widget for grid
-    QWidget *container = new QWidget(this);
-    m_gridLayout = new QGridLayout(container);
-    m_gridLayout->setSpacing(5);
-    m_gridLayout->setContentsMargins(10, 10, 10, 10);
-    
-    // Get emoji list and create buttons
-    QStringList emojis = getEmojiList();
-    int columns = 10;  // 10 emojis per row
-    
-    for (int i = 0; i < emojis.size(); ++i) {
-        QPushButton *emojiButton = new QPushButton(emojis[i], container);
-        emojiButton->setFixedSize(45, 45);
-        emojiButton->setStyleSheet(
-            "QPushButton {"
-            "    font-size: 24px;"
-            "    background-color: #2d2d2d;"
-            "    border: 1px solid #3d3d3d;"
-            "    border-radius: 4px;"
-            "}"
-            "QPushButton:hover {"
-            "    background-color: #3d3d3d;"
-            "    border: 2px solid #00d4ff;"
-            "}"
-            "QPushButton:pressed {"
-            "    background-color: #00d4ff;"
-            "}"
-        );
-        
-        connect(emojiButton, &QPushButton::clicked, this, &EmojiPickerDialog::onEmojiClicked);
-        
-        int row = i / columns;
-        int col = i % columns;
-        m_gridLayout->addWidget(emojiButton, row, col);
-    }
-    
-    m_scrollArea->setWidget(container);
-    mainLayout->addWidget(m_scrollArea);
+
+    m_searchEdit = new QLineEdit(this);
+    m_searchEdit->setObjectName("emojiSearch");
+    m_searchEdit->setPlaceholderText("Search (e.g. smile, 笑, thumbs up)");
+    m_searchEdit->setClearButtonEnabled(true);
+    connect(m_searchEdit, &QLineEdit::textChanged, this, &EmojiPickerDialog::onSearchTextChanged);
+    connect(m_searchEdit, &QLineEdit::returnPressed, this, &EmojiPickerDialog::onSearchReturnPressed);
+    mainLayout->addWidget(m_searchEdit);
+
+    // 常用表情：单行，没有使用记录时隐藏
+    m_recentLabel = new QLabel("Frequently used", this);
+    m_recentLabel->setObjectName("emojiRecentLabel");
+    mainLayout->addWidget(m_recentLabel);
+
+    m_recentModel = new EmojiModel(this);
+    m_recentView = createEmojiView(m_recentModel, "emojiRecentView");
+    m_recentView->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    m_recentView->setFixedHeight(kRecentRowHeight);
+    mainLayout->addWidget(m_recentView);
+
+    m_model = new EmojiModel(this);
+    m_view = createEmojiView(m_model, "emojiView");
+    mainLayout->addWidget(m_view);
     
     // Add cancel button
     QPushButton *cancelButton = new QPushButton("Cancel", this);
-    cancelButton->setStyleSheet(
-        "QPushButton {"
-        "    background-color: #1a1a1a;"
-        "    color: #ffffff;"
-        "    border: 1px solid #3d3d3d;"
-        "    border-radius: 4px;"
-        "    padding: 8px 16px;"
-        "    font-size: 13px;"
-        "}"
-        "QPushButton:hover {"
-        "    background-color: #3d3d3d;"
-        "    border: 1px solid #00d4ff;"
-        "}"
-    );
+    cancelButton->setObjectName("emojiCancelButton");
     connect(cancelButton, &QPushButton::clicked, this, &QDialog::reject);
     mainLayout->addWidget(cancelButton);
 }
@@ -244,6 +191,8 @@ MarkdownEditorWidget::MarkdownEditorWidget(QWidget *parent)
     , m_layout(nullptr)
     , m_toolbar(nullptr)
     , m_editor(nullptr)
+    , m_findBar(nullptr)
+    , m_emojiDialog(nullptr)
 {
     m_layout = new QVBoxLayout(this);
     m_layout->setContentsMargins(0, 0, 0, 0);
@@ -252,6 +201,12 @@ MarkdownEditorWidget::MarkdownEditorWidget(QWidget *parent)
     setupToolbar();
     
     m_editor = new MarkdownEditor(this);
+
+    // 查找栏位于工具栏和编辑器之间，默认隐藏
+    m_findBar = new FindReplaceBar(m_editor, this);
+    m_findBar->hide();
+    m_layout->addWidget(m_findBar);
+
     m_layout->addWidget(m_editor);
 }
 
@@ -265,37 +220,21 @@ QPlainTextEdit* MarkdownEditorWidget::editor() const
     return m_editor;
 }
 
+QToolBar* MarkdownEditorWidget::toolbar() const
+{
+    return m_toolbar;
+}
+
+QWidget* MarkdownEditorWidget::findBar() const
+{
+    return m_findBar;
+}
+
 void MarkdownEditorWidget::setupToolbar()
 {
     m_toolbar = new QToolBar(this);
     m_toolbar->setMovable(false);
-    m_toolbar->setStyleSheet(
-        "QToolBar {"
-        "    background-color: #2d2d2d;"
-        "    border: none;"
-        "    border-bottom: 2px solid #1a1a1a;"
-        "    padding: 5px;"
-        "    spacing: 3px;"
-        "}"
-        "QToolButton {"
-        "    background-color: #1a1a1a;"
-        "    color: #ffffff;"
-        "    border: 1px solid #3d3d3d;"
-        "    border-radius: 4px;"
-        "    padding: 6px 10px;"
-        "    font-size: 13px;"
-        "    font-weight: 600;"
-        "    margin: 2px;"
-        "}"
-        "QToolButton:hover {"
-        "    background-color: #3d3d3d;"
-        "    border: 1px solid #00d4ff;"
-        "}"
-        "QToolButton:pressed {"
-        "    background-color: #00d4ff;"
-        "    color: #000000;"
-        "}"
-    );
+    m_toolbar->setObjectName("editorToolbar");  // 样式见 theme.qss
     
     // Heading
     QAction *headingAction = new QAction("H1", this);
@@ -396,6 +335,21 @@ void MarkdownEditorWidget::setupToolbar()
     connect(emojiAction, &QAction::triggered, this, &MarkdownEditorWidget::insertEmoji);
     m_toolbar->addAction(emojiAction);
     
+    m_toolbar->addSeparator();
+    
+    // 查找 / 替换
+    QAction *findAction = new QAction("🔍 Find", this);
+    findAction->setToolTip("Find (Ctrl+F)");
+    findAction->setShortcut(QKeySequence::Find);
+    connect(findAction, &QAction::triggered, this, &MarkdownEditorWidget::showFind);
+    m_toolbar->addAction(findAction);
+    
+    QAction *replaceAction = new QAction("Replace", this);
+    replaceAction->setToolTip("Replace (Ctrl+R)");
+    replaceAction->setShortcut(QKeySequence("Ctrl+R"));
+    connect(replaceAction, &QAction::triggered, this, &MarkdownEditorWidget::showReplace);
+    addAction(replaceAction);  // 仅注册快捷键，不占用工具栏位置
+    
     m_layout->addWidget(m_toolbar);
 }
 
@@ -538,33 +492,37 @@ void MarkdownEditorWidget::insertTable()
     m_editor->setFocus();
 }
 
+void MarkdownEditorWidget::showFind()
+{
+    m_findBar->activate(false);
+}
+
+void MarkdownEditorWidget::showReplace()
+{
+    m_findBar->activate(true);
+}
+
 // ========== MarkdownEditor 实现 ==========
 
 MarkdownEditor::MarkdownEditor(QWidget *parent)
     : QPlainTextEdit(parent)
     , m_imageSaveDir("notes/images")
+    , m_search(new DocumentSearch(this))
+    , m_shortcodeCompleter(nullptr)
 {
     // 设置制表符宽度为 2 个空格
     QFontMetrics metrics(font());
     setTabStopDistance(metrics.horizontalAdvance(' ') * 2);
-    // 为编辑器设置默认样式
-    setStyleSheet(
-        "QPlainTextEdit {"
-        "    font-family: 'Consolas', 'Monaco', 'Courier New', monospace;"
-        "    font-size: 14px;"
-        "    border: 2px solid #2d2d2d;"
-        "    border-radius: 12px;"
-        "    padding: 15px;"
-        "    background-color: #1a1a1a;"
-        "    color: #ffffff;"
-        "    line-height: 1.6;"
-        "}"
-        "QPlainTextEdit:focus {"
-        "    border: 2px solid #00d4ff;"
-        "}"
-    );
+    // 样式（包括随主题变化的颜色）见 theme.qss 中的 [markdownEditor] 一节
+    setObjectName("markdownEditor");
     
     setPlaceholderText("在此处开始输入您的 Markdown 笔记...\n\n提示：您可以直接从剪贴板粘贴图片！");
+
+    // 查找引擎跟踪文档变化；高亮只在匹配集合或可见区域变化时刷新
+    m_search->setDocument(document());
+    connect(m_search, &DocumentSearch::matchesChanged, this, &MarkdownEditor::updateSearchHighlights);
+    connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &MarkdownEditor::updateSearchHighlights);
+    connect(this, &QPlainTextEdit::selectionChanged, this, &MarkdownEditor::updateSearchHighlights);
 }
 
 MarkdownEditor::~MarkdownEditor()
@@ -582,6 +540,186 @@ QString MarkdownEditor::imageSaveDirectory() const
     return m_imageSaveDir;
 }
 
+DocumentSearch* MarkdownEditor::search() const
+{
+    return m_search;
+}
+
+void MarkdownEditor::resizeEvent(QResizeEvent *event)
+{
+    QPlainTextEdit::resizeEvent(event);
+    updateSearchHighlights();
+}
+
+void MarkdownEditor::keyPressEvent(QKeyEvent *event)
+{
+    // 只统计会改变文本的按键；快捷键与光标移动不计入键入延迟
+    const QString text = event->text();
+    if ((!text.isEmpty() && text.at(0).isPrint()) || event->key() == Qt::Key_Backspace
+        || event->key() == Qt::Key_Delete || event->key() == Qt::Key_Return
+        || event->key() == Qt::Key_Enter || event->key() == Qt::Key_Tab) {
+        LatencyMonitor::instance().inputReceived();
+    }
+
+    // 补全弹出时由补全器处理确认与取消
+    if (m_shortcodeCompleter && m_shortcodeCompleter->popup()->isVisible()) {
+        switch (event->key()) {
+        case Qt::Key_Enter:
+        case Qt::Key_Return:
+        case Qt::Key_Tab:
+        case Qt::Key_Backtab:
+        case Qt::Key_Escape:
+            event->ignore();
+            return;
+        default:
+            break;
+        }
+    }
+
+    QPlainTextEdit::keyPressEvent(event);
+
+    const QString prefix = shortcodePrefix();
+    if (prefix.size() < kShortcodeMinPrefix) {
+        if (m_shortcodeCompleter) {
+            m_shortcodeCompleter->popup()->hide();
+        }
+        return;
+    }
+
+    QCompleter *completer = shortcodeCompleter();
+    if (prefix != completer->completionPrefix()) {
+        completer->setCompletionPrefix(prefix);
+        completer->popup()->setCurrentIndex(completer->completionModel()->index(0, 0));
+    }
+    if (completer->completionCount() == 0) {
+        completer->popup()->hide();
+        return;
+    }
+
+    QRect rect = cursorRect();
+    rect.setWidth(completer->popup()->sizeHintForColumn(0) + completer->popup()->verticalScrollBar()->sizeHint().width());
+    completer->complete(rect);
+}
+
+void MarkdownEditor::inputMethodEvent(QInputMethodEvent *event)
+{
+    if (!event->commitString().isEmpty()) {
+        LatencyMonitor::instance().inputReceived();
+    }
+    QPlainTextEdit::inputMethodEvent(event);
+}
+
+void MarkdownEditor::paintEvent(QPaintEvent *event)
+{
+    QPlainTextEdit::paintEvent(event);
+    LatencyMonitor::instance().inputPainted();
+}
+
+QCompleter *MarkdownEditor::shortcodeCompleter()
+{
+    if (m_shortcodeCompleter) {
+        return m_shortcodeCompleter;
+    }
+
+    // 显示 "表情  短代码"，按不含冒号的短代码匹配前缀
+    QStandardItemModel *model = new QStandardItemModel(this);
+    for (const QString &code : EmojiShortcodes::codes()) {
+        QStandardItem *item = new QStandardItem(QString::fromUtf8(EmojiShortcodes::lookup(code)) + "  :" + code + ":");
+        item->setData(code, Qt::UserRole);
+        model->appendRow(item);
+    }
+
+    m_shortcodeCompleter = new QCompleter(model, this);
+    m_shortcodeCompleter->setWidget(this);
+    m_shortcodeCompleter->setCompletionMode(QCompleter::PopupCompletion);
+    m_shortcodeCompleter->setCompletionRole(Qt::UserRole);
+    m_shortcodeCompleter->setModelSorting(QCompleter::CaseSensitivelySortedModel);
+    m_shortcodeCompleter->setCaseSensitivity(Qt::CaseSensitive);
+    m_shortcodeCompleter->setMaxVisibleItems(8);
+    connect(m_shortcodeCompleter, QOverload<const QModelIndex &>::of(&QCompleter::activated),
+            this, &MarkdownEditor::insertShortcode);
+    return m_shortcodeCompleter;
+}
+
+QString MarkdownEditor::shortcodePrefix() const
+{
+    const QTextCursor cursor = textCursor();
+    if (cursor.hasSelection()) {
+        return QString();
+    }
+
+    const QString text = cursor.block().text().left(cursor.positionInBlock());
+    const int colon = text.lastIndexOf(':');
+    // 冒号必须位于行首或空白之后，避免在 URL、时间等文本中弹出
+    if (colon < 0 || (colon > 0 && !text.at(colon - 1).isSpace())) {
+        return QString();
+    }
+
+    const QString prefix = text.mid(colon + 1);
+    for (QChar ch : prefix) {
+        if (!(ch.isLower() || ch.isDigit() || ch == '_' || ch == '+' || ch == '-') || ch.unicode() > 0x7f) {
+            return QString();
+        }
+    }
+    return prefix;
+}
+
+void MarkdownEditor::insertShortcode(const QModelIndex &index)
+{
+    const char *glyph = EmojiShortcodes::lookup(index.data(Qt::UserRole).toString());
+    const QString prefix = shortcodePrefix();
+    if (!glyph || prefix.isEmpty()) {
+        return;
+    }
+
+    // 用表情替换 ":前缀"
+    QTextCursor cursor = textCursor();
+    cursor.movePosition(QTextCursor::Left, QTextCursor::KeepAnchor, prefix.size() + 1);
+    cursor.insertText(QString::fromUtf8(glyph));
+    setTextCursor(cursor);
+}
+
+void MarkdownEditor::updateSearchHighlights()
+{
+    QList<QTextEdit::ExtraSelection> selections;
+
+    if (m_search->matchCount() > 0) {
+        // 可见范围：首个可见文本块到视口右下角所在文本块
+        const QTextBlock firstBlock = firstVisibleBlock();
+        const QTextBlock lastBlock = cursorForPosition(QPoint(viewport()->width() - 1,
+                                                              viewport()->height() - 1)).block();
+        const int from = firstBlock.position();
+        const int to = lastBlock.position() + lastBlock.length();
+
+        QTextCharFormat matchFormat;
+        matchFormat.setBackground(QColor(255, 165, 2, 90));
+        QTextCharFormat currentFormat;
+        currentFormat.setBackground(QColor("#ffa502"));
+        currentFormat.setForeground(QColor("#000000"));
+
+        const QTextCursor current = textCursor();
+        const std::vector<DocumentSearch::Match> &matches = m_search->matches();
+        const auto [first, last] = m_search->matchesInRange(from, to);
+
+        for (int i = first; i < last; ++i) {
+            const DocumentSearch::Match &match = matches[i];
+            QTextEdit::ExtraSelection selection;
+            selection.cursor = QTextCursor(document());
+            selection.cursor.setPosition(match.start);
+            selection.cursor.setPosition(match.start + match.length, QTextCursor::KeepAnchor);
+            const bool isCurrent = current.selectionStart() == match.start
+                                   && current.selectionEnd() == match.start + match.length;
+            selection.format = isCurrent ? currentFormat : matchFormat;
+            selections.append(selection);
+        }
+    }
+
+    if (selections.isEmpty() && extraSelections().isEmpty()) {
+        return;
+    }
+    setExtraSelections(selections);
+}
+
 bool MarkdownEditor::canInsertFromMimeData(const QMimeData *source) const
 {
     // 如果包含图片或基类可以处理，则接受
@@ -717,9 +855,13 @@ bool MarkdownEditor::ensureImageDirectoryExists()
 
 void MarkdownEditorWidget::insertEmoji()
 {
-    EmojiPickerDialog dialog(this);
-    if (dialog.exec() == QDialog::Accepted) {
-        QString selectedEmoji = dialog.selectedEmoji();
+    // 对话框在第一次使用时构建，之后复用
+    if (!m_emojiDialog) {
+        m_emojiDialog = new EmojiPickerDialog(this);
+        emit emojiPickerCreated(m_emojiDialog);
+    }
+    if (m_emojiDialog->exec() == QDialog::Accepted) {
+        QString selectedEmoji = m_emojiDialog->selectedEmoji();
         if (!selectedEmoji.isEmpty()) {
             QTextCursor cursor = m_editor->textCursor();
             cursor.insertText(selectedEmoji);
@@ -727,3 +869,255 @@ void MarkdownEditorWidget::insertEmoji()
         }
     }
 }
+
+// ========== FindReplaceBar 实现 ==========
+
+FindReplaceBar::FindReplaceBar(MarkdownEditor *editor, QWidget *parent)
+    : QWidget(parent)
+    , m_editor(editor)
+    , m_findEdit(nullptr)
+    , m_replaceEdit(nullptr)
+    , m_caseButton(nullptr)
+    , m_regexButton(nullptr)
+    , m_statusLabel(nullptr)
+    , m_replaceRow(nullptr)
+{
+    setObjectName("findReplaceBar");  // 样式见 theme.qss
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(6, 4, 6, 4);
+    layout->setSpacing(4);
+
+    // 查找行
+    QWidget *findRow = new QWidget(this);
+    QHBoxLayout *findLayout = new QHBoxLayout(findRow);
+    findLayout->setContentsMargins(0, 0, 0, 0);
+    findLayout->setSpacing(4);
+
+    m_findEdit = new QLineEdit(findRow);
+    m_findEdit->setPlaceholderText("Find");
+    m_findEdit->setClearButtonEnabled(true);
+    findLayout->addWidget(m_findEdit, 1);
+
+    m_caseButton = new QPushButton("Aa", findRow);
+    m_caseButton->setToolTip("Match case");
+    m_caseButton->setCheckable(true);
+    findLayout->addWidget(m_caseButton);
+
+    m_regexButton = new QPushButton(".*", findRow);
+    m_regexButton->setToolTip("Regular expression");
+    m_regexButton->setCheckable(true);
+    findLayout->addWidget(m_regexButton);
+
+    m_statusLabel = new QLabel(findRow);
+    m_statusLabel->setMinimumWidth(80);
+    findLayout->addWidget(m_statusLabel);
+
+    QPushButton *previousButton = new QPushButton("↑", findRow);
+    previousButton->setToolTip("Previous match (Shift+Enter)");
+    findLayout->addWidget(previousButton);
+
+    QPushButton *nextButton = new QPushButton("↓", findRow);
+    nextButton->setToolTip("Next match (Enter)");
+    findLayout->addWidget(nextButton);
+
+    QPushButton *closeButton = new QPushButton("✕", findRow);
+    closeButton->setToolTip("Close (Esc)");
+    findLayout->addWidget(closeButton);
+
+    layout->addWidget(findRow);
+
+    // 替换行
+    m_replaceRow = new QWidget(this);
+    QHBoxLayout *replaceLayout = new QHBoxLayout(m_replaceRow);
+    replaceLayout->setContentsMargins(0, 0, 0, 0);
+    replaceLayout->setSpacing(4);
+
+    m_replaceEdit = new QLineEdit(m_replaceRow);
+    m_replaceEdit->setPlaceholderText("Replace");
+    replaceLayout->addWidget(m_replaceEdit, 1);
+
+    QPushButton *replaceButton = new QPushButton("Replace", m_replaceRow);
+    replaceLayout->addWidget(replaceButton);
+
+    QPushButton *replaceAllButton = new QPushButton("Replace All", m_replaceRow);
+    replaceLayout->addWidget(replaceAllButton);
+
+    layout->addWidget(m_replaceRow);
+
+    connect(m_findEdit, &QLineEdit::textChanged, this, &FindReplaceBar::updateQuery);
+    connect(m_findEdit, &QLineEdit::returnPressed, this, [this]() {
+        if (QGuiApplication::keyboardModifiers() & Qt::ShiftModifier) {
+            findPrevious();
+        } else {
+            findNext();
+        }
+    });
+    connect(m_replaceEdit, &QLineEdit::returnPressed, this, &FindReplaceBar::replaceCurrent);
+    connect(m_caseButton, &QPushButton::toggled, this, &FindReplaceBar::updateQuery);
+    connect(m_regexButton, &QPushButton::toggled, this, &FindReplaceBar::updateQuery);
+    connect(previousButton, &QPushButton::clicked, this, &FindReplaceBar::findPrevious);
+    connect(nextButton, &QPushButton::clicked, this, &FindReplaceBar::findNext);
+    connect(replaceButton, &QPushButton::clicked, this, &FindReplaceBar::replaceCurrent);
+    connect(replaceAllButton, &QPushButton::clicked, this, &FindReplaceBar::replaceAll);
+    connect(closeButton, &QPushButton::clicked, this, [this]() {
+        hide();
+        m_editor->search()->clear();
+        m_editor->setFocus();
+    });
+
+    connect(m_editor->search(), &DocumentSearch::matchesChanged, this, &FindReplaceBar::updateStatus);
+    connect(m_editor, &QPlainTextEdit::selectionChanged, this, &FindReplaceBar::updateStatus);
+}
+
+FindReplaceBar::~FindReplaceBar()
+{
+    // Qt handles cleanup
+}
+
+void FindReplaceBar::activate(bool withReplace)
+{
+    m_replaceRow->setVisible(withReplace);
+    show();
+
+    // 以当前选中的单行文本作为查找词
+    const QString selected = m_editor->textCursor().selectedText();
+    if (!selected.isEmpty() && !selected.contains(QChar::ParagraphSeparator)) {
+        m_findEdit->setText(selected);
+    } else {
+        updateQuery();
+    }
+
+    m_findEdit->setFocus();
+    m_findEdit->selectAll();
+}
+
+void FindReplaceBar::keyPressEvent(QKeyEvent *event)
+{
+    if (event->key() == Qt::Key_Escape) {
+        hide();
+        m_editor->search()->clear();
+        m_editor->setFocus();
+        return;
+    }
+
+    // 回车已由输入框的 returnPressed 处理，不再向上传递
+    if (event->key() == Qt::Key_Return || event->key() == Qt::Key_Enter) {
+        event->accept();
+        return;
+    }
+
+    QWidget::keyPressEvent(event);
+}
+
+void FindReplaceBar::updateQuery()
+{
+    DocumentSearch *search = m_editor->search();
+    search->setQuery(m_findEdit->text(), m_caseButton->isChecked(), m_regexButton->isChecked());
+
+    // 增量查找：跳到光标处或之后的第一个匹配
+    if (search->matchCount() > 0) {
+        selectMatch(search->findNext(m_editor->textCursor().selectionStart()));
+    }
+    updateStatus();
+}
+
+void FindReplaceBar::findNext()
+{
+    DocumentSearch *search = m_editor->search();
+    if (search->matchCount() == 0) {
+        return;
+    }
+    selectMatch(search->findNext(m_editor->textCursor().selectionEnd()));
+}
+
+void FindReplaceBar::findPrevious()
+{
+    DocumentSearch *search = m_editor->search();
+    if (search->matchCount() == 0) {
+        return;
+    }
+    selectMatch(search->findNext(m_editor->textCursor().selectionStart(), true));
+}
+
+void FindReplaceBar::replaceCurrent()
+{
+    DocumentSearch *search = m_editor->search();
+    const int index = currentMatchIndex();
+    if (index < 0) {
+        findNext();
+        return;
+    }
+
+    const int end = search->replaceAt(index, m_replaceEdit->text());
+    if (end >= 0) {
+        // 从实际插入文本之后继续定位到下一个匹配（反向引用可能改变插入长度）
+        selectMatch(search->findNext(end));
+    }
+}
+
+void FindReplaceBar::replaceAll()
+{
+    DocumentSearch *search = m_editor->search();
+    const int position = m_editor->textCursor().position();
+    const int count = search->replaceAll(m_replaceEdit->text());
+
+    if (count > 0) {
+        QTextCursor cursor = m_editor->textCursor();
+        cursor.setPosition(qMin(position, m_editor->document()->characterCount() - 1));
+        m_editor->setTextCursor(cursor);
+    }
+    m_statusLabel->setText(QString("Replaced %1").arg(count));
+}
+
+void FindReplaceBar::updateStatus()
+{
+    if (!isVisible()) {
+        return;
+    }
+
+    DocumentSearch *search = m_editor->search();
+    const QString error = search->errorString();
+    if (!error.isEmpty()) {
+        m_statusLabel->setText("Invalid regex");
+        m_statusLabel->setToolTip(error);
+        return;
+    }
+    m_statusLabel->setToolTip(QString());
+
+    if (search->pattern().isEmpty()) {
+        m_statusLabel->clear();
+    } else if (search->matchCount() == 0) {
+        m_statusLabel->setText("No results");
+    } else {
+        const int index = currentMatchIndex();
+        m_statusLabel->setText(QString("%1/%2")
+                               .arg(index >= 0 ? QString::number(index + 1) : QString("?"))
+                               .arg(search->matchCount()));
+    }
+}
+
+void FindReplaceBar::selectMatch(int index)
+{
+    DocumentSearch *search = m_editor->search();
+    if (index < 0 || index >= search->matchCount()) {
+        return;
+    }
+
+    const DocumentSearch::Match &match = search->matches()[index];
+    QTextCursor cursor = m_editor->textCursor();
+    cursor.setPosition(match.start);
+    cursor.setPosition(match.start + match.length, QTextCursor::KeepAnchor);
+    m_editor->setTextCursor(cursor);
+    m_editor->centerCursor();
+}
+
+int FindReplaceBar::currentMatchIndex() const
+{
+    const QTextCursor cursor = m_editor->textCursor();
+    if (!cursor.hasSelection()) {
+        return -1;
+    }
+    return m_editor->search()->indexOf(cursor.selectionStart(),
+                                       cursor.selectionEnd() - cursor.selectionStart());
+}
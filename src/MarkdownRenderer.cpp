@@ -0,0 +1,213 @@
+#include "MarkdownRenderer.h"
+#include "EmojiShortcodes.h"
+#include "ThemeTokens.h"
+#include <QRegularExpression>
+#include <QStringList>
+
+namespace {
+
+// 样式前导的颜色依次取自这些主题令牌：背景、正文、强调、次要文字、边框、
+// 代码块背景、行内代码背景、偶数表格行。同一主题内的颜色必须互不相同，
+// 切换主题时才能按颜色值逐一替换（见 PreviewTheme）
+const char *const kPreludeTokens[] = {"surface", "text", "accent", "textSecondary",
+                                      "border", "window", "inlineCode", "tableStripe"};
+
+QStringList buildThemeColors(bool isDark)
+{
+    QStringList colors;
+    for (const char *token : kPreludeTokens) {
+        const QString color = QString::fromLatin1(ThemeTokens::value(token, isDark));
+        Q_ASSERT_X(!color.isEmpty() && !colors.contains(color), "MarkdownRenderer::themeColors",
+                   "preview colors must be known and distinct within a theme");
+        colors.append(color);
+    }
+    return colors;
+}
+
+QString buildStylePrelude(bool isDark)
+{
+    const QStringList &colors = MarkdownRenderer::themeColors(isDark);
+    return QString("<style>"
+        "body { font-family: 'SF Pro Display', 'Segoe UI', 'Microsoft YaHei', sans-serif; color: %2; background-color: %1; padding: 20px; line-height: 1.6; }"
+        "h1, h2, h3, h4, h5, h6 { color: %3; margin-top: 24px; margin-bottom: 16px; font-weight: 600; }"
+        "h1 { font-size: 2em; border-bottom: 2px solid %5; padding-bottom: 8px; }"
+        "h2 { font-size: 1.5em; border-bottom: 1px solid %5; padding-bottom: 6px; }"
+        "h3 { font-size: 1.25em; }"
+        "p { margin-bottom: 16px; }"
+        "code { background-color: %7; color: %3; padding: 2px 6px; border-radius: 4px; font-family: 'Consolas', 'Monaco', monospace; font-size: 0.9em; }"
+        "pre { background-color: %6; border: 1px solid %5; border-radius: 8px; padding: 16px; overflow-x: auto; margin: 16px 0; tab-size: 2; -moz-tab-size: 2; }"
+        "pre code { background-color: transparent; padding: 0; color: %2; display: block; }"
+        ".code-block-header { background-color: %5; color: %3; padding: 6px 12px; border-radius: 8px 8px 0 0; font-size: 0.85em; font-weight: 600; font-family: 'Consolas', 'Monaco', monospace; margin-bottom: -1px; }"
+        ".code-block-container { margin: 16px 0; }"
+        "blockquote { border-left: 4px solid %3; padding-left: 16px; margin-left: 0; color: %4; font-style: italic; }"
+        "a { color: %3; text-decoration: none; }"
+        "a:hover { text-decoration: underline; }"
+        "ul, ol { padding-left: 24px; margin-bottom: 16px; }"
+        "li { margin-bottom: 8px; }"
+        "table { border-collapse: collapse; width: 100%; margin: 16px 0; }"
+        "th, td { border: 1px solid %5; padding: 8px 12px; text-align: left; }"
+        "th { background-color: %5; color: %3; font-weight: 600; }"
+        "tr:nth-child(even) { background-color: %8; }"
+        "hr { border: none; border-top: 2px solid %5; margin: 24px 0; }"
+        "img { max-width: 100%; height: auto; border-radius: 8px; margin: 16px 0; }"
+        "strong { color: %3; font-weight: 600; }"
+        "em { color: %3; font-style: italic; opacity: 0.9; }"
+        "del { color: %4; text-decoration: line-through; }"
+        "</style><body>")
+        .arg(colors[0], colors[1], colors[2], colors[3], colors[4])
+        .arg(colors[5], colors[6], colors[7]);
+}
+
+} // namespace
+
+QString MarkdownRenderer::renderDocument(const QString &markdown, bool isDark)
+{
+    return stylePrelude(isDark) + renderBody(markdown) + "</body>";
+}
+
+const QStringList &MarkdownRenderer::themeColors(bool isDark)
+{
+    static const QStringList dark = buildThemeColors(true);
+    static const QStringList light = buildThemeColors(false);
+    return isDark ? dark : light;
+}
+
+const QString &MarkdownRenderer::stylePrelude(bool isDark)
+{
+    // 局部静态变量的初始化是线程安全的，每个主题只构建一次
+    static const QString darkPrelude = buildStylePrelude(true);
+    static const QString lightPrelude = buildStylePrelude(false);
+    return isDark ? darkPrelude : lightPrelude;
+}
+
+QString MarkdownRenderer::renderBody(const QString &markdown)
+{
+    // QRegularExpression 只保证可重入，每个线程持有自己的已编译副本
+    thread_local const QRegularExpression orderedListPattern("^\\d+\\. ");
+
+    QString html;
+
+    // Process markdown line by line
+    QStringList lines = markdown.split('\n');
+    bool inCodeBlock = false;
+    QString codeLanguage;
+    QString codeContent;
+
+    for (int i = 0; i < lines.size(); ++i) {
+        const QString &line = lines[i];
+
+        // Check for code block start/end
+        if (line.startsWith("```")) {
+            if (!inCodeBlock) {
+                // Start of code block
+                inCodeBlock = true;
+                codeLanguage = line.mid(3).trimmed();
+                if (codeLanguage.isEmpty()) {
+                    codeLanguage = "plaintext";
+                }
+                codeContent.clear();
+
+                // Add language header
+                html += QString("<div class='code-block-container'>"
+                               "<div class='code-block-header'>%1</div>"
+                               "<pre><code>").arg(codeLanguage.toHtmlEscaped());
+            } else {
+                // End of code block
+                html += codeContent.toHtmlEscaped();
+                html += "</code></pre></div>";
+                inCodeBlock = false;
+                codeLanguage.clear();
+                codeContent.clear();
+            }
+        } else if (inCodeBlock) {
+            // Inside code block
+            codeContent += line + "\n";
+        } else {
+            // Regular markdown line - use simple conversion
+            const QString &processedLine = line;
+
+            // Headers（锚点按源文本行号命名，供大纲跳转）
+            if (processedLine.startsWith("# ")) {
+                html += "<h1><a name='" + headingAnchor(i) + "'></a>" + processedLine.mid(2).toHtmlEscaped() + "</h1>";
+            } else if (processedLine.startsWith("## ")) {
+                html += "<h2><a name='" + headingAnchor(i) + "'></a>" + processedLine.mid(3).toHtmlEscaped() + "</h2>";
+            } else if (processedLine.startsWith("### ")) {
+                html += "<h3><a name='" + headingAnchor(i) + "'></a>" + processedLine.mid(4).toHtmlEscaped() + "</h3>";
+            }
+            // Horizontal rule
+            else if (processedLine.trimmed() == "---" || processedLine.trimmed() == "***") {
+                html += "<hr>";
+            }
+            // Unordered list
+            else if (processedLine.trimmed().startsWith("- ") || processedLine.trimmed().startsWith("* ")) {
+                QString content = processedLine.trimmed().mid(2);
+                html += "<ul><li>" + processInline(content) + "</li></ul>";
+            }
+            // Ordered list
+            else if (processedLine.trimmed().contains(orderedListPattern)) {
+                QString content = processedLine.trimmed();
+                content = content.mid(content.indexOf(". ") + 2);
+                html += "<ol><li>" + processInline(content) + "</li></ol>";
+            }
+            // Blockquote
+            else if (processedLine.startsWith("> ")) {
+                html += "<blockquote>" + processInline(processedLine.mid(2)) + "</blockquote>";
+            }
+            // Empty line
+            else if (processedLine.trimmed().isEmpty()) {
+                html += "<br>";
+            }
+            // Regular paragraph
+            else {
+                html += "<p>" + processInline(processedLine) + "</p>";
+            }
+        }
+    }
+
+    return html;
+}
+
+QString MarkdownRenderer::headingAnchor(int lineNumber)
+{
+    return QStringLiteral("line-%1").arg(lineNumber);
+}
+
+QString MarkdownRenderer::processInline(const QString &text)
+{
+    // 预编译的行内模式，避免每行重新编译正则表达式
+    thread_local const QRegularExpression boldStars("\\*\\*(.+?)\\*\\*");
+    thread_local const QRegularExpression boldUnderscores("__(.+?)__");
+    thread_local const QRegularExpression italicStar("\\*(.+?)\\*");
+    thread_local const QRegularExpression italicUnderscore("_(.+?)_");
+    thread_local const QRegularExpression strikethrough("~~(.+?)~~");
+    thread_local const QRegularExpression inlineCode("`(.+?)`");
+    thread_local const QRegularExpression link("\\[(.+?)\\]\\((.+?)\\)");
+    thread_local const QRegularExpression image("!\\[(.+?)\\]\\((.+?)\\)");
+
+    QString result = text.toHtmlEscaped();
+
+    // Emoji shortcodes: :smile: -> 😄（在 _ 被当作斜体标记之前展开）
+    EmojiShortcodes::expand(result);
+
+    // Bold: **text** or __text__
+    result.replace(boldStars, "<strong>\\1</strong>");
+    result.replace(boldUnderscores, "<strong>\\1</strong>");
+
+    // Italic: *text* or _text_
+    result.replace(italicStar, "<em>\\1</em>");
+    result.replace(italicUnderscore, "<em>\\1</em>");
+
+    // Strikethrough: ~~text~~
+    result.replace(strikethrough, "<del>\\1</del>");
+
+    // Inline code: `code`
+    result.replace(inlineCode, "<code>\\1</code>");
+
+    // Links: [text](url)
+    result.replace(link, "<a href='\\2'>\\1</a>");
+
+    // Images: ![alt](url)
+    result.replace(image, "<img src='\\2' alt='\\1'>");
+
+    return result;
+}
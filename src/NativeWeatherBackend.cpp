@@ -0,0 +1,461 @@
+#include "NativeWeatherBackend.h"
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
+#include <QEventLoop>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMetaObject>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QSaveFile>
+#include <QUrlQuery>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+constexpr int kTransferTimeoutMs = 10000;
+const char kCurrentFields[] = "temperature_2m,relative_humidity_2m,apparent_temperature,weather_code,wind_speed_10m,surface_pressure";
+
+// 与 weather_service.py 中的 WEATHER_CODES 保持一致
+QString describeWeatherCode(int code)
+{
+    switch (code) {
+    case 0:  return "晴朗";
+    case 1:  return "晴间多云";
+    case 2:  return "部分多云";
+    case 3:  return "阴天";
+    case 45: return "雾";
+    case 48: return "沉积雾";
+    case 51: return "毛毛雨";
+    case 53: return "中等毛毛雨";
+    case 55: return "密集的毛毛雨";
+    case 61: return "小雨";
+    case 63: return "中雨";
+    case 65: return "大雨";
+    case 71: return "小雪";
+    case 73: return "中雪";
+    case 75: return "大雪";
+    case 77: return "雪粒";
+    case 80: return "小阵雨";
+    case 81: return "中等阵雨";
+    case 82: return "剧烈阵雨";
+    case 85: return "小阵雪";
+    case 86: return "大阵雪";
+    case 95: return "雷暴";
+    case 96: return "雷暴伴有小冰雹";
+    case 99: return "雷暴伴有大冰雹";
+    default: return "未知";
+    }
+}
+
+double roundToTenth(double value)
+{
+    return std::round(value * 10.0) / 10.0;
+}
+
+QJsonObject formatCurrent(const QJsonObject &current, const QString &cityName)
+{
+    QJsonObject result;
+    result["city"] = cityName;
+    result["temperature"] = roundToTenth(current.value("temperature_2m").toDouble());
+    result["humidity"] = current.value("relative_humidity_2m");
+    result["description"] = describeWeatherCode(current.value("weather_code").toInt());
+    result["wind_speed"] = roundToTenth(current.value("wind_speed_10m").toDouble());
+    result["feels_like"] = roundToTenth(current.value("apparent_temperature").toDouble());
+    result["pressure"] = current.value("surface_pressure");
+    result["status"] = "success";
+    return result;
+}
+
+QJsonObject errorResult(const QString &city, const QString &error)
+{
+    QJsonObject result;
+    result["city"] = city;
+    result["temperature"] = 0;
+    result["humidity"] = 0;
+    result["description"] = "错误：" + error;
+    result["wind_speed"] = 0;
+    result["status"] = "error";
+    result["error_message"] = error;
+    return result;
+}
+
+// Open-Meteo 出错时在响应体中给出 {"error": true, "reason": "..."}
+QString replyError(QNetworkReply *reply, const QJsonDocument &document)
+{
+    const QString reason = document.object().value("reason").toString();
+    return reason.isEmpty() ? reply->errorString() : reason;
+}
+
+QUrl urlFromEnvironment(const char *name, const QString &fallback)
+{
+    return QUrl(qEnvironmentVariable(name, fallback));
+}
+
+} // namespace
+
+NativeWeatherBackend::NativeWeatherBackend(const QString &geocodeTablePath, QObject *parent)
+    : WeatherBackend(parent)
+    , m_network(new QNetworkAccessManager(this))
+    , m_geocodingUrl(urlFromEnvironment("OPEN_METEO_GEOCODING_URL", "https://geocoding-api.open-meteo.com/v1/search"))
+    , m_forecastUrl(urlFromEnvironment("OPEN_METEO_FORECAST_URL", "https://api.open-meteo.com/v1/forecast"))
+    , m_geocodeTablePath(geocodeTablePath)
+    , m_geocodeTableLoaded(false)
+    , m_nextRequestId(1)
+{
+    m_network->setTransferTimeout(kTransferTimeoutMs);
+}
+
+NativeWeatherBackend::~NativeWeatherBackend()
+{
+    for (PendingRequest &request : m_pending) {
+        abortReplies(request);
+    }
+}
+
+int NativeWeatherBackend::requestWeather(const QString &city)
+{
+    return startRequest(QStringList{city}, false);
+}
+
+int NativeWeatherBackend::requestWeatherBatch(const QStringList &cities)
+{
+    return startRequest(cities, true);
+}
+
+void NativeWeatherBackend::cancel(int requestId)
+{
+    auto it = m_pending.find(requestId);
+    if (it == m_pending.end()) {
+        return;
+    }
+    abortReplies(*it);
+    m_pending.erase(it);
+}
+
+int NativeWeatherBackend::ping()
+{
+    // 没有常驻进程需要检查：连接池由 QNetworkAccessManager 维护
+    const int requestId = m_nextRequestId++;
+    emit requestStarted(requestId);
+    QMetaObject::invokeMethod(this, [this, requestId]() {
+        QJsonObject pong;
+        pong["status"] = "success";
+        pong["pong"] = true;
+        emit weatherReady(requestId, pong);
+    }, Qt::QueuedConnection);
+    return requestId;
+}
+
+void NativeWeatherBackend::stop(const QString &reason)
+{
+    const QList<int> ids = m_pending.keys();
+    for (int id : ids) {
+        abortReplies(m_pending[id]);
+        m_pending.remove(id);
+        failLater(id, reason);
+    }
+}
+
+int NativeWeatherBackend::pendingCount() const
+{
+    return m_pending.size();
+}
+
+bool NativeWeatherBackend::isRunning() const
+{
+    // 没有需要启动的进程，随时可以发出请求
+    return true;
+}
+
+QString NativeWeatherBackend::defaultGeocodeTablePath()
+{
+    const QString fallback = QDir(QCoreApplication::applicationDirPath()).filePath("python/geocode_cache.json");
+    return qEnvironmentVariable("WEATHER_GEOCODE_TABLE", fallback);
+}
+
+int NativeWeatherBackend::startRequest(const QStringList &cities, bool batch)
+{
+    const int requestId = m_nextRequestId++;
+
+    PendingRequest request;
+    request.cities = cities;
+    request.batch = batch;
+    request.locations.resize(cities.size());
+    request.results.resize(cities.size());
+    request.unresolved = 0;
+
+    for (int i = 0; i < cities.size(); ++i) {
+        request.locations[i] = lookupLocation(cities.at(i));
+        if (request.locations.at(i).isEmpty()) {
+            ++request.unresolved;
+        }
+    }
+    m_pending.insert(requestId, request);
+    emit requestStarted(requestId);
+
+    if (request.unresolved == 0) {
+        fetchForecast(requestId);
+        return requestId;
+    }
+    for (int i = 0; i < cities.size(); ++i) {
+        if (request.locations.at(i).isEmpty()) {
+            resolveCity(requestId, i);
+        }
+    }
+    return requestId;
+}
+
+QNetworkReply *NativeWeatherBackend::get(const QUrl &url, int requestId)
+{
+    QNetworkRequest request(url);
+    request.setHeader(QNetworkRequest::UserAgentHeader, "mdCoder-weather/1.0");
+    request.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+
+    QNetworkReply *reply = m_network->get(request);
+    m_pending[requestId].replies.append(reply);
+    return reply;
+}
+
+void NativeWeatherBackend::resolveCity(int requestId, int index)
+{
+    const QString city = m_pending.value(requestId).cities.at(index);
+
+    QUrlQuery query;
+    query.addQueryItem("name", city);
+    query.addQueryItem("count", "1");
+    query.addQueryItem("language", "en");
+    query.addQueryItem("format", "json");
+    QUrl url = m_geocodingUrl;
+    url.setQuery(query);
+
+    QNetworkReply *reply = get(url, requestId);
+    connect(reply, &QNetworkReply::finished, this, [this, requestId, index, reply]() {
+        onGeocodeFinished(requestId, index, reply);
+    });
+}
+
+void NativeWeatherBackend::onGeocodeFinished(int requestId, int index, QNetworkReply *reply)
+{
+    reply->deleteLater();
+    auto it = m_pending.find(requestId);
+    if (it == m_pending.end()) {
+        return;
+    }
+    it->replies.removeOne(reply);
+
+    const QString city = it->cities.at(index);
+    const QJsonDocument document = QJsonDocument::fromJson(reply->readAll());
+    const QJsonArray matches = document.object().value("results").toArray();
+
+    if (reply->error() != QNetworkReply::NoError) {
+        it->results[index] = errorResult(city, replyError(reply, document));
+    } else if (matches.isEmpty()) {
+        it->results[index] = errorResult(city, QString("未找到城市 '%1'").arg(city));
+    } else {
+        const QJsonObject match = matches.first().toObject();
+        QJsonObject location;
+        location["name"] = match.value("name");
+        location["latitude"] = match.value("latitude");
+        location["longitude"] = match.value("longitude");
+        it->locations[index] = location;
+        storeLocation(city, location);
+    }
+
+    if (--it->unresolved == 0) {
+        fetchForecast(requestId);
+    }
+}
+
+void NativeWeatherBackend::fetchForecast(int requestId)
+{
+    const PendingRequest &request = m_pending[requestId];
+
+    // 所有已解析的城市合并成一次请求：经纬度以逗号分隔
+    QVector<int> indexes;
+    QStringList latitudes;
+    QStringList longitudes;
+    for (int i = 0; i < request.locations.size(); ++i) {
+        const QJsonObject &location = request.locations.at(i);
+        if (location.isEmpty()) {
+            continue;
+        }
+        indexes.append(i);
+        latitudes << QString::number(location.value("latitude").toDouble(), 'g', 10);
+        longitudes << QString::number(location.value("longitude").toDouble(), 'g', 10);
+    }
+
+    if (indexes.isEmpty()) {
+        // 没有任何城市解析成功，结果已全部是错误；仍经由事件循环返回
+        QMetaObject::invokeMethod(this, [this, requestId]() {
+            if (m_pending.contains(requestId)) {
+                finishRequest(requestId);
+            }
+        }, Qt::QueuedConnection);
+        return;
+    }
+
+    QUrlQuery query;
+    query.addQueryItem("latitude", latitudes.join(','));
+    query.addQueryItem("longitude", longitudes.join(','));
+    query.addQueryItem("current", kCurrentFields);
+    query.addQueryItem("timezone", "auto");
+    QUrl url = m_forecastUrl;
+    url.setQuery(query);
+
+    QNetworkReply *reply = get(url, requestId);
+    connect(reply, &QNetworkReply::finished, this, [this, requestId, indexes, reply]() {
+        onForecastFinished(requestId, indexes, reply);
+    });
+}
+
+void NativeWeatherBackend::onForecastFinished(int requestId, const QVector<int> &indexes, QNetworkReply *reply)
+{
+    reply->deleteLater();
+    auto it = m_pending.find(requestId);
+    if (it == m_pending.end()) {
+        return;
+    }
+    it->replies.removeOne(reply);
+
+    // 响应只有几百字节，完整到达后一次解析
+    const QJsonDocument document = QJsonDocument::fromJson(reply->readAll());
+
+    // 单个坐标时返回对象，多个坐标时返回数组
+    QJsonArray items;
+    if (document.isArray()) {
+        items = document.array();
+    } else if (document.isObject()) {
+        items.append(document.object());
+    }
+
+    QString error;
+    if (reply->error() != QNetworkReply::NoError) {
+        error = replyError(reply, document);
+    } else if (items.size() != indexes.size()) {
+        error = QString("预期 %1 个结果，实际收到 %2 个").arg(indexes.size()).arg(items.size());
+    }
+
+    for (int i = 0; i < indexes.size(); ++i) {
+        const int index = indexes.at(i);
+        if (!error.isEmpty()) {
+            it->results[index] = errorResult(it->cities.at(index), error);
+            continue;
+        }
+        const QJsonObject current = items.at(i).toObject().value("current").toObject();
+        it->results[index] = formatCurrent(current, it->locations.at(index).value("name").toString());
+    }
+
+    finishRequest(requestId);
+}
+
+void NativeWeatherBackend::finishRequest(int requestId)
+{
+    const PendingRequest request = m_pending.take(requestId);
+
+    if (!request.batch) {
+        emit weatherReady(requestId, request.results.value(0));
+        return;
+    }
+
+    QJsonArray results;
+    for (int i = 0; i < request.results.size(); ++i) {
+        QJsonObject result = request.results.at(i);
+        result["query"] = request.cities.at(i);
+        results.append(result);
+    }
+    QJsonObject response;
+    response["status"] = "success";
+    response["results"] = results;
+    emit weatherReady(requestId, response);
+}
+
+void NativeWeatherBackend::abortReplies(PendingRequest &request)
+{
+    const QList<QNetworkReply *> replies = request.replies;
+    request.replies.clear();
+    for (QNetworkReply *reply : replies) {
+        reply->disconnect(this);
+        reply->abort();
+        reply->deleteLater();
+    }
+}
+
+void NativeWeatherBackend::failLater(int requestId, const QString &error)
+{
+    QMetaObject::invokeMethod(this, [this, requestId, error]() {
+        emit requestFailed(requestId, error);
+    }, Qt::QueuedConnection);
+}
+
+QJsonObject NativeWeatherBackend::lookupLocation(const QString &city)
+{
+    if (!m_geocodeTableLoaded) {
+        m_geocodeTableLoaded = true;
+        QFile file(m_geocodeTablePath);
+        if (file.open(QFile::ReadOnly)) {
+            // 文件损坏时当作空表，查询会回退到地理编码接口
+            m_geocodeTable = QJsonDocument::fromJson(file.readAll()).object();
+        }
+    }
+    return m_geocodeTable.value(city.trimmed().toLower()).toObject();
+}
+
+void NativeWeatherBackend::storeLocation(const QString &city, const QJsonObject &location)
+{
+    m_geocodeTable[city.trimmed().toLower()] = location;
+
+    // 安装目录可能不可写，此时只保留在内存中
+    QSaveFile file(m_geocodeTablePath);
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(QJsonDocument(m_geocodeTable).toJson(QJsonDocument::Indented)) == -1
+        || !file.commit()) {
+        qWarning() << "Cannot write geocode table:" << file.errorString();
+    }
+}
+
+int NativeWeatherBackend::runFromCommandLine(const QStringList &arguments)
+{
+    QStringList cities = arguments.mid(2);
+    const bool batch = cities.removeAll("--batch") > 0;
+    if (cities.isEmpty()) {
+        std::fputs("Usage: WeatherApp --weather [--batch] <city>...\n", stderr);
+        return 2;
+    }
+
+    NativeWeatherBackend backend(defaultGeocodeTablePath());
+    QEventLoop loop;
+    bool allSucceeded = true;
+
+    connect(&backend, &WeatherBackend::weatherReady, &loop, [&](int, const QJsonObject &data) {
+        const QJsonArray results = batch ? data.value("results").toArray() : QJsonArray{data};
+        for (const QJsonValue &result : results) {
+            allSucceeded = allSucceeded && result.toObject().value("status").toString() == "success";
+            std::fputs(QJsonDocument(result.toObject()).toJson(QJsonDocument::Compact).append('\n').constData(), stdout);
+        }
+        std::fflush(stdout);
+        loop.quit();
+    });
+    connect(&backend, &WeatherBackend::requestFailed, &loop, [&](int, const QString &error) {
+        allSucceeded = false;
+        std::fputs(qUtf8Printable(error + QLatin1Char('\n')), stderr);
+        loop.quit();
+    });
+
+    // 依次请求，使后续请求复用第一个请求建立的连接
+    if (batch) {
+        backend.requestWeatherBatch(cities);
+        loop.exec();
+    } else {
+        for (const QString &city : cities) {
+            backend.requestWeather(city);
+            loop.exec();
+        }
+    }
+
+    return allSucceeded ? 0 : 1;
+}
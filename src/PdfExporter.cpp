@@ -0,0 +1,260 @@
+#include "PdfExporter.h"
+#include <QAbstractTextDocumentLayout>
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFileInfo>
+#include <QImage>
+#include <QMutexLocker>
+#include <QPageLayout>
+#include <QPageSize>
+#include <QPainter>
+#include <QPdfWriter>
+#include <QSaveFile>
+#include <QSet>
+#include <QTextBlock>
+
+namespace {
+
+// 300 DPI 足够打印清晰，绘制量只有默认 1200 DPI 的十六分之一
+constexpr int kResolution = 300;
+
+// 最多缓存几份导出结果
+constexpr int kMaxCacheEntries = 4;
+
+QPageLayout pageLayout()
+{
+    return QPageLayout(QPageSize(QPageSize::A4), QPageLayout::Portrait,
+                       QMarginsF(15, 15, 15, 15), QPageLayout::Millimeter);
+}
+
+// 文档中引用的图片名（去重，按出现顺序）
+QStringList imageNames(const QTextDocument *document)
+{
+    QStringList names;
+    QSet<QString> seen;
+    for (QTextBlock block = document->begin(); block.isValid(); block = block.next()) {
+        for (QTextBlock::iterator it = block.begin(); !it.atEnd(); ++it) {
+            const QTextCharFormat format = it.fragment().charFormat();
+            if (!format.isImageFormat()) {
+                continue;
+            }
+            const QString name = format.toImageFormat().name();
+            if (!name.isEmpty() && !seen.contains(name)) {
+                seen.insert(name);
+                names.append(name);
+            }
+        }
+    }
+    return names;
+}
+
+// 克隆只带 addResource 添加的资源：QTextBrowser 按搜索路径加载并缓存的图片
+// 不会复制，工作线程中的克隆也无法再通过 QTextBrowser 加载。这里在调用线程中
+// 取出文档引用的每张图片（已缓存的直接返回），作为资源加入克隆
+void copyImageResources(const QTextDocument *source, QTextDocument *target)
+{
+    const QStringList names = imageNames(source);
+    for (const QString &name : names) {
+        const QUrl url(name);
+        const QVariant image = source->resource(QTextDocument::ImageResource, url);
+        if (image.isValid()) {
+            target->addResource(QTextDocument::ImageResource, url, image);
+        }
+    }
+}
+
+// 图片内容也计入缓存键：同名图片被替换后不能复用旧的 PDF
+void hashImageResources(QTextDocument *document, QCryptographicHash *hash)
+{
+    const QStringList names = imageNames(document);
+    for (const QString &name : names) {
+        const QVariant image = document->resource(QTextDocument::ImageResource, QUrl(name));
+        if (image.typeId() == QMetaType::QByteArray) {
+            hash->addData(image.toByteArray());
+        } else if (image.typeId() == QMetaType::QImage) {
+            const QImage decoded = image.value<QImage>();
+            hash->addData(QByteArrayView(reinterpret_cast<const char *>(decoded.constBits()), decoded.sizeInBytes()));
+        }
+    }
+}
+
+} // namespace
+
+PdfExporter::PdfExporter(QObject *parent)
+    : QObject(parent)
+    , m_thread(nullptr)
+    , m_cancelled(false)
+{
+}
+
+PdfExporter::~PdfExporter()
+{
+    // 当前页绘制完成后工作线程即退出
+    cancel();
+    if (m_thread) {
+        m_thread->wait();
+    }
+}
+
+bool PdfExporter::start(const QTextDocument *document, const QString &filePath)
+{
+    if (isRunning()) {
+        return false;
+    }
+
+    // 克隆与复制图片资源是调用线程中唯一的工作：只复制文档结构，不做排版
+    QTextDocument *copy = document->clone();
+    copy->setBaseUrl(document->baseUrl());
+    copyImageResources(document, copy);
+    m_cancelled = false;
+
+    if (m_thread) {
+        m_thread->deleteLater();
+    }
+    m_thread = QThread::create([this, copy, filePath]() {
+        exportInThread(copy, filePath);
+        delete copy;
+    });
+    m_thread->setParent(this);
+    copy->moveToThread(m_thread);
+    m_thread->start(QThread::LowPriority);
+    return true;
+}
+
+void PdfExporter::cancel()
+{
+    m_cancelled = true;
+}
+
+bool PdfExporter::isRunning() const
+{
+    return m_thread && m_thread->isRunning();
+}
+
+void PdfExporter::exportInThread(QTextDocument *document, const QString &filePath)
+{
+    const QPageLayout layout = pageLayout();
+
+    // 缓存键：文档完整内容（含格式）+ 图片内容 + 页面参数
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(document->toHtml().toUtf8());
+    hashImageResources(document, &hash);
+    const QMarginsF margins = layout.margins();
+    hash.addData(QString("%1|%2|%3,%4,%5,%6|%7")
+                     .arg(layout.pageSize().key()).arg(layout.orientation())
+                     .arg(margins.left()).arg(margins.top()).arg(margins.right()).arg(margins.bottom())
+                     .arg(kResolution)
+                     .toUtf8());
+    const QByteArray key = hash.result();
+
+    QString error;
+    if (m_cancelled) {
+        emit finished(false, filePath, tr("Export cancelled"));
+        return;
+    }
+    CachedPdf cached;
+    if (lookupCache(key, &cached)) {
+        const bool ok = writeFile(filePath, cached.data, &error);
+        emit progress(cached.pageCount, cached.pageCount);
+        emit finished(ok, filePath, error);
+        return;
+    }
+
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+
+    QPdfWriter writer(&buffer);
+    writer.setResolution(kResolution);
+    writer.setPageLayout(layout);
+    writer.setCreator("mdCoder");
+    writer.setTitle(QFileInfo(filePath).completeBaseName());
+
+    // 以打印设备排版：px 长度按设备分辨率换算，每页高度为可绘制区域
+    QAbstractTextDocumentLayout *documentLayout = document->documentLayout();
+    documentLayout->setPaintDevice(&writer);
+    const QSizeF pageSize(writer.width(), writer.height());
+    document->setPageSize(pageSize);
+    // 排版是一次不可中断的调用：长文档可能耗时数秒，前后都检查取消请求
+    if (m_cancelled) {
+        emit finished(false, filePath, tr("Export cancelled"));
+        return;
+    }
+    const int pageCount = document->pageCount();
+    if (m_cancelled) {
+        emit finished(false, filePath, tr("Export cancelled"));
+        return;
+    }
+
+    QPainter painter(&writer);
+    if (!painter.isActive()) {
+        emit finished(false, filePath, tr("Cannot initialize PDF writer"));
+        return;
+    }
+
+    for (int page = 0; page < pageCount; ++page) {
+        if (m_cancelled) {
+            painter.end();
+            emit finished(false, filePath, tr("Export cancelled"));
+            return;
+        }
+        if (page > 0) {
+            writer.newPage();
+        }
+
+        const QRectF pageRect(0, page * pageSize.height(), pageSize.width(), pageSize.height());
+        painter.save();
+        painter.translate(0, -pageRect.top());
+        painter.setClipRect(pageRect);
+
+        QAbstractTextDocumentLayout::PaintContext context;
+        context.clip = pageRect;
+        documentLayout->draw(&painter, context);
+        painter.restore();
+
+        emit progress(page + 1, pageCount);
+    }
+    painter.end();
+    buffer.close();
+
+    storeCache({key, buffer.data(), pageCount});
+    const bool ok = writeFile(filePath, buffer.data(), &error);
+    emit finished(ok, filePath, error);
+}
+
+bool PdfExporter::lookupCache(const QByteArray &key, CachedPdf *entry)
+{
+    QMutexLocker locker(&m_cacheMutex);
+    for (int i = 0; i < m_cache.size(); ++i) {
+        if (m_cache.at(i).key == key) {
+            m_cache.move(i, 0);
+            *entry = m_cache.first();
+            return true;
+        }
+    }
+    return false;
+}
+
+void PdfExporter::storeCache(const CachedPdf &entry)
+{
+    QMutexLocker locker(&m_cacheMutex);
+    m_cache.prepend(entry);
+    while (m_cache.size() > kMaxCacheEntries) {
+        m_cache.removeLast();
+    }
+}
+
+bool PdfExporter::writeFile(const QString &filePath, const QByteArray &data, QString *error) const
+{
+    if (!QDir().mkpath(QFileInfo(filePath).absolutePath())) {
+        *error = tr("Cannot create output directory");
+        return false;
+    }
+
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) == -1 || !file.commit()) {
+        *error = file.errorString();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,77 @@
+#include "PreviewSnapshotCache.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+namespace {
+
+// 快照文件头，渲染格式变化时递增版本号即可让旧快照失效
+const QByteArray kMagic("MDPV2");
+
+// 最多保留的快照数量
+constexpr int kMaxSnapshots = 32;
+
+} // namespace
+
+PreviewSnapshotCache::PreviewSnapshotCache(const QString &directory)
+    : m_directory(directory)
+{
+}
+
+QByteArray PreviewSnapshotCache::keyFor(const QByteArray &fileData, const QString &theme)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(fileData);
+    hash.addData(theme.toUtf8());
+    return hash.result().toHex();
+}
+
+QString PreviewSnapshotCache::load(const QByteArray &key) const
+{
+    QFile file(pathFor(key));
+    if (!file.open(QFile::ReadOnly)) {
+        return QString();
+    }
+
+    const QByteArray data = file.readAll();
+    if (!data.startsWith(kMagic)) {
+        return QString();
+    }
+
+    // qUncompress 遇到损坏数据时返回空数组
+    return QString::fromUtf8(qUncompress(data.mid(kMagic.size())));
+}
+
+bool PreviewSnapshotCache::store(const QByteArray &key, const QString &html) const
+{
+    if (!QDir().mkpath(m_directory)) {
+        return false;
+    }
+
+    QSaveFile file(pathFor(key));
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(kMagic) == -1
+        || file.write(qCompress(html.toUtf8())) == -1
+        || !file.commit()) {
+        return false;
+    }
+
+    prune();
+    return true;
+}
+
+QString PreviewSnapshotCache::pathFor(const QByteArray &key) const
+{
+    return QDir(m_directory).filePath(QString::fromLatin1(key) + ".snap");
+}
+
+void PreviewSnapshotCache::prune() const
+{
+    const QFileInfoList snapshots = QDir(m_directory).entryInfoList(
+        {"*.snap"}, QDir::Files, QDir::Time);
+    for (int i = kMaxSnapshots; i < snapshots.size(); ++i) {
+        QFile::remove(snapshots.at(i).absoluteFilePath());
+    }
+}
@@ -0,0 +1,125 @@
+#include "PreviewTheme.h"
+#include "MarkdownRenderer.h"
+#include <QBrush>
+#include <QColor>
+#include <QHash>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTextFrame>
+#include <QTextTable>
+#include <QVector>
+
+namespace {
+
+using ColorMap = QHash<QRgb, QColor>;
+
+// 替换格式中取值为映射表颜色的画刷与颜色属性（前景、背景、边框……）
+bool remapColors(QTextFormat *format, const ColorMap &colors)
+{
+    bool changed = false;
+    const QMap<int, QVariant> properties = format->properties();
+    for (auto it = properties.constBegin(); it != properties.constEnd(); ++it) {
+        if (it->typeId() == QMetaType::QBrush) {
+            QBrush brush = it->value<QBrush>();
+            auto color = colors.constFind(brush.color().rgba());
+            if (brush.style() != Qt::NoBrush && color != colors.constEnd()) {
+                brush.setColor(*color);
+                format->setProperty(it.key(), brush);
+                changed = true;
+            }
+        } else if (it->typeId() == QMetaType::QColor) {
+            auto color = colors.constFind(it->value<QColor>().rgba());
+            if (color != colors.constEnd()) {
+                format->setProperty(it.key(), *color);
+                changed = true;
+            }
+        }
+    }
+    return changed;
+}
+
+// 框架格式（根框架即 <body>）与表格单元格格式不属于任何文本片段，单独处理
+int recolorFrame(QTextFrame *frame, const ColorMap &colors)
+{
+    int changed = 0;
+    QTextFrameFormat frameFormat = frame->frameFormat();
+    if (remapColors(&frameFormat, colors)) {
+        frame->setFrameFormat(frameFormat);
+        ++changed;
+    }
+
+    if (QTextTable *table = qobject_cast<QTextTable *>(frame)) {
+        for (int row = 0; row < table->rows(); ++row) {
+            for (int column = 0; column < table->columns(); ++column) {
+                QTextTableCell cell = table->cellAt(row, column);
+                if (cell.row() != row || cell.column() != column) {
+                    continue;  // 合并单元格只处理左上角一次
+                }
+                QTextCharFormat cellFormat = cell.format();
+                if (remapColors(&cellFormat, colors)) {
+                    cell.setFormat(cellFormat);
+                    ++changed;
+                }
+            }
+        }
+    }
+
+    const QList<QTextFrame *> children = frame->childFrames();
+    for (QTextFrame *child : children) {
+        changed += recolorFrame(child, colors);
+    }
+    return changed;
+}
+
+} // namespace
+
+int PreviewTheme::recolor(QTextDocument *document, bool wasDark, bool isDark)
+{
+    const QStringList &from = MarkdownRenderer::themeColors(wasDark);
+    const QStringList &to = MarkdownRenderer::themeColors(isDark);
+    ColorMap colors;
+    for (int i = 0; i < from.size(); ++i) {
+        colors.insert(QColor(from[i]).rgba(), QColor(to[i]));
+    }
+
+    // 先收集再修改：设置字符格式可能合并相邻片段，使遍历用的迭代器失效
+    struct FragmentChange
+    {
+        int position;
+        int length;
+        QTextCharFormat format;
+    };
+    QVector<FragmentChange> fragmentChanges;
+
+    int changed = 0;
+    QTextCursor cursor(document);
+    cursor.beginEditBlock();
+
+    for (QTextBlock block = document->begin(); block.isValid(); block = block.next()) {
+        QTextBlockFormat blockFormat = block.blockFormat();
+        if (remapColors(&blockFormat, colors)) {
+            cursor.setPosition(block.position());
+            cursor.setBlockFormat(blockFormat);
+            ++changed;
+        }
+        for (QTextBlock::iterator it = block.begin(); !it.atEnd(); ++it) {
+            const QTextFragment fragment = it.fragment();
+            QTextCharFormat format = fragment.charFormat();
+            if (remapColors(&format, colors)) {
+                fragmentChanges.append({fragment.position(), fragment.length(), format});
+            }
+        }
+    }
+
+    for (const FragmentChange &change : std::as_const(fragmentChanges)) {
+        cursor.setPosition(change.position);
+        cursor.setPosition(change.position + change.length, QTextCursor::KeepAnchor);
+        cursor.setCharFormat(change.format);
+    }
+    changed += fragmentChanges.size();
+    changed += recolorFrame(document->rootFrame(), colors);
+
+    cursor.endEditBlock();
+    return changed;
+}
@@ -1,114 +1,245 @@
 #include "SettingsManager.h"
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
 #include <QMutexLocker>
+#include <QSettings>
+#include <QTimer>
+#include <utility>
 
-SettingsManager::SettingsManager()
-{
-    // 在应用程序目录下创建设置文件
-    QString settingsPath = QDir(QCoreApplication::applicationDirPath()).filePath("config.ini");
-    m_settings = new QSettings(settingsPath, QSettings::IniFormat);
-}
+namespace {
 
-SettingsManager::~SettingsManager()
+// 同一时间窗内的多次写入合并为一次落盘
+constexpr int kWriteDelayMs = 500;
+
+template <std::size_t I>
+void assignTyped(Settings::Values* typed, const QVariant& value)
 {
-    if (m_settings) {
-        m_settings->sync();
-        delete m_settings;
+    using Spec = Settings::KeySpec<Settings::Key(I)>;
+    using Type = typename Spec::Type;
+
+    Type& slot = std::get<I>(*typed);
+    if (!value.isValid()) {
+        slot = Spec::defaultValue();
+        return;
     }
-}
 
-SettingsManager& SettingsManager::instance()
-{
-    static SettingsManager instance;
-    return instance;
+    // INI 中的数字以字符串读入，这里统一转换并校验
+    QVariant converted = value;
+    if (converted.convert(QMetaType::fromType<Type>()) && Spec::isValid(converted.value<Type>())) {
+        slot = converted.value<Type>();
+    } else {
+        qWarning() << "Invalid setting" << Spec::name << value << "- using default";
+        slot = Spec::defaultValue();
+    }
 }
 
-QVariant SettingsManager::getValue(const QString& key, const QVariant& defaultValue) const
+template <std::size_t... I>
+void assignTypedByName(Settings::Values* typed, const QString& key, const QVariant& value, std::index_sequence<I...>)
 {
-    QMutexLocker locker(&m_mutex);
-    return m_settings->value(key, defaultValue);
+    // 只在加载与写入时执行；读取通过 get<Key>() 直接访问元组
+    (void)((key == QLatin1String(Settings::kKeyNames[I]) && (assignTyped<I>(typed, value), true)) || ...);
 }
 
-void SettingsManager::setValue(const QString& key, const QVariant& value)
+template <std::size_t... I>
+void resetTyped(Settings::Values* typed, std::index_sequence<I...>)
 {
-    QMutexLocker locker(&m_mutex);
-    m_settings->setValue(key, value);
+    ((std::get<I>(*typed) = Settings::KeySpec<Settings::Key(I)>::defaultValue()), ...);
 }
 
-bool SettingsManager::contains(const QString& key) const
+} // namespace
+
+SettingsManager::SettingsManager()
+    : SettingsManager(QDir(QCoreApplication::applicationDirPath()).filePath("config.ini"))
 {
-    QMutexLocker locker(&m_mutex);
-    return m_settings->contains(key);
 }
 
-void SettingsManager::remove(const QString& key)
+SettingsManager::SettingsManager(const QString& filePath)
+    : m_filePath(filePath)
+    , m_version(0)
+    , m_writeTimer(new QTimer(this))
 {
-    QMutexLocker locker(&m_mutex);
-    m_settings->remove(key);
+    // 启动时把设置文件整体读入第一份快照
+    auto initial = std::make_shared<Snapshot>();
+    resetTyped(&initial->typed, std::make_index_sequence<Settings::kKeyCount>());
+
+    QSettings settings(m_filePath, QSettings::IniFormat);
+    const QStringList keys = settings.allKeys();
+    for (const QString& key : keys) {
+        const QVariant value = settings.value(key);
+        initial->values.insert(key, value);
+        updateTypedCache(initial.get(), key, value);
+    }
+    m_snapshot = std::move(initial);
+
+    m_writer.setMaxThreadCount(1);
+
+    m_writeTimer->setSingleShot(true);
+    m_writeTimer->setInterval(kWriteDelayMs);
+    connect(m_writeTimer, &QTimer::timeout, this, &SettingsManager::flushPendingWrites);
+
+    if (QCoreApplication* app = QCoreApplication::instance()) {
+        connect(app, &QCoreApplication::aboutToQuit, this, &SettingsManager::sync);
+    }
 }
 
-void SettingsManager::sync()
+SettingsManager::~SettingsManager()
 {
-    QMutexLocker locker(&m_mutex);
-    m_settings->sync();
+    sync();
 }
 
-// 便捷方法
-QString SettingsManager::getTheme() const
+SettingsManager& SettingsManager::instance()
 {
-    return getValue("theme", "dark").toString();
+    static SettingsManager instance;
+    return instance;
 }
 
-void SettingsManager::setTheme(const QString& theme)
+QVariant SettingsManager::getValue(const QString& key, const QVariant& defaultValue) const
 {
-    setValue("theme", theme);
+    return snapshot().values.value(key, defaultValue);
 }
 
-QString SettingsManager::getDefaultCity() const
+void SettingsManager::setValue(const QString& key, const QVariant& value)
 {
-    return getValue("defaultCity", "Beijing").toString();
+    {
+        QMutexLocker locker(&m_mutex);
+        // 写入方持有互斥量，m_snapshot 不会同时被替换
+        const Snapshot& current = *m_snapshot;
+        auto it = current.values.constFind(key);
+        if (it != current.values.constEnd() && *it == value) {
+            return;
+        }
+
+        Snapshot* next = new Snapshot(current);
+        next->values.insert(key, value);
+        updateTypedCache(next, key, value);
+        publish(next);
+        m_pendingWrites.insert(key, value);
+    }
+
+    // 写入定时器属于主线程；在主线程中调用时直接执行
+    QMetaObject::invokeMethod(this, &SettingsManager::scheduleWrite);
+    emit valueChanged(key, value);
 }
 
-void SettingsManager::setDefaultCity(const QString& city)
+bool SettingsManager::contains(const QString& key) const
 {
-    setValue("defaultCity", city);
+    return snapshot().values.contains(key);
 }
 
-QByteArray SettingsManager::getWindowGeometry() const
+void SettingsManager::remove(const QString& key)
 {
-    return getValue("geometry").toByteArray();
+    QStringList removed;
+    {
+        QMutexLocker locker(&m_mutex);
+        const QString prefix = key + '/';
+        Snapshot* next = new Snapshot(*m_snapshot);
+        for (auto it = next->values.begin(); it != next->values.end();) {
+            if (it.key() == key || it.key().startsWith(prefix)) {
+                removed << it.key();
+                updateTypedCache(next, it.key(), QVariant());
+                it = next->values.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (removed.isEmpty()) {
+            delete next;
+            return;
+        }
+        publish(next);
+
+        // QSettings::remove 同样会移除子键；尚未落盘的子键写入一并丢弃
+        for (auto it = m_pendingWrites.begin(); it != m_pendingWrites.end();) {
+            if (it.key().startsWith(prefix)) {
+                it = m_pendingWrites.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        m_pendingWrites.insert(key, QVariant());
+    }
+
+    QMetaObject::invokeMethod(this, &SettingsManager::scheduleWrite);
+    for (const QString& removedKey : removed) {
+        emit valueChanged(removedKey, QVariant());
+    }
 }
 
-void SettingsManager::setWindowGeometry(const QByteArray& geometry)
+void SettingsManager::sync()
 {
-    setValue("geometry", geometry);
+    m_writeTimer->stop();
+    flushPendingWrites();
+    m_writer.waitForDone();
 }
 
-QByteArray SettingsManager::getWindowState() const
+const SettingsManager::Snapshot& SettingsManager::snapshot() const
 {
-    return getValue("windowState").toByteArray();
+    // 每个线程持有一份快照引用：版本号未变时只有一次原子读取，不碰共享的引用计数；
+    // 旧快照在所有线程都换到新版本后释放。基准与测试可能另建实例，缓存同时记下所属实例
+    thread_local const SettingsManager* owner = nullptr;
+    thread_local std::shared_ptr<const Snapshot> local;
+    if (owner != this || local->version != m_version.load(std::memory_order_acquire)) {
+        local = std::atomic_load_explicit(&m_snapshot, std::memory_order_acquire);
+        owner = this;
+    }
+    return *local;
 }
 
-void SettingsManager::setWindowState(const QByteArray& state)
+void SettingsManager::publish(Snapshot* next)
 {
-    setValue("windowState", state);
+    // 先发布快照再递增版本号：读线程看到新版本号时一定能取到新快照
+    next->version = m_version.load(std::memory_order_relaxed) + 1;
+    std::atomic_store_explicit(&m_snapshot, std::shared_ptr<const Snapshot>(next), std::memory_order_release);
+    m_version.store(next->version, std::memory_order_release);
 }
 
-int SettingsManager::getPythonRestartAttempts() const
+void SettingsManager::updateTypedCache(Snapshot* snapshot, const QString& key, const QVariant& value)
 {
-    return getValue("pythonRestartAttempts", 3).toInt();
+    assignTypedByName(&snapshot->typed, key, value, std::make_index_sequence<Settings::kKeyCount>());
 }
 
-void SettingsManager::setPythonRestartAttempts(int attempts)
+void SettingsManager::warnInvalid(const char* name, const QVariant& value)
 {
-    setValue("pythonRestartAttempts", attempts);
+    qWarning() << "Rejected invalid setting" << name << value;
 }
 
-int SettingsManager::getPythonRestartDelay() const
+void SettingsManager::scheduleWrite()
 {
-    return getValue("pythonRestartDelay", 2000).toInt();
+    if (!m_writeTimer->isActive()) {
+        m_writeTimer->start();
+    }
 }
 
-void SettingsManager::setPythonRestartDelay(int delayMs)
+void SettingsManager::flushPendingWrites()
 {
-    setValue("pythonRestartDelay", delayMs);
+    QHash<QString, QVariant> writes;
+    {
+        QMutexLocker locker(&m_mutex);
+        writes.swap(m_pendingWrites);
+    }
+    if (writes.isEmpty()) {
+        return;
+    }
+
+    // 写入任务按提交顺序在后台线程执行，不阻塞界面
+    const QString filePath = m_filePath;
+    m_writer.start([filePath, writes]() {
+        QSettings settings(filePath, QSettings::IniFormat);
+        // 先删除后写入：删除之后又写入的子键不会被同一批的删除覆盖
+        for (auto it = writes.constBegin(); it != writes.constEnd(); ++it) {
+            if (!it.value().isValid()) {
+                settings.remove(it.key());
+            }
+        }
+        for (auto it = writes.constBegin(); it != writes.constEnd(); ++it) {
+            if (it.value().isValid()) {
+                settings.setValue(it.key(), it.value());
+            }
+        }
+        settings.sync();
+        if (settings.status() != QSettings::NoError) {
+            qWarning() << "Cannot write settings to" << filePath;
+        }
+    });
 }
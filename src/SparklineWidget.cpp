@@ -0,0 +1,78 @@
+#include "SparklineWidget.h"
+#include <QPainter>
+#include <QPainterPath>
+
+SparklineWidget::SparklineWidget(QWidget *parent)
+    : QWidget(parent)
+    , m_min(0)
+    , m_max(0)
+{
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
+}
+
+void SparklineWidget::setBuckets(const QVector<WeatherHistoryStore::Bucket> &buckets)
+{
+    m_buckets = buckets;
+
+    bool first = true;
+    for (const WeatherHistoryStore::Bucket &bucket : m_buckets) {
+        if (!bucket.valid) {
+            continue;
+        }
+        m_min = first ? bucket.min : qMin(m_min, bucket.min);
+        m_max = first ? bucket.max : qMax(m_max, bucket.max);
+        first = false;
+    }
+    setVisible(!first);
+    update();
+}
+
+QSize SparklineWidget::sizeHint() const
+{
+    return QSize(160, 36);
+}
+
+void SparklineWidget::paintEvent(QPaintEvent *)
+{
+    if (m_buckets.isEmpty()) {
+        return;
+    }
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    const QRectF area = QRectF(rect()).adjusted(1, 2, -1, -2);
+    const float range = qMax(m_max - m_min, 1.0f);  // 温度几乎不变时不放大噪声
+    const double step = area.width() / m_buckets.size();
+    auto yFor = [&](float value) {
+        return area.bottom() - (value - m_min) / range * area.height();
+    };
+
+    QColor color = palette().color(foregroundRole());
+    QColor band = color;
+    band.setAlphaF(0.3);
+
+    QPainterPath line;
+    bool penDown = false;
+    for (int i = 0; i < m_buckets.size(); ++i) {
+        const WeatherHistoryStore::Bucket &bucket = m_buckets.at(i);
+        if (!bucket.valid) {
+            penDown = false;
+            continue;
+        }
+
+        const double x = area.left() + (i + 0.5) * step;
+        painter.fillRect(QRectF(x - step / 2, yFor(bucket.max), step, qMax(1.0, yFor(bucket.min) - yFor(bucket.max))), band);
+
+        const QPointF mid(x, yFor((bucket.min + bucket.max) / 2));
+        if (penDown) {
+            line.lineTo(mid);
+        } else {
+            line.moveTo(mid);
+            penDown = true;
+        }
+    }
+
+    painter.setPen(QPen(color, 1.5));
+    painter.drawPath(line);
+}
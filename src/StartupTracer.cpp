@@ -0,0 +1,74 @@
+#include "StartupTracer.h"
+#include <QEvent>
+#include <QTimer>
+#include <QWidget>
+#include <cstdio>
+#include <cstring>
+
+StartupTracer &StartupTracer::instance()
+{
+    static StartupTracer tracer;
+    return tracer;
+}
+
+void StartupTracer::begin(int argc, char *argv[])
+{
+    StartupTracer &tracer = instance();
+    tracer.m_timer.start();
+    tracer.m_phases.reserve(16);
+
+    tracer.m_enabled = !qEnvironmentVariableIsEmpty("MDCODER_TRACE_STARTUP");
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--trace-startup") == 0) {
+            tracer.m_enabled = true;
+        }
+    }
+}
+
+void StartupTracer::mark(const char *phase)
+{
+    StartupTracer &tracer = instance();
+    if (!tracer.m_finished && tracer.m_timer.isValid()) {
+        tracer.m_phases.append({phase, tracer.m_timer.nsecsElapsed()});
+    }
+}
+
+void StartupTracer::watchFirstPaint(QWidget *widget)
+{
+    widget->installEventFilter(&instance());
+}
+
+bool StartupTracer::isEnabled()
+{
+    return instance().m_enabled;
+}
+
+bool StartupTracer::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() == QEvent::Paint && !m_finished) {
+        watched->removeEventFilter(this);
+        mark("first paint");
+
+        // 绘制事件处理完、事件循环第一次空闲时，编辑器才真正能响应按键
+        QTimer::singleShot(0, this, [this]() {
+            mark("first editable");
+            m_finished = true;
+            if (m_enabled) {
+                printReport();
+            }
+        });
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void StartupTracer::printReport() const
+{
+    std::fprintf(stderr, "[startup] %-24s %10s %10s\n", "phase", "at (ms)", "+ (ms)");
+    qint64 previous = 0;
+    for (const Phase &phase : m_phases) {
+        std::fprintf(stderr, "[startup] %-24s %10.1f %10.1f\n", phase.name,
+                     phase.elapsedNs / 1e6, (phase.elapsedNs - previous) / 1e6);
+        previous = phase.elapsedNs;
+    }
+    std::fflush(stderr);
+}
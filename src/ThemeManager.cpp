@@ -0,0 +1,210 @@
+#include "ThemeManager.h"
+#include "ThemeTokens.h"
+#include <QApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QRegularExpression>
+#include <QWidget>
+
+namespace {
+
+const char kBaseStyleSheetPath[] = ":/resources/styles/base.qss";
+const char kTemplatePath[] = ":/resources/styles/theme.qss";
+
+QString readStyleSheet(const char *path)
+{
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly)) {
+        qWarning() << "Could not load style sheet:" << path;
+        return QString();
+    }
+    return QString::fromUtf8(file.readAll());
+}
+
+} // namespace
+
+ThemeManager::ThemeManager()
+    : m_baseStyleSheet(readStyleSheet(kBaseStyleSheetPath))
+{
+    loadTemplate();
+}
+
+ThemeManager &ThemeManager::instance()
+{
+    static ThemeManager instance;
+    return instance;
+}
+
+const QStringList &ThemeManager::themeNames()
+{
+    static const QStringList names = {"dark", "light"};
+    return names;
+}
+
+const QString &ThemeManager::currentTheme() const
+{
+    return m_current;
+}
+
+bool ThemeManager::isDark() const
+{
+    return m_current != "light";
+}
+
+QColor ThemeManager::color(const QString &token) const
+{
+    auto it = m_themes.constFind(m_current);
+    if (it == m_themes.constEnd()) {
+        return QColor();
+    }
+    return QColor(it->tokens.value(token));
+}
+
+const QString &ThemeManager::baseStyleSheet() const
+{
+    return m_baseStyleSheet;
+}
+
+void ThemeManager::addStyleTarget(QWidget *widget)
+{
+    if (!m_template.contains(widget->objectName())) {
+        qWarning() << "Theme template has no section for" << widget->objectName();
+        return;
+    }
+    // 顺便丢弃已销毁的部件，列表只在注册时增长
+    m_targets.removeIf([](const QPointer<QWidget> &target) { return target.isNull(); });
+    m_targets.append(widget);
+    if (!m_current.isEmpty()) {
+        applyStyleSheet(widget);
+    }
+}
+
+double ThemeManager::apply(const QString &name)
+{
+    const QString validated = themeNames().contains(name) ? name : themeNames().first();
+    if (validated == m_current) {
+        return 0;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // 窗口级样式表不含颜色，调色板变化只触发重绘；只有注册的部件重新计算样式
+    const Theme &selected = theme(validated);
+    QApplication::setPalette(selected.palette);
+    m_current = validated;
+    for (const QPointer<QWidget> &target : std::as_const(m_targets)) {
+        if (target) {
+            applyStyleSheet(target);
+        }
+    }
+    emit themeChanged(validated);
+    return timer.nsecsElapsed() / 1e6;
+}
+
+const ThemeManager::Theme &ThemeManager::theme(const QString &name)
+{
+    auto it = m_themes.find(name);
+    if (it != m_themes.end()) {
+        return *it;
+    }
+
+    const bool dark = name == "dark";
+    Theme theme;
+    for (const ThemeTokens::Token &token : ThemeTokens::kTokens) {
+        theme.tokens.insert(QString::fromLatin1(token.name), QString::fromLatin1(dark ? token.dark : token.light));
+    }
+    theme.palette = buildPalette(theme.tokens);
+    for (auto it = m_template.constBegin(); it != m_template.constEnd(); ++it) {
+        theme.styleSheets.insert(it.key(), expandTemplate(name, it.value(), theme.tokens));
+    }
+    return *m_themes.insert(name, theme);
+}
+
+void ThemeManager::loadTemplate()
+{
+    const QString text = readStyleSheet(kTemplatePath);
+
+    // 按 "/* [对象名] */" 分节（第一节之前的说明注释丢弃），每节再切分为
+    // 文本片段与令牌片段，展开时只需顺序拼接
+    static const QRegularExpression sectionPattern(R"(^/\*\s*\[(\w+)\]\s*\*/$)",
+                                                   QRegularExpression::MultilineOption);
+    static const QRegularExpression tokenPattern("@([A-Za-z][A-Za-z0-9]*)");
+    QRegularExpressionMatchIterator sections = sectionPattern.globalMatch(text);
+    QRegularExpressionMatch section = sections.hasNext() ? sections.next() : QRegularExpressionMatch();
+    while (section.hasMatch()) {
+        const QRegularExpressionMatch next = sections.hasNext() ? sections.next() : QRegularExpressionMatch();
+        const int end = next.hasMatch() ? next.capturedStart() : text.size();
+        const QString body = text.mid(section.capturedEnd(), end - section.capturedEnd());
+
+        QVector<Segment> &segments = m_template[section.captured(1)];
+        int last = 0;
+        QRegularExpressionMatchIterator it = tokenPattern.globalMatch(body);
+        while (it.hasNext()) {
+            const QRegularExpressionMatch match = it.next();
+            segments.append({body.mid(last, match.capturedStart() - last), false});
+            segments.append({match.captured(1), true});
+            last = match.capturedEnd();
+        }
+        segments.append({body.mid(last), false});
+        section = next;
+    }
+}
+
+void ThemeManager::applyStyleSheet(QWidget *widget) const
+{
+    auto it = m_themes.constFind(m_current);
+    if (it != m_themes.constEnd()) {
+        widget->setStyleSheet(it->styleSheets.value(widget->objectName()));
+    }
+}
+
+QString ThemeManager::expandTemplate(const QString &name, const QVector<Segment> &segments,
+                                     const QHash<QString, QString> &tokens) const
+{
+    QString styleSheet;
+    for (const Segment &segment : segments) {
+        if (!segment.isToken) {
+            styleSheet += segment.text;
+            continue;
+        }
+        auto value = tokens.constFind(segment.text);
+        if (value == tokens.constEnd()) {
+            qWarning() << "Theme" << name << "has no token" << segment.text;
+            styleSheet += '@' + segment.text;
+        } else {
+            styleSheet += *value;
+        }
+    }
+    return styleSheet;
+}
+
+QPalette ThemeManager::buildPalette(const QHash<QString, QString> &tokens)
+{
+    auto color = [&tokens](const char *token) { return QColor(tokens.value(QString::fromLatin1(token))); };
+
+    QPalette palette;
+    palette.setColor(QPalette::Window, color("window"));
+    palette.setColor(QPalette::WindowText, color("text"));
+    palette.setColor(QPalette::Base, color("surface"));
+    palette.setColor(QPalette::AlternateBase, color("window"));
+    palette.setColor(QPalette::Text, color("text"));
+    palette.setColor(QPalette::PlaceholderText, color("textSecondary"));
+    palette.setColor(QPalette::Button, color("surfaceRaised"));
+    palette.setColor(QPalette::ButtonText, color("accent"));
+    palette.setColor(QPalette::Highlight, color("accent"));
+    palette.setColor(QPalette::HighlightedText, color("accentText"));
+    palette.setColor(QPalette::Link, color("accent"));
+    palette.setColor(QPalette::LinkVisited, color("accentSoft"));
+    palette.setColor(QPalette::ToolTipBase, color("surface"));
+    palette.setColor(QPalette::ToolTipText, color("text"));
+    palette.setColor(QPalette::Mid, color("border"));
+    palette.setColor(QPalette::Dark, color("pressed"));
+    palette.setColor(QPalette::Light, color("hover"));
+    palette.setColor(QPalette::Disabled, QPalette::Text, color("disabledText"));
+    palette.setColor(QPalette::Disabled, QPalette::WindowText, color("disabledText"));
+    palette.setColor(QPalette::Disabled, QPalette::ButtonText, color("disabledText"));
+    palette.setColor(QPalette::Disabled, QPalette::Button, color("disabledBackground"));
+    return palette;
+}
@@ -0,0 +1,102 @@
+#include "WeatherCache.h"
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QTimer>
+
+WeatherCache::WeatherCache(const QString &filePath, int ttlSeconds, QObject *parent)
+    : QObject(parent)
+    , m_filePath(filePath)
+    , m_ttlSeconds(ttlSeconds)
+    , m_loaded(false)
+    , m_saveTimer(new QTimer(this))
+{
+    // 连续多次写入合并为一次磁盘写入
+    m_saveTimer->setSingleShot(true);
+    m_saveTimer->setInterval(2000);
+    connect(m_saveTimer, &QTimer::timeout, this, &WeatherCache::flush);
+}
+
+WeatherCache::~WeatherCache()
+{
+    if (m_saveTimer->isActive()) {
+        flush();
+    }
+}
+
+bool WeatherCache::lookup(const QString &city, Entry *entry)
+{
+    ensureLoaded();
+
+    auto it = m_entries.constFind(city);
+    if (it == m_entries.constEnd()) {
+        return false;
+    }
+    *entry = it.value();
+    return true;
+}
+
+bool WeatherCache::isFresh(const Entry &entry) const
+{
+    return entry.fetchedAt.secsTo(QDateTime::currentDateTimeUtc()) < m_ttlSeconds;
+}
+
+void WeatherCache::store(const QString &city, const QJsonObject &data)
+{
+    ensureLoaded();
+
+    m_entries.insert(city, {data, QDateTime::currentDateTimeUtc()});
+    m_saveTimer->start();
+}
+
+void WeatherCache::flush()
+{
+    m_saveTimer->stop();
+
+    QJsonObject root;
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        QJsonObject item;
+        item["fetchedAt"] = it->fetchedAt.toString(Qt::ISODate);
+        item["data"] = it->data;
+        root[it.key()] = item;
+    }
+
+    if (!QDir().mkpath(QFileInfo(m_filePath).absolutePath())) {
+        qWarning() << "Cannot create weather cache directory for" << m_filePath;
+        return;
+    }
+
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) == -1
+        || !file.commit()) {
+        qWarning() << "Cannot write weather cache:" << file.errorString();
+    }
+}
+
+void WeatherCache::ensureLoaded()
+{
+    if (m_loaded) {
+        return;
+    }
+    m_loaded = true;
+
+    QFile file(m_filePath);
+    if (!file.open(QFile::ReadOnly)) {
+        return;
+    }
+
+    // 文件损坏时当作空缓存，下次写入会覆盖
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    for (auto it = root.constBegin(); it != root.constEnd(); ++it) {
+        const QJsonObject item = it.value().toObject();
+        const QDateTime fetchedAt = QDateTime::fromString(item.value("fetchedAt").toString(), Qt::ISODate);
+        const QJsonObject data = item.value("data").toObject();
+        if (fetchedAt.isValid() && !data.isEmpty()) {
+            m_entries.insert(it.key(), {data, fetchedAt});
+        }
+    }
+}
@@ -0,0 +1,127 @@
+#include "WeatherDashboardModel.h"
+#include <QBrush>
+#include <QColor>
+
+WeatherDashboardModel::WeatherDashboardModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+void WeatherDashboardModel::setCities(const QStringList &cities)
+{
+    beginResetModel();
+    m_rows.clear();
+    m_rows.reserve(cities.size());
+    for (const QString &city : cities) {
+        m_rows.append({city, QJsonObject(), QDateTime()});
+    }
+    endResetModel();
+}
+
+QStringList WeatherDashboardModel::cities() const
+{
+    QStringList result;
+    result.reserve(m_rows.size());
+    for (const Row &row : m_rows) {
+        result.append(row.city);
+    }
+    return result;
+}
+
+void WeatherDashboardModel::updateCity(const QString &city, const QJsonObject &data, const QDateTime &fetchedAt)
+{
+    for (int i = 0; i < m_rows.size(); ++i) {
+        Row &row = m_rows[i];
+        if (row.city != city) {
+            continue;
+        }
+        if (row.data == data && row.fetchedAt == fetchedAt) {
+            return;
+        }
+        row.data = data;
+        row.fetchedAt = fetchedAt;
+        emit dataChanged(index(i, 0), index(i, ColumnCount - 1));
+        return;
+    }
+}
+
+int WeatherDashboardModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+int WeatherDashboardModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant WeatherDashboardModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+
+    const Row &row = m_rows.at(index.row());
+    const bool hasData = !row.data.isEmpty();
+    const bool isError = row.data.value("status").toString() == "error";
+
+    if (role == Qt::DisplayRole) {
+        if (index.column() == CityColumn) {
+            return row.city;
+        }
+        if (!hasData) {
+            return index.column() == ConditionColumn ? QVariant("Loading...") : QVariant("--");
+        }
+        if (isError) {
+            return index.column() == ConditionColumn ? row.data.value("error_message").toString() : QVariant("--");
+        }
+
+        switch (index.column()) {
+        case TemperatureColumn:
+            return QString::number(row.data.value("temperature").toDouble(), 'f', 1) + "°C";
+        case FeelsLikeColumn:
+            return QString::number(row.data.value("feels_like").toDouble(), 'f', 1) + "°C";
+        case ConditionColumn:
+            return row.data.value("description").toString();
+        case HumidityColumn:
+            return QString::number(row.data.value("humidity").toInt()) + "%";
+        case WindColumn:
+            return QString::number(row.data.value("wind_speed").toDouble(), 'f', 1) + " km/h";
+        case PressureColumn:
+            return QString::number(row.data.value("pressure").toDouble(), 'f', 1) + " mb";
+        case UpdatedColumn:
+            return row.fetchedAt.isValid() ? row.fetchedAt.toLocalTime().toString("HH:mm") : QString("--");
+        default:
+            break;
+        }
+    } else if (role == Qt::TextAlignmentRole) {
+        if (index.column() != CityColumn && index.column() != ConditionColumn) {
+            return int(Qt::AlignRight | Qt::AlignVCenter);
+        }
+    } else if (role == Qt::ForegroundRole) {
+        if (isError && index.column() == ConditionColumn) {
+            return QBrush(QColor("#ff4757"));
+        }
+    }
+
+    return QVariant();
+}
+
+QVariant WeatherDashboardModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch (section) {
+    case CityColumn:        return "City";
+    case TemperatureColumn: return "Temp";
+    case FeelsLikeColumn:   return "Feels Like";
+    case ConditionColumn:   return "Condition";
+    case HumidityColumn:    return "Humidity";
+    case WindColumn:        return "Wind";
+    case PressureColumn:    return "Pressure";
+    case UpdatedColumn:     return "Updated";
+    default:                return QVariant();
+    }
+}
@@ -0,0 +1,140 @@
+#include "WeatherFormatter.h"
+#include <QDebug>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+QString WeatherFormatter::formatWeatherHTML(const QString &output, const QString &city, bool isDark)
+{
+    qDebug() << "Parsing JSON weather data for:" << city;
+    
+    QString accentColor = isDark ? "#00d4ff" : "#0071e3";
+    QString secondaryTextColor = isDark ? "#aaaaaa" : "#86868b";
+    QString textColor = isDark ? "#cccccc" : "#1d1d1f";
+    QString conditionColor = isDark ? "#5dade2" : "#0071e3";
+    
+    // Parse JSON output from Python
+    QJsonDocument doc = QJsonDocument::fromJson(output.toUtf8());
+    if (doc.isNull() || !doc.isObject()) {
+        qWarning() << "Failed to parse JSON output";
+        return QString(
+            "<div style='font-family: \"SF Pro Display\", \"Segoe UI\", \"Microsoft YaHei\", sans-serif;'>"
+            "<div style='font-size: 24px; font-weight: bold; color: #ff4757; margin-bottom: 20px;'>"
+            "❌ Parse Error"
+            "</div>"
+            "<pre style='font-size: 14px; color: %1; white-space: pre-wrap;'>%2</pre>"
+            "</div>"
+        ).arg(secondaryTextColor).arg(output.toHtmlEscaped());
+    }
+    
+    QJsonObject obj = doc.object();
+    
+    // Check for error status
+    QString status = obj["status"].toString();
+    if (status == "error") {
+        QString errorMsg = obj["error_message"].toString();
+        return QString(
+            "<div style='font-family: \"SF Pro Display\", \"Segoe UI\", \"Microsoft YaHei\", sans-serif;'>"
+            "<div style='font-size: 28px; font-weight: bold; color: #ff4757; margin-bottom: 15px;'>"
+            "❌ Error"
+            "</div>"
+            "<div style='font-size: 16px; color: %1;'>"
+            "%2"
+            "</div>"
+            "</div>"
+        ).arg(secondaryTextColor).arg(errorMsg.toHtmlEscaped());
+    }
+    
+    // Extract weather data from JSON
+    QString cityName = obj["city"].toString();
+    double temperature = obj["temperature"].toDouble();
+    double feelsLike = obj["feels_like"].toDouble();
+    int humidity = obj["humidity"].toInt();
+    QString description = obj["description"].toString();
+    double windSpeed = obj["wind_speed"].toDouble();
+    double pressure = obj["pressure"].toDouble();
+    
+    // Build HTML with styled formatting
+    QString html = QString(
+        "<div style='font-family: \"SF Pro Display\", \"Segoe UI\", \"Microsoft YaHei\", sans-serif;'>"
+        
+        // City name
+        "<div style='font-size: 36px; font-weight: bold; color: %1; margin-bottom: 25px;'>"
+        "📍 %2"
+        "</div>"
+        
+        // Temperature
+        "<div style='font-size: 64px; font-weight: bold; color: %1; margin-bottom: 15px;'>"
+        "%3°C"
+        "</div>"
+        
+        // Conditions
+        "<div style='font-size: 28px; font-weight: 600; color: %4; margin-bottom: 25px;'>"
+        "%5"
+        "</div>"
+        
+        // Feels like
+        "<div style='font-size: 20px; color: %6; margin-bottom: 20px;'>"
+        "🌡️ Feels Like: <span style='font-weight: bold; color: #ffa502;'>%7°C</span>"
+        "</div>"
+        
+        // Details section
+        "<div style='font-size: 18px; color: %8; line-height: 2.2;'>"
+        "<div>💧 Humidity: <span style='font-weight: 600; color: #48dbfb;'>%9%</span></div>"
+        "<div>💨 Wind Speed: <span style='font-weight: 600; color: #1dd1a1;'>%10 km/h</span></div>"
+        "<div>🔽 Pressure: <span style='font-weight: 600; color: #ee5a6f;'>%11 mb</span></div>"
+        "</div>"
+        
+        "</div>"
+    ).arg(accentColor)
+     .arg(cityName)
+     .arg(temperature, 0, 'f', 1)
+     .arg(conditionColor)
+     .arg(description)
+     .arg(secondaryTextColor)
+     .arg(feelsLike, 0, 'f', 1)
+     .arg(textColor)
+     .arg(humidity)
+     .arg(windSpeed, 0, 'f', 1)
+     .arg(pressure, 0, 'f', 1);
+    
+    return html;
+}
+
+QString WeatherFormatter::skeletonHTML(const QString &city, bool isDark)
+{
+    QString accentColor = isDark ? "#00d4ff" : "#0071e3";
+    QString secondaryTextColor = isDark ? "#888888" : "#86868b";
+    QString placeholderColor = isDark ? "#666666" : "#aaaaaa";
+
+    // Skeleton screen with loading animation
+    QString html = QString(
+        "<div style='font-family: \"SF Pro Display\", \"Segoe UI\", \"Microsoft YaHei\", sans-serif;'>"
+        
+        // City name
+        "<div style='font-size: 36px; font-weight: bold; color: %1; margin-bottom: 25px;'>"
+        "📍 %2"
+        "</div>"
+        
+        // Temperature placeholder
+        "<div style='font-size: 56px; font-weight: bold; color: %3; margin-bottom: 15px;'>"
+        "⏳ Loading..."
+        "</div>"
+        
+        // Conditions placeholder
+        "<div style='font-size: 26px; font-weight: 600; color: %4; margin-bottom: 25px;'>"
+        "Fetching weather data..."
+        "</div>"
+        
+        // Details placeholders
+        "<div style='font-size: 18px; color: %3; line-height: 2.2;'>"
+        "<div>🌡️ Feels Like: <span style='color: %4;'>--°C</span></div>"
+        "<div>💧 Humidity: <span style='color: %4;'>--%</span></div>"
+        "<div>💨 Wind Speed: <span style='color: %4;'>-- km/h</span></div>"
+        "<div>🔽 Pressure: <span style='color: %4;'>-- mb</span></div>"
+        "</div>"
+        
+        "</div>"
+    ).arg(accentColor).arg(city).arg(placeholderColor).arg(secondaryTextColor);
+    
+    return html;
+}
@@ -0,0 +1,199 @@
+#include "WeatherHistoryStore.h"
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QUrl>
+#include <QtEndian>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+const char kMagic[4] = {'W', 'X', 'H', '1'};
+constexpr qint64 kHeaderSize = 16;
+constexpr qint64 kRecordSize = 4;
+constexpr quint16 kMaxDelta = 0xFFFF;
+constexpr qint16 kNoValue = -32768;  // 间隔超过 kMaxDelta 分钟时的占位记录
+
+void appendRecord(QByteArray *out, quint16 deltaMinutes, qint16 tenths)
+{
+    uchar record[kRecordSize];
+    qToLittleEndian(deltaMinutes, record);
+    qToLittleEndian(tenths, record + 2);
+    out->append(reinterpret_cast<const char *>(record), kRecordSize);
+}
+
+bool writeHeader(QFile *file, quint32 count, qint64 lastMinute)
+{
+    uchar header[kHeaderSize];
+    std::memcpy(header, kMagic, sizeof(kMagic));
+    qToLittleEndian(count, header + 4);
+    qToLittleEndian(lastMinute, header + 8);
+    return file->seek(0) && file->write(reinterpret_cast<const char *>(header), kHeaderSize) == kHeaderSize;
+}
+
+} // namespace
+
+WeatherHistoryStore::WeatherHistoryStore(const QString &directory)
+    : m_directory(directory)
+{
+}
+
+WeatherHistoryStore::~WeatherHistoryStore()
+{
+    for (Series *series : std::as_const(m_series)) {
+        if (series->map) {
+            series->file->unmap(series->map);
+        }
+        delete series->file;
+        delete series;
+    }
+}
+
+bool WeatherHistoryStore::append(const QString &city, const QDateTime &time, double temperature)
+{
+    Series *s = series(city);
+    if (!s) {
+        return false;
+    }
+
+    const qint64 minute = time.toSecsSinceEpoch() / 60;
+    if (s->count > 0 && minute <= s->lastMinute) {
+        return false;
+    }
+
+    // 追加会改变文件大小，先解除映射，下次查询时重新映射
+    if (s->map) {
+        s->file->unmap(s->map);
+        s->map = nullptr;
+    }
+
+    const qint16 tenths = qint16(qBound(-32767, qRound(temperature * 10.0), 32767));
+    QByteArray records;
+    if (s->count == 0) {
+        appendRecord(&records, 0, tenths);
+    } else {
+        qint64 delta = minute - s->lastMinute;
+        while (delta > kMaxDelta) {
+            appendRecord(&records, kMaxDelta, kNoValue);
+            delta -= kMaxDelta;
+        }
+        appendRecord(&records, quint16(delta), tenths);
+    }
+
+    // 先写记录再更新文件头：中途失败时文件头仍指向完整的记录
+    const quint32 newCount = s->count + quint32(records.size() / kRecordSize);
+    if (!s->file->seek(kHeaderSize + qint64(s->count) * kRecordSize)
+        || s->file->write(records) != records.size()
+        || !writeHeader(s->file, newCount, minute)
+        || !s->file->flush()) {
+        qWarning() << "Cannot append weather history:" << s->file->errorString();
+        return false;
+    }
+
+    s->count = newCount;
+    s->lastMinute = minute;
+    return true;
+}
+
+QVector<WeatherHistoryStore::Bucket> WeatherHistoryStore::downsample(const QString &city, const QDateTime &from,
+                                                                     const QDateTime &to, int bucketCount)
+{
+    QVector<Bucket> buckets(qMax(bucketCount, 0));
+
+    const qint64 fromMinute = from.toSecsSinceEpoch() / 60;
+    const qint64 toMinute = to.toSecsSinceEpoch() / 60;
+    const qint64 span = toMinute - fromMinute;
+    if (bucketCount <= 0 || span <= 0) {
+        return buckets;
+    }
+
+    Series *s = series(city);
+    if (!s || s->count == 0 || (!s->map && !mapSeries(s))) {
+        return buckets;
+    }
+
+    // 从最后一条记录向前还原时间戳，早于窗口时停止
+    const uchar *records = s->map + kHeaderSize;
+    qint64 minute = s->lastMinute;
+    for (qint64 i = qint64(s->count) - 1; i >= 0 && minute >= fromMinute; --i) {
+        const uchar *record = records + i * kRecordSize;
+        const qint16 tenths = qFromLittleEndian<qint16>(record + 2);
+
+        if (minute < toMinute && tenths != kNoValue) {
+            Bucket &bucket = buckets[int((minute - fromMinute) * bucketCount / span)];
+            const float value = tenths / 10.0f;
+            if (!bucket.valid) {
+                bucket.min = bucket.max = value;
+                bucket.valid = true;
+            } else {
+                bucket.min = qMin(bucket.min, value);
+                bucket.max = qMax(bucket.max, value);
+            }
+        }
+        minute -= qFromLittleEndian<quint16>(record);
+    }
+    return buckets;
+}
+
+WeatherHistoryStore::Series *WeatherHistoryStore::series(const QString &city)
+{
+    const QString key = city.trimmed().toLower();
+    auto it = m_series.constFind(key);
+    if (it != m_series.constEnd()) {
+        return it.value();
+    }
+
+    if (!QDir().mkpath(m_directory)) {
+        qWarning() << "Cannot create weather history directory" << m_directory;
+        return nullptr;
+    }
+
+    QFile *file = new QFile(filePath(key));
+    if (!file->open(QIODevice::ReadWrite)) {
+        qWarning() << "Cannot open weather history:" << file->errorString();
+        delete file;
+        return nullptr;
+    }
+
+    Series *s = new Series;
+    s->file = file;
+
+    uchar header[kHeaderSize];
+    const bool hasHeader = file->read(reinterpret_cast<char *>(header), kHeaderSize) == kHeaderSize
+                           && std::memcmp(header, kMagic, sizeof(kMagic)) == 0;
+    const quint32 count = hasHeader ? qFromLittleEndian<quint32>(header + 4) : 0;
+    const qint64 expectedSize = kHeaderSize + qint64(count) * kRecordSize;
+
+    if (hasHeader && file->size() >= expectedSize) {
+        // 记录写入后、文件头更新前中断时，多出的半条记录被截掉
+        s->count = count;
+        s->lastMinute = qFromLittleEndian<qint64>(header + 8);
+        if (file->size() != expectedSize) {
+            file->resize(expectedSize);
+        }
+    } else {
+        // 新文件、无法识别的内容或被截断的文件：重新开始
+        file->resize(0);
+        writeHeader(file, 0, 0);
+    }
+
+    m_series.insert(key, s);
+    return s;
+}
+
+bool WeatherHistoryStore::mapSeries(Series *series)
+{
+    series->map = series->file->map(0, kHeaderSize + qint64(series->count) * kRecordSize, QFileDevice::MapPrivateOption);
+    if (!series->map) {
+        qWarning() << "Cannot map weather history:" << series->file->errorString();
+        return false;
+    }
+    return true;
+}
+
+QString WeatherHistoryStore::filePath(const QString &city) const
+{
+    // 百分号编码保证任意城市名（包括中文）都对应唯一且合法的文件名
+    return QDir(m_directory).filePath(QString::fromLatin1(QUrl::toPercentEncoding(city)) + ".wxh");
+}
@@ -0,0 +1,114 @@
+#include "WeatherRefreshScheduler.h"
+#include <QDebug>
+#include <QTimeZone>
+#include <QTimer>
+#include <cmath>
+
+namespace {
+
+// 一轮内任一城市的温度变化达到该值（或天气状况改变）时加快刷新
+constexpr double kFastChange = 2.0;
+// 所有城市的变化都低于该值时放慢刷新
+constexpr double kSlowChange = 0.5;
+
+} // namespace
+
+WeatherRefreshScheduler::WeatherRefreshScheduler(const Policy &policy, QObject *parent)
+    : QObject(parent)
+    , m_policy(policy)
+    , m_timer(new QTimer(this))
+    , m_active(true)
+    , m_intervalSecs(qBound(policy.minIntervalSecs, policy.initialIntervalSecs, policy.maxIntervalSecs))
+    , m_roundMaxChange(0)
+    , m_roundConditionChanged(false)
+    , m_roundHasReadings(false)
+{
+    // 秒级精度即可，允许系统把唤醒与其他定时器合并
+    m_timer->setSingleShot(true);
+    m_timer->setTimerType(Qt::VeryCoarseTimer);
+    connect(m_timer, &QTimer::timeout, this, &WeatherRefreshScheduler::onTimeout);
+
+    scheduleNext();
+}
+
+void WeatherRefreshScheduler::setActive(bool active)
+{
+    if (active == m_active) {
+        return;
+    }
+    m_active = active;
+
+    if (!m_active) {
+        m_timer->stop();
+        return;
+    }
+
+    // 暂停期间已经到期：立即刷新
+    if (QDateTime::currentDateTimeUtc() >= m_nextDue) {
+        onTimeout();
+    } else {
+        startTimer();
+    }
+}
+
+void WeatherRefreshScheduler::recordReading(const QString &city, const QJsonObject &data)
+{
+    const Reading reading{data["temperature"].toDouble(), data["description"].toString()};
+
+    auto it = m_lastReadings.find(city);
+    if (it != m_lastReadings.end()) {
+        m_roundMaxChange = qMax(m_roundMaxChange, std::abs(reading.temperature - it->temperature));
+        m_roundConditionChanged = m_roundConditionChanged || reading.description != it->description;
+        m_roundHasReadings = true;
+        *it = reading;
+    } else {
+        m_lastReadings.insert(city, reading);
+    }
+}
+
+void WeatherRefreshScheduler::refreshFinished()
+{
+    // 没有可比较的读数（首次获取或失败）时保持当前间隔
+    if (m_roundHasReadings) {
+        if (m_roundConditionChanged || m_roundMaxChange >= kFastChange) {
+            m_intervalSecs = qMax(m_policy.minIntervalSecs, m_intervalSecs / 2);
+        } else if (m_roundMaxChange < kSlowChange) {
+            m_intervalSecs = qMin(m_policy.maxIntervalSecs, m_intervalSecs * 3 / 2);
+        }
+        qDebug() << "Weather refresh: max change" << m_roundMaxChange << "°C, next in" << m_intervalSecs << "s";
+    }
+
+    m_roundMaxChange = 0;
+    m_roundConditionChanged = false;
+    m_roundHasReadings = false;
+    scheduleNext();
+}
+
+int WeatherRefreshScheduler::intervalSeconds() const
+{
+    return m_intervalSecs;
+}
+
+void WeatherRefreshScheduler::onTimeout()
+{
+    // 在 refreshFinished() 之前不会再次到期
+    m_nextDue = QDateTime::currentDateTimeUtc().addSecs(m_intervalSecs);
+    emit refreshDue();
+}
+
+void WeatherRefreshScheduler::scheduleNext()
+{
+    // 对齐到下一个整分钟：同一分钟内到期的周期性工作在一次唤醒中完成
+    const qint64 dueSecs = QDateTime::currentSecsSinceEpoch() + m_intervalSecs;
+    m_nextDue = QDateTime::fromSecsSinceEpoch((dueSecs + 59) / 60 * 60, QTimeZone::UTC);
+
+    if (m_active) {
+        startTimer();
+    }
+}
+
+void WeatherRefreshScheduler::startTimer()
+{
+    const qint64 remainingMs = QDateTime::currentDateTimeUtc().msecsTo(m_nextDue);
+    m_timer->start(int(qMax<qint64>(0, remainingMs)));
+}
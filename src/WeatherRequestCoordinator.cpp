@@ -0,0 +1,116 @@
+#include "WeatherRequestCoordinator.h"
+#include "WeatherBackend.h"
+#include <QTimer>
+
+namespace {
+
+// 连续切换城市时，停下来这么久之后才真正发出请求
+constexpr int kDebounceMs = 300;
+
+} // namespace
+
+WeatherRequestCoordinator::WeatherRequestCoordinator(WeatherBackend *backend, QObject *parent)
+    : QObject(parent)
+    , m_backend(backend)
+    , m_debounceTimer(new QTimer(this))
+    , m_inFlightId(0)
+{
+    m_debounceTimer->setSingleShot(true);
+    m_debounceTimer->setInterval(kDebounceMs);
+    connect(m_debounceTimer, &QTimer::timeout, this, &WeatherRequestCoordinator::sendPending);
+
+    connect(m_backend, &WeatherBackend::weatherReady, this, &WeatherRequestCoordinator::onBackendReady);
+    connect(m_backend, &WeatherBackend::requestFailed, this, &WeatherRequestCoordinator::onBackendFailed);
+}
+
+void WeatherRequestCoordinator::request(const QString &city, bool immediate)
+{
+    m_wantedCity = city;
+
+    // 相同城市已在途：合并到该请求，之前排队的其他城市作废
+    if (m_inFlightId != 0 && city == m_inFlightCity) {
+        m_debounceTimer->stop();
+        return;
+    }
+
+    if (immediate) {
+        m_debounceTimer->stop();
+        sendPending();
+    } else {
+        m_debounceTimer->start();
+    }
+}
+
+void WeatherRequestCoordinator::cancel()
+{
+    m_debounceTimer->stop();
+    m_wantedCity.clear();
+    abandonInFlight();
+}
+
+bool WeatherRequestCoordinator::isBusy() const
+{
+    return m_debounceTimer->isActive() || m_inFlightId != 0;
+}
+
+QString WeatherRequestCoordinator::currentCity() const
+{
+    return m_wantedCity;
+}
+
+void WeatherRequestCoordinator::sendPending()
+{
+    if (m_wantedCity.isEmpty()) {
+        return;
+    }
+
+    // 被取代的请求不再等待；后端保持运行
+    abandonInFlight();
+
+    m_inFlightCity = m_wantedCity;
+    m_inFlightId = m_backend->requestWeather(m_inFlightCity);
+    emit requestStarted(m_inFlightCity);
+}
+
+void WeatherRequestCoordinator::onBackendReady(int requestId, const QJsonObject &data)
+{
+    if (requestId != m_inFlightId) {
+        return;
+    }
+
+    const QString city = m_inFlightCity;
+    m_inFlightId = 0;
+    m_inFlightCity.clear();
+
+    // 等待期间又请求了别的城市：这个响应已经过时
+    if (city != m_wantedCity) {
+        return;
+    }
+    emit weatherReady(city, data);
+}
+
+void WeatherRequestCoordinator::onBackendFailed(int requestId, const QString &error)
+{
+    if (requestId != m_inFlightId) {
+        return;
+    }
+
+    const QString city = m_inFlightCity;
+    m_inFlightId = 0;
+    m_inFlightCity.clear();
+
+    if (city != m_wantedCity) {
+        return;
+    }
+    emit requestFailed(city, error);
+}
+
+void WeatherRequestCoordinator::abandonInFlight()
+{
+    if (m_inFlightId == 0) {
+        return;
+    }
+    m_backend->cancel(m_inFlightId);
+    m_inFlightId = 0;
+    m_inFlightCity.clear();
+}
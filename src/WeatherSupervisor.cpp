@@ -0,0 +1,256 @@
+#include "WeatherSupervisor.h"
+#include "WeatherBackend.h"
+#include <QDebug>
+#include <QRandomGenerator>
+#include <QTimer>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr int kWatchdogIntervalMs = 1000;
+constexpr int kMaxBackoffMs = 5 * 60 * 1000;
+constexpr int kLatencySamples = 256;
+
+} // namespace
+
+WeatherSupervisor::WeatherSupervisor(WeatherBackend *backend, const Policy &policy, QObject *parent)
+    : QObject(parent)
+    , m_backend(backend)
+    , m_policy(policy)
+    , m_watchdogTimer(new QTimer(this))
+    , m_heartbeatTimer(new QTimer(this))
+    , m_restartTimer(new QTimer(this))
+    , m_state(CircuitState::Closed)
+    , m_consecutiveFailures(0)
+    , m_lastProgressMs(0)
+    , m_heartbeatId(0)
+    , m_latencyNext(0)
+{
+    m_clock.start();
+    m_latencies.reserve(kLatencySamples);
+
+    connect(m_backend, &WeatherBackend::requestStarted, this, &WeatherSupervisor::onRequestStarted);
+    connect(m_backend, &WeatherBackend::weatherReady, this, &WeatherSupervisor::onWeatherReady);
+    connect(m_backend, &WeatherBackend::requestFailed, this, &WeatherSupervisor::onRequestFailed);
+
+    // 只在有未完成的请求时运行
+    m_watchdogTimer->setInterval(kWatchdogIntervalMs);
+    connect(m_watchdogTimer, &QTimer::timeout, this, &WeatherSupervisor::checkProgress);
+
+    // 心跳不需要精确：粗粒度定时器让系统把它与其他周期性唤醒合并
+    m_heartbeatTimer->setInterval(m_policy.heartbeatIntervalMs);
+    m_heartbeatTimer->setTimerType(Qt::VeryCoarseTimer);
+    connect(m_heartbeatTimer, &QTimer::timeout, this, &WeatherSupervisor::sendHeartbeat);
+    m_heartbeatTimer->start();
+
+    m_restartTimer->setSingleShot(true);
+    connect(m_restartTimer, &QTimer::timeout, this, &WeatherSupervisor::onRestartTimer);
+}
+
+bool WeatherSupervisor::allowRequest() const
+{
+    return m_state == CircuitState::Closed;
+}
+
+int WeatherSupervisor::retryAfterMs() const
+{
+    return m_state == CircuitState::Open ? qMax(0, m_restartTimer->remainingTime()) : 0;
+}
+
+WeatherSupervisor::CircuitState WeatherSupervisor::circuitState() const
+{
+    return m_state;
+}
+
+WeatherSupervisor::Stats WeatherSupervisor::stats() const
+{
+    Stats result = m_stats;
+    QVector<qint64> sorted = m_latencies;
+    std::sort(sorted.begin(), sorted.end());
+    result.p50Ms = percentile(sorted, 0.50);
+    result.p95Ms = percentile(sorted, 0.95);
+    result.p99Ms = percentile(sorted, 0.99);
+    return result;
+}
+
+void WeatherSupervisor::onRequestStarted(int requestId)
+{
+    const qint64 now = m_clock.elapsed();
+    m_startTimes.insert(requestId, now);
+
+    if (!m_watchdogTimer->isActive()) {
+        m_lastProgressMs = now;
+        m_watchdogTimer->start();
+    }
+}
+
+void WeatherSupervisor::onWeatherReady(int requestId)
+{
+    const qint64 now = m_clock.elapsed();
+    m_lastProgressMs = now;
+
+    if (requestId == m_heartbeatId) {
+        m_heartbeatId = 0;
+        m_startTimes.remove(requestId);
+        recordSuccess();
+        return;
+    }
+
+    auto it = m_startTimes.find(requestId);
+    if (it == m_startTimes.end()) {
+        return;  // 重启之前发出的请求
+    }
+    const qint64 startedAt = it.value();
+    m_startTimes.erase(it);
+
+    // 业务上的错误响应（城市不存在等）也说明后端是健康的
+    ++m_stats.completed;
+    recordLatency(now - startedAt);
+    recordSuccess();
+    emit statsChanged();
+}
+
+void WeatherSupervisor::onRequestFailed(int requestId)
+{
+    m_lastProgressMs = m_clock.elapsed();
+
+    if (requestId == m_heartbeatId) {
+        m_heartbeatId = 0;
+        m_startTimes.remove(requestId);
+    } else if (m_startTimes.remove(requestId) == 0) {
+        return;  // 由 checkProgress 主动中止的请求已经计过数
+    }
+
+    ++m_stats.failures;
+    recordFailure();
+    emit statsChanged();
+}
+
+void WeatherSupervisor::checkProgress()
+{
+    if (m_backend->pendingCount() == 0) {
+        m_watchdogTimer->stop();
+        // 被调用方取消的请求不会有响应，丢掉它们的计时
+        m_startTimes.clear();
+        return;
+    }
+
+    if (m_clock.elapsed() - m_lastProgressMs < m_policy.requestTimeoutMs) {
+        return;
+    }
+
+    // 有请求在等待，却迟迟没有任何响应：后端卡死了
+    qWarning() << "Weather backend made no progress for" << m_policy.requestTimeoutMs << "ms - restarting";
+    ++m_stats.timeouts;
+    m_watchdogTimer->stop();
+    m_startTimes.clear();
+    m_heartbeatId = 0;
+    m_backend->stop(QString("Request timed out after %1 seconds. Please check your internet connection.")
+                    .arg(m_policy.requestTimeoutMs / 1000));
+
+    recordFailure();
+    emit statsChanged();
+}
+
+void WeatherSupervisor::sendHeartbeat()
+{
+    // 后端忙时由 checkProgress 判断健康；最近刚有过响应（例如后台刷新）时无需心跳；
+    // 没有运行的进程不为心跳而启动
+    if (m_state != CircuitState::Closed || m_heartbeatId != 0
+        || m_backend->pendingCount() > 0 || !m_backend->isRunning()
+        || m_clock.elapsed() - m_lastProgressMs < m_policy.heartbeatIntervalMs) {
+        return;
+    }
+    m_heartbeatId = m_backend->ping();
+}
+
+void WeatherSupervisor::onRestartTimer()
+{
+    if (m_state == CircuitState::Open) {
+        m_state = CircuitState::HalfOpen;
+        qDebug() << "Weather circuit half-open - probing backend";
+    }
+    if (!m_backend->isRunning()) {
+        ++m_stats.restarts;
+        emit statsChanged();
+    }
+
+    // 心跳同时起到预热作用：Python 后端未运行时会先启动进程
+    m_heartbeatId = m_backend->ping();
+}
+
+void WeatherSupervisor::recordSuccess()
+{
+    m_consecutiveFailures = 0;
+    if (m_state != CircuitState::Closed) {
+        m_state = CircuitState::Closed;
+        m_restartTimer->stop();
+        qDebug() << "Weather circuit closed";
+        emit circuitClosed();
+    }
+}
+
+void WeatherSupervisor::recordFailure()
+{
+    ++m_consecutiveFailures;
+
+    if (m_state == CircuitState::HalfOpen || m_consecutiveFailures >= m_policy.maxFailures) {
+        openCircuit();
+    } else if (!m_backend->isRunning()) {
+        scheduleRestart();
+    }
+}
+
+void WeatherSupervisor::scheduleRestart()
+{
+    if (m_restartTimer->isActive()) {
+        return;
+    }
+    const int delayMs = backoffMs(m_consecutiveFailures);
+    qDebug() << "Restarting weather backend in" << delayMs << "ms";
+    m_restartTimer->start(delayMs);
+}
+
+void WeatherSupervisor::openCircuit()
+{
+    // 冷却时间随连续失败次数继续增长：探测失败后等待更久
+    const int cooldownMs = backoffMs(m_consecutiveFailures);
+    const bool wasOpen = m_state == CircuitState::Open;
+    m_state = CircuitState::Open;
+    m_restartTimer->start(cooldownMs);
+
+    qWarning() << "Weather circuit open after" << m_consecutiveFailures << "failures; retrying in" << cooldownMs << "ms";
+    if (!wasOpen) {
+        emit circuitOpened(cooldownMs);
+    }
+}
+
+int WeatherSupervisor::backoffMs(int attempt) const
+{
+    // 指数退避 + 一半的随机抖动，避免多个实例同时重试
+    const int exponent = qBound(0, attempt - 1, 16);
+    const qint64 ceiling = qMin<qint64>(kMaxBackoffMs, qint64(m_policy.restartDelayMs) << exponent);
+    const qint64 half = ceiling / 2;
+    return int(half + QRandomGenerator::global()->bounded(half + 1));
+}
+
+void WeatherSupervisor::recordLatency(qint64 ms)
+{
+    if (m_latencies.size() < kLatencySamples) {
+        m_latencies.append(ms);
+        return;
+    }
+    m_latencies[m_latencyNext] = ms;
+    m_latencyNext = (m_latencyNext + 1) % kLatencySamples;
+}
+
+qint64 WeatherSupervisor::percentile(const QVector<qint64> &sorted, double fraction)
+{
+    if (sorted.isEmpty()) {
+        return 0;
+    }
+    // nearest-rank
+    const int rank = int(std::ceil(fraction * sorted.size()));
+    return sorted.at(qBound(0, rank - 1, int(sorted.size()) - 1));
+}
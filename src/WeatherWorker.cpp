@@ -0,0 +1,221 @@
+#include "WeatherWorker.h"
+#include <QDebug>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonParseError>
+
+namespace {
+
+// stderr 只保留末尾这么多字节
+constexpr int kStderrTailSize = 2048;
+
+} // namespace
+
+WeatherWorker::WeatherWorker(QObject *parent)
+    : WeatherBackend(parent)
+    , m_process(nullptr)
+    , m_nextRequestId(1)
+{
+    m_process = createProcess();
+}
+
+WeatherWorker::~WeatherWorker()
+{
+    if (m_process->state() != QProcess::NotRunning) {
+        // 不等待进程自行退出：kill 之后 QProcess 的析构只需回收已终止的进程
+        // （地理编码表以原子替换写入，中途终止不会留下损坏的文件）
+        disconnect(m_process, nullptr, this, nullptr);
+        m_process->kill();
+    }
+}
+
+void WeatherWorker::setProgram(const QString &pythonExecutable, const QString &scriptPath)
+{
+    if (pythonExecutable == m_pythonExecutable && scriptPath == m_scriptPath) {
+        return;
+    }
+    m_pythonExecutable = pythonExecutable;
+    m_scriptPath = scriptPath;
+    stop("Python worker restarted with a different program");
+}
+
+int WeatherWorker::requestWeather(const QString &city)
+{
+    QJsonObject request;
+    request["city"] = city;
+    return send(request, city);
+}
+
+int WeatherWorker::requestWeatherBatch(const QStringList &cities)
+{
+    QJsonObject request;
+    request["cities"] = QJsonArray::fromStringList(cities);
+    return send(request, cities.join(','));
+}
+
+int WeatherWorker::ping()
+{
+    QJsonObject request;
+    request["op"] = "ping";
+    return send(request, "ping");
+}
+
+int WeatherWorker::send(const QJsonObject &request, const QString &description)
+{
+    const int requestId = m_nextRequestId++;
+    m_pending.insert(requestId, description);
+    emit requestStarted(requestId);
+
+    if (!ensureStarted()) {
+        return requestId;
+    }
+
+    QJsonObject message = request;
+    message["id"] = requestId;
+    // 启动阶段写入的数据由 QProcess 缓冲，进程就绪后再发送
+    m_process->write(QJsonDocument(message).toJson(QJsonDocument::Compact) + '\n');
+    return requestId;
+}
+
+void WeatherWorker::cancel(int requestId)
+{
+    m_pending.remove(requestId);
+}
+
+void WeatherWorker::stop(const QString &reason)
+{
+    if (m_process->state() != QProcess::NotRunning) {
+        // kill() 是异步的：旧进程退出后自行删除，新请求使用新的 QProcess
+        QProcess *oldProcess = m_process;
+        disconnect(oldProcess, nullptr, this, nullptr);
+        connect(oldProcess, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+                oldProcess, &QObject::deleteLater);
+        oldProcess->kill();
+        m_process = createProcess();
+    }
+    failPending(reason);
+}
+
+int WeatherWorker::pendingCount() const
+{
+    return m_pending.size();
+}
+
+bool WeatherWorker::isRunning() const
+{
+    return m_process->state() == QProcess::Running;
+}
+
+QProcess *WeatherWorker::createProcess()
+{
+    QProcess *process = new QProcess(this);
+    connect(process, &QProcess::readyReadStandardOutput,
+            this, &WeatherWorker::onReadyReadStandardOutput);
+    connect(process, &QProcess::readyReadStandardError,
+            this, &WeatherWorker::onReadyReadStandardError);
+    connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished),
+            this, &WeatherWorker::onProcessFinished);
+    connect(process, &QProcess::errorOccurred,
+            this, &WeatherWorker::onProcessError);
+    return process;
+}
+
+bool WeatherWorker::ensureStarted()
+{
+    if (m_process->state() != QProcess::NotRunning) {
+        return true;
+    }
+    if (m_pythonExecutable.isEmpty() || m_scriptPath.isEmpty()) {
+        failPending("Python worker is not configured");
+        return false;
+    }
+
+    m_stdoutBuffer.clear();
+    m_stderrTail.clear();
+
+    qDebug() << "Starting weather worker:" << m_pythonExecutable << m_scriptPath << "--server";
+    m_process->start(m_pythonExecutable, {m_scriptPath, "--server"});
+    return true;
+}
+
+void WeatherWorker::failPending(const QString &error)
+{
+    if (m_pending.isEmpty()) {
+        return;
+    }
+
+    // 失败总是异步通知：调用方在 requestWeather() 返回、记下 id 之后才会收到
+    const QList<int> requestIds = m_pending.keys();
+    m_pending.clear();
+    QMetaObject::invokeMethod(this, [this, requestIds, error]() {
+        for (int requestId : requestIds) {
+            emit requestFailed(requestId, error);
+        }
+    }, Qt::QueuedConnection);
+}
+
+void WeatherWorker::onReadyReadStandardOutput()
+{
+    m_stdoutBuffer += m_process->readAllStandardOutput();
+
+    int lineStart = 0;
+    int newline;
+    while ((newline = m_stdoutBuffer.indexOf('\n', lineStart)) != -1) {
+        const QByteArray line = m_stdoutBuffer.mid(lineStart, newline - lineStart).trimmed();
+        lineStart = newline + 1;
+        if (line.isEmpty()) {
+            continue;
+        }
+
+        QJsonParseError parseError;
+        const QJsonDocument doc = QJsonDocument::fromJson(line, &parseError);
+        if (parseError.error != QJsonParseError::NoError || !doc.isObject()) {
+            qWarning() << "Weather worker: ignoring non-JSON output:" << line.left(200);
+            continue;
+        }
+
+        const QJsonObject response = doc.object();
+        const int requestId = response.value("id").toInt();
+        if (m_pending.remove(requestId) == 0) {
+            continue;  // 已取消或已超时的请求
+        }
+        emit weatherReady(requestId, response);
+    }
+    m_stdoutBuffer.remove(0, lineStart);
+}
+
+void WeatherWorker::onReadyReadStandardError()
+{
+    const QByteArray data = m_process->readAllStandardError();
+    qDebug().noquote() << "Weather worker stderr:" << QString::fromUtf8(data).trimmed();
+
+    m_stderrTail += data;
+    if (m_stderrTail.size() > kStderrTailSize) {
+        m_stderrTail = m_stderrTail.right(kStderrTailSize);
+    }
+}
+
+void WeatherWorker::onProcessFinished(int exitCode, QProcess::ExitStatus exitStatus)
+{
+    qDebug() << "Weather worker exited with code" << exitCode << exitStatus;
+
+    QString error = QString("Python worker exited unexpectedly (code %1)").arg(exitCode);
+    const QString details = QString::fromUtf8(m_stderrTail).trimmed();
+    if (!details.isEmpty()) {
+        error += ":\n" + details;
+    }
+    failPending(error);
+}
+
+void WeatherWorker::onProcessError(QProcess::ProcessError error)
+{
+    if (error != QProcess::FailedToStart) {
+        // 崩溃等错误随后还会触发 finished，统一在那里处理
+        qWarning() << "Weather worker error:" << error;
+        return;
+    }
+
+    qWarning() << "Weather worker failed to start:" << m_pythonExecutable;
+    failPending("Failed to start Python. Please check your Python installation.");
+    emit failedToStart();
+}
@@ -0,0 +1,106 @@
+#include "ZoomController.h"
+#include <QDebug>
+#include <QTimer>
+
+namespace {
+
+constexpr int kFrameIntervalMs = 16;
+// 与预览防抖同一量级：滚轮停止后才重新布局预览
+constexpr int kSettleDelayMs = 200;
+
+} // namespace
+
+ZoomController::ZoomController(double initialZoom, QObject *parent)
+    : QObject(parent)
+    , m_frameTimer(new QTimer(this))
+    , m_settleTimer(new QTimer(this))
+    , m_target(initialZoom)
+    , m_applied(initialZoom)
+    , m_requests(0)
+    , m_frames(0)
+    , m_totalFrameNs(0)
+    , m_maxFrameNs(0)
+{
+    m_frameTimer->setSingleShot(true);
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    m_frameTimer->setInterval(kFrameIntervalMs);
+    connect(m_frameTimer, &QTimer::timeout, this, &ZoomController::onFrameTimeout);
+
+    m_settleTimer->setSingleShot(true);
+    m_settleTimer->setInterval(kSettleDelayMs);
+    connect(m_settleTimer, &QTimer::timeout, this, &ZoomController::onSettleTimeout);
+}
+
+void ZoomController::setTarget(double zoom)
+{
+    if (!m_settleTimer->isActive() && !m_frameTimer->isActive()) {
+        m_requests = 0;
+        m_frames = 0;
+        m_totalFrameNs = 0;
+        m_maxFrameNs = 0;
+        m_gestureTimer.start();
+    }
+    ++m_requests;
+    m_target = zoom;
+    m_settleTimer->start();
+
+    // 帧间隔内的后续请求只更新目标，由定时器在下一帧应用
+    if (!m_frameTimer->isActive()) {
+        emitFrame();
+        m_frameTimer->start();
+    }
+}
+
+double ZoomController::target() const
+{
+    return m_target;
+}
+
+void ZoomController::flush()
+{
+    m_frameTimer->stop();
+    m_settleTimer->stop();
+    m_applied = m_target;
+    emit frame(m_target);
+    emit settled(m_target);
+}
+
+void ZoomController::onFrameTimeout()
+{
+    if (m_applied != m_target) {
+        emitFrame();
+        m_frameTimer->start();
+    }
+}
+
+void ZoomController::onSettleTimeout()
+{
+    m_frameTimer->stop();
+    if (m_applied != m_target) {
+        emitFrame();
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    emit settled(m_target);
+    const double settleMs = timer.nsecsElapsed() / 1e6;
+
+    if (m_frames > 0) {
+        qDebug() << "Zoom gesture:" << m_requests << "requests," << m_frames << "frames in"
+                 << m_gestureTimer.elapsed() << "ms; frame avg" << m_totalFrameNs / m_frames / 1e6
+                 << "ms, max" << m_maxFrameNs / 1e6 << "ms; preview relayout" << settleMs << "ms";
+    }
+}
+
+void ZoomController::emitFrame()
+{
+    QElapsedTimer timer;
+    timer.start();
+    m_applied = m_target;
+    emit frame(m_target);
+
+    const qint64 elapsed = timer.nsecsElapsed();
+    ++m_frames;
+    m_totalFrameNs += elapsed;
+    m_maxFrameNs = qMax(m_maxFrameNs, elapsed);
+}
@@ -1,12 +1,62 @@
 #include "MainWindow.h"
+#include "BatchExporter.h"
+#include "NativeWeatherBackend.h"
+#include "StartupTracer.h"
 #include <QApplication>
+#include <QCoreApplication>
+#include <cstring>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <cstdio>
+#endif
+
+namespace {
+
+// WIN32 子系统程序没有控制台；附加到父进程控制台以便输出统计信息
+void attachParentConsole()
+{
+#ifdef Q_OS_WIN
+    if (_fileno(stdout) < 0 && AttachConsole(ATTACH_PARENT_PROCESS)) {
+        freopen("CONOUT$", "w", stdout);
+        freopen("CONOUT$", "w", stderr);
+    }
+#endif
+}
+
+} // namespace
 
 int main(int argc, char *argv[])
 {
+    // 无界面批量导出：WeatherApp --export <输入目录> <输出目录>
+    // 只创建 QCoreApplication，不需要显示器或平台插件
+    if (argc >= 2 && std::strcmp(argv[1], "--export") == 0) {
+        attachParentConsole();
+        QCoreApplication app(argc, argv);
+        return BatchExporter::runFromCommandLine(app.arguments());
+    }
+
+    // 命令行天气查询（原生后端）：WeatherApp --weather [--batch] <城市>...
+    if (argc >= 2 && std::strcmp(argv[1], "--weather") == 0) {
+        attachParentConsole();
+        QCoreApplication app(argc, argv);
+        return NativeWeatherBackend::runFromCommandLine(app.arguments());
+    }
+
+    // 启动计时：--trace-startup 或 MDCODER_TRACE_STARTUP 时输出各阶段耗时
+    StartupTracer::begin(argc, argv);
+    if (StartupTracer::isEnabled()) {
+        attachParentConsole();
+    }
+
     QApplication app(argc, argv);
+    // Fusion 完全按调色板绘制：切换主题只需替换应用程序调色板（见 ThemeManager）
+    QApplication::setStyle("Fusion");
+    StartupTracer::mark("QApplication");
 
     MainWindow window;
     window.show();
+    StartupTracer::mark("show");
 
     return app.exec();
 }